@@ -396,6 +396,13 @@ namespace AZ
          */
         virtual void GetIncompatibleServices(DependencyArrayType& incompatible, const Component* instance) const    { (void)incompatible;  (void)instance; }
 
+        /**
+         * Specifies whether the services of the component are the same for every instance.
+         * Entities reuse the activation order of component sets whose services are all instance independent, see AZ::DependencySortCache.
+         * @return Returns false by default, override it to return true if the service functions never use their instance parameter.
+         */
+        virtual bool HasInstanceIndependentServices() const { return false; }
+
         /**
          * Specifies warnings that you want in the component (will put a warning and a continue button).
          * @param warnings provided array of strings that would be the actual warnings.
@@ -568,6 +575,14 @@ namespace AZ
             CallIncompatibleServices(incompatible, typename HasComponentIncompatibleServices<ComponentClass>::type());
         }
 
+        /**
+         * The services are provided by static functions of the component, so they are the same for every instance.
+         */
+        bool HasInstanceIndependentServices() const override
+        {
+            return true;
+        }
+
     private:
 
         void CallReflect(ReflectContext* reflection, const AZStd::true_type&) const
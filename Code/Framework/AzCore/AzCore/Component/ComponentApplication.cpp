@@ -696,8 +696,8 @@ namespace AZ
         // deactivate all entities
         while (!m_entities.empty())
         {
-            Entity* entity = m_entities.begin()->second;
-            m_entities.erase(m_entities.begin());
+            Entity* entity = m_entities.GetLast();
+            m_entities.Remove(entity->GetId());
 
             if (entity->GetId() == SystemEntityId)
             {
@@ -727,8 +727,8 @@ namespace AZ
             }
         }
 
-        m_entities.clear();
-        m_entities.rehash(0); // force free all memory
+        m_entities.Clear(); // force free all memory
+        m_dependencySortCache.Clear();
 
         DestroyReflectionManager();
 
@@ -984,6 +984,9 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::UnregisterComponentDescriptor(const ComponentDescriptor* descriptor)
     {
+        // The component type may come back with different services, e.g. when its module is reloaded
+        m_dependencySortCache.Clear();
+
         if (ReflectionEnvironment::GetReflectionManager())
         {
             ReflectionEnvironment::GetReflectionManager()->Unreflect(descriptor->GetUuid());
@@ -1032,7 +1035,7 @@ namespace AZ
             return false;
         }
         m_entityAddedEvent.Signal(entity);
-        return m_entities.insert(AZStd::make_pair(entity->GetId(), entity)).second;
+        return m_entities.Insert(entity);
     }
 
     //=========================================================================
@@ -1047,7 +1050,7 @@ namespace AZ
             return false;
         }
         m_entityRemovedEvent.Signal(entity);
-        return (m_entities.erase(entity->GetId()) == 1);
+        return m_entities.Remove(entity->GetId());
     }
 
     //=========================================================================
@@ -1072,12 +1075,15 @@ namespace AZ
     //=========================================================================
     Entity* ComponentApplication::FindEntity(const EntityId& id)
     {
-        EntitySetType::const_iterator it = m_entities.find(id);
-        if (it != m_entities.end())
-        {
-            return it->second;
-        }
-        return nullptr;
+        return m_entities.Find(id);
+    }
+
+    //=========================================================================
+    // FindEntityByHandle
+    //=========================================================================
+    Entity* ComponentApplication::FindEntityByHandle(EntitySlotHandle handle)
+    {
+        return m_entities.Find(handle);
     }
 
     //=========================================================================
@@ -1113,10 +1119,7 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::EnumerateEntities(const ComponentApplicationRequests::EntityCallback& callback)
     {
-        for (const auto& entityIter : m_entities)
-        {
-            callback(entityIter.second);
-        }
+        m_entities.Enumerate(callback);
     }
 
     //=========================================================================
@@ -9,7 +9,9 @@
 
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/DependencySortCache.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/EntitySlotMap.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/BudgetTracker.h>
@@ -78,9 +80,6 @@ namespace AZ
         : public ComponentApplicationBus::Handler
         , public TickRequestBus::Handler
     {
-        // or try to use unordered set if we store the ID internally
-        typedef AZStd::unordered_map<EntityId, Entity*>  EntitySetType;
-
     public:
         AZ_RTTI(ComponentApplication, "{1F3B070F-89F7-4C3D-B5A3-8832D5BC81D7}");
         AZ_CLASS_ALLOCATOR(ComponentApplication, SystemAllocator, 0);
@@ -208,9 +207,11 @@ namespace AZ
         bool RemoveEntity(Entity* entity) override;
         bool DeleteEntity(const EntityId& id) override;
         Entity* FindEntity(const EntityId& id) override;
+        Entity* FindEntityByHandle(EntitySlotHandle handle) override;
         AZStd::string GetEntityName(const EntityId& id) override;
         bool SetEntityName(const EntityId& id, const AZStd::string_view name) override;
         void EnumerateEntities(const ComponentApplicationRequests::EntityCallback& callback) override;
+        DependencySortCache* GetDependencySortCache() override { return &m_dependencySortCache; }
         ComponentApplication* GetApplication() override { return this; }
         /// Returns the serialize context that has been registered with the app, if there is one.
         SerializeContext* GetSerializeContext() override;
@@ -384,7 +385,8 @@ namespace AZ
         bool                                        m_ownsConsole{};
         void*                                       m_fixedMemoryBlock{ nullptr }; //!< Pointer to the memory block allocator, so we can free it OnDestroy.
         IAllocatorAllocate*                         m_osAllocator{ nullptr };
-        EntitySetType                               m_entities;
+        EntitySlotMap                               m_entities;
+        DependencySortCache                         m_dependencySortCache;
         AZ::IO::FixedMaxPath                        m_exeDirectory;
         AZ::IO::FixedMaxPath                        m_engineRoot;
         AZ::IO::FixedMaxPath                        m_appRoot;
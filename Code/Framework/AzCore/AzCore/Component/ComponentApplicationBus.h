@@ -11,6 +11,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/Event.h>
 #include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/EntitySlotMap.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/osstring.h>
 
@@ -19,6 +20,7 @@ namespace AZ
     class CommandLine;
     class ComponentApplication;
     class ComponentDescriptor;
+    class DependencySortCache;
 
     class Entity;
     class EntityId;
@@ -138,6 +140,12 @@ namespace AZ
         //! @return A pointer to the entity with the specified entity ID.
         virtual Entity* FindEntity(const EntityId& id) = 0;
 
+        //! Returns the entity the slot handle refers to, without looking up its ID.
+        //! Callers which repeatedly look up the same entity can keep its Entity::GetSlotHandle() instead of its ID.
+        //! @param handle The slot handle of the entity that you are searching for.
+        //! @return A pointer to the entity, or null if it was removed from the application since the handle was retrieved.
+        virtual Entity* FindEntityByHandle([[maybe_unused]] EntitySlotHandle handle) { return nullptr; }
+
         //! Returns the name of the entity that has the specified entity ID.
         //! Entity names are not unique.
         //! This method exists to facilitate better debugging messages.
@@ -194,6 +202,10 @@ namespace AZ
         //! (Call the base class if you want this behavior to persist in overrides)
         virtual void ResolveModulePath([[maybe_unused]] AZ::OSString& modulePath) { }
 
+        //! Returns the cache of component activation orders shared by the entities of the application.
+        //! @return The cache, or null if activation orders aren't cached, in which case entities sort their components every time.
+        virtual DependencySortCache* GetDependencySortCache() { return nullptr; }
+
         //! Returns AZ parsed command line structure.
         //! Command Line structure can be queried for switches (-<switch> /<switch>) or positional parameter (<value>)
         virtual AZ::CommandLine* GetAzCommandLine() { return{}; }
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/DependencySortCache.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    bool DependencySortCache::Apply(Entity::ComponentArrayType& components) const
+    {
+        AZStd::vector<ComponentKey> keys;
+        if (!GetComponentKeys(components, keys))
+        {
+            return false;
+        }
+
+        Entity::ComponentArrayType sortedComponents;
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+            auto entryIt = m_entries.find(GetHash(keys));
+            if (entryIt == m_entries.end() || entryIt->second.m_components != keys)
+            {
+                return false;
+            }
+
+            const Entry& entry = entryIt->second;
+            sortedComponents.reserve(entry.m_order.size());
+            for (u32 index : entry.m_order)
+            {
+                sortedComponents.push_back(components[index]);
+            }
+
+            if (entry.m_hasDuplicateTypes)
+            {
+                // Components of the same type have the same dependencies, DependencySort orders them by their id
+                for (size_t position = 0; position < sortedComponents.size(); ++position)
+                {
+                    for (size_t otherPosition = position + 1; otherPosition < sortedComponents.size(); ++otherPosition)
+                    {
+                        if (keys[entry.m_order[position]] == keys[entry.m_order[otherPosition]] &&
+                            sortedComponents[otherPosition]->GetId() < sortedComponents[position]->GetId())
+                        {
+                            AZStd::swap(sortedComponents[position], sortedComponents[otherPosition]);
+                        }
+                    }
+                }
+            }
+        }
+
+        components.swap(sortedComponents);
+        return true;
+    }
+
+    void DependencySortCache::Store(const Entity::ComponentArrayType& unsortedComponents, const Entity::ComponentArrayType& sortedComponents)
+    {
+        Entry entry;
+        if (!GetComponentKeys(unsortedComponents, entry.m_components) || sortedComponents.size() != unsortedComponents.size())
+        {
+            return;
+        }
+
+        entry.m_order.reserve(sortedComponents.size());
+        for (Component* component : sortedComponents)
+        {
+            auto unsortedIt = AZStd::find(unsortedComponents.begin(), unsortedComponents.end(), component);
+            if (unsortedIt == unsortedComponents.end())
+            {
+                return;
+            }
+            entry.m_order.push_back(static_cast<u32>(unsortedIt - unsortedComponents.begin()));
+        }
+
+        for (size_t index = 0; index < entry.m_components.size() && !entry.m_hasDuplicateTypes; ++index)
+        {
+            entry.m_hasDuplicateTypes = AZStd::find(
+                entry.m_components.begin() + index + 1, entry.m_components.end(), entry.m_components[index]) != entry.m_components.end();
+        }
+
+        const size_t hash = GetHash(entry.m_components);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        auto entryIt = m_entries.find(hash);
+        if (entryIt != m_entries.end())
+        {
+            // Either the same set sorted on another thread, or a hash collision in which case the latest set wins
+            entryIt->second = AZStd::move(entry);
+        }
+        else if (m_entries.size() < MaxEntryCount)
+        {
+            m_entries.emplace(hash, AZStd::move(entry));
+        }
+    }
+
+    void DependencySortCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        m_entries.clear();
+        m_entries.rehash(0); // free the buckets as well, this is also called when the application shuts down
+    }
+
+    size_t DependencySortCache::size() const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+
+    bool DependencySortCache::GetComponentKeys(const Entity::ComponentArrayType& components, AZStd::vector<ComponentKey>& keys)
+    {
+        keys.reserve(components.size());
+        for (const Component* component : components)
+        {
+            if (!component)
+            {
+                return false;
+            }
+
+            ComponentDescriptor* componentDescriptor = nullptr;
+            ComponentDescriptorBus::EventResult(componentDescriptor, azrtti_typeid(component), &ComponentDescriptorBus::Events::GetDescriptor);
+            if (!componentDescriptor || !componentDescriptor->HasInstanceIndependentServices())
+            {
+                return false;
+            }
+
+            keys.push_back({ azrtti_typeid(component), component->GetUnderlyingComponentType() });
+        }
+        return true;
+    }
+
+    size_t DependencySortCache::GetHash(const AZStd::vector<ComponentKey>& keys)
+    {
+        size_t hash = keys.size();
+        for (const ComponentKey& key : keys)
+        {
+            AZStd::hash_combine(hash, key.m_type, key.m_underlyingType);
+        }
+        return hash;
+    }
+} // namespace AZ
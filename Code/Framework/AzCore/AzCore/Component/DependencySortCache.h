@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Entity.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZ
+{
+    //! Caches the activation order Entity::DependencySort finds for a set of components, so entities with the same
+    //! component types, like the ones spawned from the same prefab, don't solve the service dependencies again.
+    //! Sets are keyed by the ordered list of component types. Only components whose descriptor reports instance
+    //! independent services (see ComponentDescriptor::HasInstanceIndependentServices) can be cached, and failed sorts
+    //! are never cached so their error messages are always reported.
+    //! The cache is owned by the ComponentApplication and is safe to use from multiple threads.
+    class DependencySortCache
+    {
+    public:
+        //! Maximum number of component sets kept, further sets are sorted without being cached.
+        static constexpr size_t MaxEntryCount = 4096;
+
+        //! Sorts the components in the cached activation order of their component set.
+        //! Returns false and leaves the components untouched if the set isn't in the cache.
+        bool Apply(Entity::ComponentArrayType& components) const;
+
+        //! Caches the activation order DependencySort produced from the unsorted components.
+        void Store(const Entity::ComponentArrayType& unsortedComponents, const Entity::ComponentArrayType& sortedComponents);
+
+        //! Removes all component sets, this must be called when the services of a component type can change,
+        //! for example when its descriptor is unregistered.
+        void Clear();
+
+        size_t size() const;
+
+    private:
+        struct ComponentKey
+        {
+            bool operator==(const ComponentKey& rhs) const
+            {
+                return m_type == rhs.m_type && m_underlyingType == rhs.m_underlyingType;
+            }
+
+            TypeId m_type;
+            TypeId m_underlyingType; //!< Used by DependencySort to order components which provide the same services.
+        };
+
+        struct Entry
+        {
+            AZStd::vector<ComponentKey> m_components; //!< Keys of the unsorted components.
+            AZStd::vector<u32> m_order; //!< Index of the unsorted component at each position of the sorted components.
+            bool m_hasDuplicateTypes = false;
+        };
+
+        //! Fills the keys of the components and returns true if they can be cached.
+        static bool GetComponentKeys(const Entity::ComponentArrayType& components, AZStd::vector<ComponentKey>& keys);
+        static size_t GetHash(const AZStd::vector<ComponentKey>& keys);
+
+        AZStd::unordered_map<size_t, Entry> m_entries;
+        mutable AZStd::shared_mutex m_mutex;
+    };
+} // namespace AZ
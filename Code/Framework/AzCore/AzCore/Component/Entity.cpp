@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/DependencySortCache.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/EntityIdSerializer.h>
 #include <AzCore/Component/EntitySerializer.h>
@@ -51,6 +52,21 @@ namespace AZ
         }
     };
 
+    namespace EntityInternal
+    {
+        //! Hashes the whole component type ID, Uuid::GetHash() only uses its first half which
+        //! is often shared by hand written component IDs.
+        static size_t GetComponentLookupHash(const Uuid& typeId)
+        {
+            AZ::u64 low;
+            AZ::u64 high;
+            memcpy(&low, typeId.begin(), sizeof(low));
+            memcpy(&high, typeId.begin() + sizeof(low), sizeof(high));
+            const AZ::u64 hash = low ^ (high * 0x9E3779B97F4A7C15ull);
+            return static_cast<size_t>(hash ^ (hash >> 32));
+        }
+    } // namespace EntityInternal
+
     class BehaviorEntityBusHandler
         : public EntityBus::Handler
         , public BehaviorEBusHandler
@@ -123,6 +139,7 @@ namespace AZ
         }
 
         m_components.clear();
+        m_componentLookup.clear();
 
         if (m_state == State::Init)
         {
@@ -166,19 +183,15 @@ namespace AZ
             AZ_Assert(result, "Failed to add entity '%s' [0x%llx]! Did you already register an entity with this ID?", m_name.c_str(), m_id);
         }
 
-        for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end();)
+        m_components.erase(AZStd::remove(m_components.begin(), m_components.end(), nullptr), m_components.end());
+
+        // Build the lookup before initializing the components, as they may look up one another.
+        RebuildComponentLookup();
+
+        for (Component* component : m_components)
         {
-            Component* component = *it;
-            if (component)
-            {
-                component->SetEntity(this);
-                component->Init();
-                ++it;
-            }
-            else
-            {
-                it = m_components.erase(it);
-            }
+            component->SetEntity(this);
+            component->Init();
         }
 
         SetState(State::Init);
@@ -260,8 +273,19 @@ namespace AZ
 
         if (!m_isDependencyReady)
         {
-            outcome = DependencySort(m_components);
+            ComponentApplicationRequests* componentApplication = AZ::Interface<ComponentApplicationRequests>::Get();
+            DependencySortCache* sortCache = componentApplication ? componentApplication->GetDependencySortCache() : nullptr;
+            if (!sortCache || !sortCache->Apply(m_components))
+            {
+                const ComponentArrayType unsortedComponents = sortCache ? m_components : ComponentArrayType();
+                outcome = DependencySort(m_components);
+                if (sortCache && outcome.IsSuccess())
+                {
+                    sortCache->Store(unsortedComponents, m_components);
+                }
+            }
             m_isDependencyReady = outcome.IsSuccess();
+            RebuildComponentLookup(); // Sorting can change which component of a type comes first.
         }
 
         return outcome;
@@ -341,6 +365,7 @@ namespace AZ
         }
         component->SetEntity(this);
         m_components.push_back(component);
+        RebuildComponentLookup();
 
         if (m_state == State::Init)
         {
@@ -487,6 +512,7 @@ namespace AZ
 
         m_components.erase(it);
         component->SetEntity(nullptr);
+        RebuildComponentLookup();
 
         InvalidateDependencies(); // We need to re-evaluate dependencies.
         return true;
@@ -516,6 +542,7 @@ namespace AZ
         componentToRemove->SetEntity(nullptr);
 
         *it = componentToAdd;
+        RebuildComponentLookup();
 
         componentToAdd->m_id = componentId;
         componentToAdd->SetEntity(this);
@@ -621,6 +648,25 @@ namespace AZ
 
     Component* Entity::FindComponent(const Uuid& type) const
     {
+        if (!m_componentLookup.empty())
+        {
+            // The table is at most half full so the probing always reaches an empty slot.
+            const size_t slotMask = m_componentLookup.size() - 1;
+            const size_t typeHash = EntityInternal::GetComponentLookupHash(type);
+            for (size_t slotIndex = typeHash & slotMask;; slotIndex = (slotIndex + 1) & slotMask)
+            {
+                const ComponentLookupSlot& slot = m_componentLookup[slotIndex];
+                if (!slot.m_component)
+                {
+                    return nullptr;
+                }
+                if (slot.m_typeHash == typeHash && slot.m_component->RTTI_GetType() == type)
+                {
+                    return slot.m_component;
+                }
+            }
+        }
+
         size_t numComponents = m_components.size();
         for (size_t i = 0; i < numComponents; ++i)
         {
@@ -633,6 +679,43 @@ namespace AZ
         return nullptr;
     }
 
+    void Entity::RebuildComponentLookup()
+    {
+        m_componentLookup.clear();
+        if (m_state == State::Constructed || m_components.size() < ComponentLookupMinComponents)
+        {
+            return;
+        }
+
+        size_t slotCount = 1;
+        while (slotCount < m_components.size() * 2)
+        {
+            slotCount <<= 1;
+        }
+        m_componentLookup.resize(slotCount);
+
+        const size_t slotMask = slotCount - 1;
+        for (Component* component : m_components)
+        {
+            const Uuid& type = component->RTTI_GetType();
+            const size_t typeHash = EntityInternal::GetComponentLookupHash(type);
+            for (size_t slotIndex = typeHash & slotMask;; slotIndex = (slotIndex + 1) & slotMask)
+            {
+                ComponentLookupSlot& slot = m_componentLookup[slotIndex];
+                if (!slot.m_component)
+                {
+                    slot.m_typeHash = typeHash;
+                    slot.m_component = component;
+                    break;
+                }
+                if (slot.m_typeHash == typeHash && slot.m_component->RTTI_GetType() == type)
+                {
+                    break; // Only the first component of each type is looked up.
+                }
+            }
+        }
+    }
+
     Entity::ComponentArrayType Entity::FindComponents(const Uuid& typeId) const
     {
         ComponentArrayType components;
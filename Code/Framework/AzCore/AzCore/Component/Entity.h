@@ -16,6 +16,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/EntitySlotMap.h>
 #include <AzCore/Debug/Budget.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/EBus/Event.h>
@@ -32,6 +33,7 @@ namespace AZ
     class Entity
     {
         friend class JsonEntitySerializer;
+        friend class EntitySlotMap;
 
     public:
 
@@ -133,6 +135,12 @@ namespace AZ
         //! @return The state of the entity. For example, the entity has been initialized, the entity is active, and so on.
         State GetState() const { return m_state; }
 
+        //! Gets the handle of the entity's slot in the ComponentApplication.
+        //! The handle is set while the entity is registered with the application (from Init() until it is removed)
+        //! and resolves through ComponentApplicationRequests::FindEntityByHandle() without looking up the entity ID.
+        //! @return The slot handle of the entity, invalid if the entity is not registered.
+        EntitySlotHandle GetSlotHandle() const { return m_slotHandle; }
+
         //! Connects an entity state event handler to the entity.
         //! All state changes will be signaled through this event.
         //! @param handler reference to the EntityStateEvent handler to attach to the entities state event.
@@ -267,6 +275,7 @@ namespace AZ
         Component* FindComponent(ComponentId id) const;
 
         //! Finds the first component of the requested component type.
+        //! Once the entity is initialized this is a constant time lookup, regardless of the number of components.
         //! @param typeId The type of component to find.
         //! @return A pointer to the first component of the requested type. Returns
         //! a null pointer if a component of the requested type cannot be found.
@@ -324,7 +333,8 @@ namespace AZ
         //! Calls DependencySort() to sort an entity's components based on the dependencies
         //! among components. If all dependencies are met, the required services can be
         //! activated before the components that depend on them. An entity will not be
-        //! activated unless the sort succeeds.
+        //! activated unless the sort succeeds. The order found for the same component types
+        //! is reused from the application's DependencySortCache when there is one.
         //! @return A successful outcome is returned if the entity can
         //! determine an order in which to activate its components.
         //! Otherwise the failed outcome contains details on why the sort failed.
@@ -392,6 +402,19 @@ namespace AZ
         static void ActivateComponent(Component& component) { component.Activate(); }
         static void DeactivateComponent(Component& component) { component.Deactivate(); }
 
+        //! Rebuilds the component lookup table after the component array changed.
+        void RebuildComponentLookup();
+
+        //! Entities with fewer components than this don't build a lookup table, scanning them is as fast.
+        static constexpr size_t ComponentLookupMinComponents = 8;
+
+        //! A slot of the component lookup table, empty when m_component is null.
+        struct ComponentLookupSlot
+        {
+            size_t m_typeHash = 0;
+            Component* m_component = nullptr;
+        };
+
         //! The ID that the system uses to identify and address the entity.
         //! The serializer determines whether this is an entity ID or an entity reference ID. 
         //! IMPORTANT: This must be the only EntityId member of the Entity class.
@@ -400,6 +423,12 @@ namespace AZ
         //! An array of components attached to the entity.
         ComponentArrayType m_components;
 
+        //! Open addressing hash table from component type to the first component of that type in m_components.
+        //! It is built when the entity is initialized and rebuilt whenever m_components changes afterwards.
+        //! It is left empty before initialization (the serializer fills m_components directly) and for entities
+        //! with few components, in which case FindComponent() scans m_components.
+        AZStd::vector<ComponentLookupSlot> m_componentLookup;
+
         //! An event used to signal all entity state changes.
         EntityStateEvent m_stateEvent;
 
@@ -414,6 +443,9 @@ namespace AZ
         //! The state of the entity.
         State m_state;
 
+        //! The slot of the entity in the ComponentApplication, set by EntitySlotMap.
+        EntitySlotHandle m_slotHandle;
+
         //! Foundational entity properties/flags.
         //! To keep AZ::Entity lightweight, one should resist the urge the add flags here unless they're extremely
         //! common to AZ::Entity use cases, and inherently fundamental.
@@ -132,6 +132,11 @@ namespace AZ
         template<class Bus>
         using ConnectionPolicy = EntityEventsConnectionPolicy<Bus>;
 
+        /**
+         * Most entities have handlers on this bus, so its addresses are stored densely.
+         */
+        static const EBusAddressPolicy AddressPolicy = EBusAddressPolicy::ByIdDense;
+
         /**
          * Destroys the instance of the class.
          */
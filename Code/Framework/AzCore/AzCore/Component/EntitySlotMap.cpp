@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/EntitySlotMap.h>
+#include <AzCore/Component/Entity.h>
+
+namespace AZ
+{
+    bool EntitySlotMap::Insert(Entity* entity)
+    {
+        auto insertResult = m_slotsById.emplace(entity->GetId(), Handle::InvalidIndex);
+        if (!insertResult.second)
+        {
+            return false;
+        }
+
+        u32 slotIndex;
+        if (!m_freeSlots.empty())
+        {
+            slotIndex = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slotIndex = static_cast<u32>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        Slot& slot = m_slots[slotIndex];
+        slot.m_entity = entity;
+        slot.m_denseIndex = static_cast<u32>(m_entities.size());
+        m_entities.push_back(entity);
+        m_denseSlots.push_back(slotIndex);
+        insertResult.first->second = slotIndex;
+
+        entity->m_slotHandle = Handle{ slotIndex, slot.m_generation };
+        return true;
+    }
+
+    bool EntitySlotMap::Remove(const EntityId& id)
+    {
+        auto it = m_slotsById.find(id);
+        if (it == m_slotsById.end())
+        {
+            return false;
+        }
+
+        const u32 slotIndex = it->second;
+        m_slotsById.erase(it);
+
+        Slot& slot = m_slots[slotIndex];
+        const u32 denseIndex = slot.m_denseIndex;
+        slot.m_entity->m_slotHandle = Handle{};
+        slot.m_entity = nullptr;
+        slot.m_denseIndex = Handle::InvalidIndex;
+        ++slot.m_generation;
+        m_freeSlots.push_back(slotIndex);
+
+        if (m_enumerationDepth > 0)
+        {
+            // Keep the positions of the other entities while they are enumerated, the entry is compacted afterwards
+            m_entities[denseIndex] = nullptr;
+            m_denseSlots[denseIndex] = Handle::InvalidIndex;
+            return true;
+        }
+
+        const u32 lastIndex = static_cast<u32>(m_entities.size() - 1);
+        if (denseIndex != lastIndex)
+        {
+            m_entities[denseIndex] = m_entities[lastIndex];
+            m_denseSlots[denseIndex] = m_denseSlots[lastIndex];
+            m_slots[m_denseSlots[denseIndex]].m_denseIndex = denseIndex;
+        }
+        m_entities.pop_back();
+        m_denseSlots.pop_back();
+        return true;
+    }
+
+    void EntitySlotMap::Clear()
+    {
+        AZ_Assert(m_enumerationDepth == 0, "Entities can't be cleared while they are enumerated.");
+        for (Entity* entity : m_entities)
+        {
+            if (entity)
+            {
+                entity->m_slotHandle = Handle{};
+            }
+        }
+
+        m_slots = {};
+        m_freeSlots = {};
+        m_entities = {};
+        m_denseSlots = {};
+        m_slotsById = {};
+    }
+
+    Entity* EntitySlotMap::Find(const EntityId& id) const
+    {
+        auto it = m_slotsById.find(id);
+        return it != m_slotsById.end() ? m_slots[it->second].m_entity : nullptr;
+    }
+
+    Entity* EntitySlotMap::Find(Handle handle) const
+    {
+        if (handle.m_index >= m_slots.size())
+        {
+            return nullptr;
+        }
+        const Slot& slot = m_slots[handle.m_index];
+        return slot.m_generation == handle.m_generation ? slot.m_entity : nullptr;
+    }
+
+    EntitySlotMap::Handle EntitySlotMap::GetHandle(const EntityId& id) const
+    {
+        auto it = m_slotsById.find(id);
+        if (it == m_slotsById.end())
+        {
+            return Handle{};
+        }
+        return Handle{ it->second, m_slots[it->second].m_generation };
+    }
+
+    Entity* EntitySlotMap::GetLast() const
+    {
+        AZ_Assert(m_enumerationDepth == 0, "The last entity can't be retrieved while the entities are enumerated.");
+        return m_entities.empty() ? nullptr : m_entities.back();
+    }
+
+    void EntitySlotMap::Compact()
+    {
+        u32 writeIndex = 0;
+        for (u32 readIndex = 0; readIndex < m_entities.size(); ++readIndex)
+        {
+            if (m_entities[readIndex])
+            {
+                m_entities[writeIndex] = m_entities[readIndex];
+                m_denseSlots[writeIndex] = m_denseSlots[readIndex];
+                m_slots[m_denseSlots[writeIndex]].m_denseIndex = writeIndex;
+                ++writeIndex;
+            }
+        }
+        m_entities.resize(writeIndex);
+        m_denseSlots.resize(writeIndex);
+    }
+} // namespace AZ
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class Entity;
+
+    //! Generational handle of an entity registered with the ComponentApplication, see Entity::GetSlotHandle().
+    //! Resolving a handle indexes the slot directly instead of looking up the entity id, and detects entities which were
+    //! removed since the handle was retrieved, even if their slot has been reused.
+    struct EntitySlotHandle
+    {
+        static constexpr u32 InvalidIndex = 0xFFFFFFFF;
+
+        bool IsValid() const
+        {
+            return m_index != InvalidIndex;
+        }
+
+        bool operator==(const EntitySlotHandle& rhs) const
+        {
+            return m_index == rhs.m_index && m_generation == rhs.m_generation;
+        }
+
+        bool operator!=(const EntitySlotHandle& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+        u32 m_index = InvalidIndex;
+        u32 m_generation = 0;
+    };
+
+    //! Generational slot map of the entities registered with the ComponentApplication.
+    //! The entities are kept in a dense array, so enumerating them doesn't walk hash buckets, and each one is given an
+    //! EntitySlotHandle, cached on the entity, which resolves in constant time. Slots are reused once their entity is removed,
+    //! the generation stored in the slot and in the handle detects handles to entities which were removed since.
+    class EntitySlotMap
+    {
+    public:
+        using Handle = EntitySlotHandle;
+
+        EntitySlotMap() = default;
+        EntitySlotMap(const EntitySlotMap&) = delete;
+        EntitySlotMap& operator=(const EntitySlotMap&) = delete;
+
+        //! Adds the entity and sets its slot handle, returns false if an entity with the same id was already added.
+        bool Insert(Entity* entity);
+
+        //! Removes the entity with the given id and resets its slot handle, returns false if there isn't one.
+        //! Handles to it become stale, their slot can be reused by the next inserted entity.
+        bool Remove(const EntityId& id);
+
+        //! Removes all entities and frees the memory used by the map.
+        void Clear();
+
+        //! Returns the entity with the given id, or null if there isn't one.
+        Entity* Find(const EntityId& id) const;
+
+        //! Returns the entity the handle refers to, or null if it was removed.
+        Entity* Find(Handle handle) const;
+
+        //! Returns the handle of the entity with the given id, or an invalid handle if there isn't one.
+        Handle GetHandle(const EntityId& id) const;
+
+        //! Calls callback(Entity*) for every entity.
+        //! The callback may add and remove entities. Added entities are visited as well, removed entities are skipped if
+        //! they weren't visited yet. Removals only leave an empty entry behind, the entities are compacted once the
+        //! outermost enumeration finishes.
+        template<typename Callback>
+        void Enumerate(const Callback& callback)
+        {
+            ++m_enumerationDepth;
+            for (size_t index = 0; index < m_entities.size(); ++index)
+            {
+                if (Entity* entity = m_entities[index])
+                {
+                    callback(entity);
+                }
+            }
+            if (--m_enumerationDepth == 0 && m_entities.size() != m_slotsById.size())
+            {
+                Compact();
+            }
+        }
+
+        //! Returns the most recently inserted entity, or null if there is none. Must not be called during an enumeration.
+        Entity* GetLast() const;
+
+        size_t size() const
+        {
+            return m_slotsById.size();
+        }
+
+        bool empty() const
+        {
+            return m_slotsById.empty();
+        }
+
+    private:
+        struct Slot
+        {
+            Entity* m_entity = nullptr; //!< Null when the slot is free.
+            u32 m_denseIndex = Handle::InvalidIndex; //!< Index in m_entities.
+            u32 m_generation = 0; //!< Incremented each time the slot is freed.
+        };
+
+        //! Removes the empty entries left by removals during an enumeration.
+        void Compact();
+
+        AZStd::vector<Slot> m_slots;
+        AZStd::vector<u32> m_freeSlots;
+
+        // Dense arrays, m_entities[i] lives in slot m_denseSlots[i]
+        AZStd::vector<Entity*> m_entities;
+        AZStd::vector<u32> m_denseSlots;
+
+        AZStd::unordered_map<EntityId, u32> m_slotsById;
+        u32 m_enumerationDepth = 0;
+    };
+} // namespace AZ
@@ -46,6 +46,9 @@ namespace AZ
         //! Overrides the default AZ::EBusTraits handler policy to allow one listener only.
         static const EBusHandlerPolicy HandlerPolicy = EBusHandlerPolicy::Single;
 
+        //! Every entity with a transform has an address on this bus, and it receives a lot of addressed events, so its addresses are stored densely.
+        static const EBusAddressPolicy AddressPolicy = EBusAddressPolicy::ByIdDense;
+
         //! Destroys the instance of the class.
         virtual ~TransformInterface() = default;
 
@@ -294,6 +297,9 @@ namespace AZ
     {
     public:
 
+        //! Every entity with a transform has an address on this bus, so its addresses are stored densely.
+        static const EBusAddressPolicy AddressPolicy = EBusAddressPolicy::ByIdDense;
+
         //! Destroys the instance of the class.
         virtual ~TransformNotification() {}
 
@@ -101,8 +101,8 @@ namespace AZ
 
         /**
          * The type of ID that is used to address the EBus.
-         * Used only when the #AddressPolicy is AZ::EBusAddressPolicy::ById
-         * or AZ::EBusAddressPolicy::ByIdAndOrdered.
+         * Used only when the #AddressPolicy is AZ::EBusAddressPolicy::ById,
+         * AZ::EBusAddressPolicy::ByIdAndOrdered or AZ::EBusAddressPolicy::ByIdDense.
          * The type must support `AZStd::hash<ID>` and
          * `bool operator==(const ID&, const ID&)`.
          */
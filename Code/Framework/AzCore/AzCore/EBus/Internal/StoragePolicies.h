@@ -12,6 +12,8 @@
 #include <AzCore/EBus/Internal/Debug.h>
 
 #include <AzCore/std/hash_table.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/iterator.h>
 #include <AzCore/std/containers/rbtree.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
@@ -124,6 +126,289 @@ namespace AZ
             };
         };
 
+        // Dense
+        template <typename Traits, typename HandlerStorage>
+        struct AddressStoragePolicy<Traits, HandlerStorage, EBusAddressPolicy::ByIdDense>
+        {
+        private:
+            using IdType = typename Traits::BusIdType;
+            using allocator_type = typename Traits::AllocatorType;
+
+            static constexpr AZ::u32 InvalidSlot = 0xFFFFFFFF;
+            static constexpr size_t EndSlot = static_cast<size_t>(-1);
+            static constexpr size_t MinIndexSize = 16;
+
+            struct IndexEntry
+            {
+                IdType m_id{};
+                AZ::u32 m_slot = InvalidSlot;
+            };
+
+        public:
+            /**
+             * Holders are allocated individually so their address never changes, and are referenced from a dense array of slots.
+             * The index is an open addressing table with linear probing from id to slot, kept at most half full.
+             * Iterators refer to a slot number, so they stay valid when other addresses are added or removed during a dispatch.
+             */
+            class StorageType
+            {
+            public:
+                class iterator
+                {
+                public:
+                    using iterator_category = AZStd::bidirectional_iterator_tag;
+                    using value_type = HandlerStorage;
+                    using difference_type = AZStd::ptrdiff_t;
+                    using pointer = HandlerStorage*;
+                    using reference = HandlerStorage&;
+
+                    iterator(StorageType* storage, size_t slot)
+                        : m_storage(storage)
+                        , m_slot(slot)
+                    { }
+
+                    HandlerStorage& operator*() const { return *m_storage->m_slots[m_slot]; }
+                    HandlerStorage* operator->() const { return m_storage->m_slots[m_slot]; }
+
+                    iterator& operator++()
+                    {
+                        m_slot = m_storage->GetNextUsedSlot(m_slot + 1);
+                        return *this;
+                    }
+                    iterator operator++(int)
+                    {
+                        iterator result = *this;
+                        ++(*this);
+                        return result;
+                    }
+
+                    iterator& operator--()
+                    {
+                        m_slot = m_storage->GetPreviousUsedSlot(m_slot);
+                        return *this;
+                    }
+                    iterator operator--(int)
+                    {
+                        iterator result = *this;
+                        --(*this);
+                        return result;
+                    }
+
+                    bool operator==(const iterator& rhs) const { return m_slot == rhs.m_slot; }
+                    bool operator!=(const iterator& rhs) const { return m_slot != rhs.m_slot; }
+
+                private:
+                    StorageType* m_storage;
+                    size_t m_slot;
+                };
+
+                StorageType() = default;
+                StorageType(const StorageType&) = delete;
+                StorageType& operator=(const StorageType&) = delete;
+
+                ~StorageType()
+                {
+                    for (HandlerStorage* holder : m_slots)
+                    {
+                        if (holder)
+                        {
+                            DestroyHolder(holder);
+                        }
+                    }
+                }
+
+                using reverse_iterator = AZStd::reverse_iterator<iterator>;
+
+                iterator begin() { return iterator(this, GetNextUsedSlot(0)); }
+                iterator end() { return iterator(this, EndSlot); }
+                reverse_iterator rbegin() { return reverse_iterator(end()); }
+                reverse_iterator rend() { return reverse_iterator(begin()); }
+
+                iterator find(const IdType& id)
+                {
+                    if (!m_index.empty())
+                    {
+                        const size_t mask = m_index.size() - 1;
+                        for (size_t position = GetIndexPosition(id); m_index[position].m_slot != InvalidSlot; position = (position + 1) & mask)
+                        {
+                            if (m_index[position].m_id == id)
+                            {
+                                return iterator(this, m_index[position].m_slot);
+                            }
+                        }
+                    }
+                    return end();
+                }
+
+                // EBus extension: Assert on insert
+                template <typename... InputArgs>
+                iterator emplace(InputArgs&&... args)
+                {
+                    void* memory = m_allocator.allocate(sizeof(HandlerStorage), alignof(HandlerStorage));
+                    HandlerStorage* holder = new (memory) HandlerStorage(AZStd::forward<InputArgs>(args)...);
+
+                    if ((m_size + 1) * 2 > m_index.size())
+                    {
+                        Rehash(AZStd::max(MinIndexSize, m_index.size() * 2));
+                    }
+
+                    AZ::u32 slot;
+                    if (!m_freeSlots.empty())
+                    {
+                        slot = m_freeSlots.back();
+                        m_freeSlots.pop_back();
+                        m_slots[slot] = holder;
+                    }
+                    else
+                    {
+                        slot = static_cast<AZ::u32>(m_slots.size());
+                        m_slots.push_back(holder);
+                    }
+
+                    const bool inserted = InsertIndexEntry(holder->m_busId, slot);
+                    EBUS_ASSERT(inserted, "Internal error: Failed to insert");
+                    (void)inserted;
+                    ++m_size;
+                    return iterator(this, slot);
+                }
+
+                // The id may belong to the holder being erased, so it is only destroyed once the index no longer needs the id
+                void erase(const IdType& id)
+                {
+                    if (m_index.empty())
+                    {
+                        return;
+                    }
+
+                    const size_t mask = m_index.size() - 1;
+                    size_t hole = GetIndexPosition(id);
+                    while (m_index[hole].m_slot != InvalidSlot && !(m_index[hole].m_id == id))
+                    {
+                        hole = (hole + 1) & mask;
+                    }
+                    if (m_index[hole].m_slot == InvalidSlot)
+                    {
+                        return;
+                    }
+
+                    const AZ::u32 slot = m_index[hole].m_slot;
+                    HandlerStorage* holder = m_slots[slot];
+                    m_slots[slot] = nullptr;
+                    m_freeSlots.push_back(slot);
+
+                    // Backward shift deletion, move up the following entries which can't be found anymore past the hole
+                    for (size_t position = (hole + 1) & mask; m_index[position].m_slot != InvalidSlot; position = (position + 1) & mask)
+                    {
+                        const size_t home = GetIndexPosition(m_index[position].m_id);
+                        if (((position - home) & mask) >= ((position - hole) & mask))
+                        {
+                            m_index[hole] = m_index[position];
+                            hole = position;
+                        }
+                    }
+                    m_index[hole] = IndexEntry();
+                    --m_size;
+
+                    DestroyHolder(holder);
+
+                    // EBus extension: free all memory on final erase
+                    if (m_size == 0)
+                    {
+                        m_slots.clear();
+                        m_slots.shrink_to_fit();
+                        m_freeSlots.clear();
+                        m_freeSlots.shrink_to_fit();
+                        m_index.clear();
+                        m_index.shrink_to_fit();
+                    }
+                }
+
+                bool empty() const { return m_size == 0; }
+                size_t size() const { return m_size; }
+
+            private:
+                static size_t GetHash(const IdType& id)
+                {
+                    // Ids such as EntityId only differ in their upper bits, mix them into the lower bits selected by the mask
+                    AZ::u64 hash = static_cast<AZ::u64>(AZStd::hash<IdType>()(id));
+                    hash ^= hash >> 33;
+                    hash *= 0xff51afd7ed558ccdull;
+                    hash ^= hash >> 33;
+                    return static_cast<size_t>(hash);
+                }
+
+                size_t GetIndexPosition(const IdType& id) const
+                {
+                    return GetHash(id) & (m_index.size() - 1);
+                }
+
+                size_t GetNextUsedSlot(size_t slot) const
+                {
+                    for (; slot < m_slots.size(); ++slot)
+                    {
+                        if (m_slots[slot])
+                        {
+                            return slot;
+                        }
+                    }
+                    return EndSlot;
+                }
+
+                size_t GetPreviousUsedSlot(size_t slot) const
+                {
+                    for (slot = AZStd::min(slot, m_slots.size()); slot > 0; --slot)
+                    {
+                        if (m_slots[slot - 1])
+                        {
+                            return slot - 1;
+                        }
+                    }
+                    return EndSlot;
+                }
+
+                bool InsertIndexEntry(const IdType& id, AZ::u32 slot)
+                {
+                    const size_t mask = m_index.size() - 1;
+                    size_t position = GetIndexPosition(id);
+                    for (; m_index[position].m_slot != InvalidSlot; position = (position + 1) & mask)
+                    {
+                        if (m_index[position].m_id == id)
+                        {
+                            return false;
+                        }
+                    }
+                    m_index[position].m_id = id;
+                    m_index[position].m_slot = slot;
+                    return true;
+                }
+
+                void Rehash(size_t indexSize)
+                {
+                    m_index.clear();
+                    m_index.resize(indexSize);
+                    for (size_t slot = 0; slot < m_slots.size(); ++slot)
+                    {
+                        if (m_slots[slot])
+                        {
+                            InsertIndexEntry(m_slots[slot]->m_busId, static_cast<AZ::u32>(slot));
+                        }
+                    }
+                }
+
+                void DestroyHolder(HandlerStorage* holder)
+                {
+                    holder->~HandlerStorage();
+                    m_allocator.deallocate(holder, sizeof(HandlerStorage), alignof(HandlerStorage));
+                }
+
+                allocator_type m_allocator;
+                AZStd::vector<HandlerStorage*, allocator_type> m_slots;
+                AZStd::vector<AZ::u32, allocator_type> m_freeSlots;
+                AZStd::vector<IndexEntry, allocator_type> m_index;
+                size_t m_size = 0;
+            };
+        };
+
         /**
          * Helpers for substituting default compare implementation when BusHandlerCompareDefault is specified.
          */
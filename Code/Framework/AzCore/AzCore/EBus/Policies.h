@@ -55,6 +55,18 @@ namespace AZ
          * AZ::EBusTraits::BusIdOrderCompare.
          */
         ByIdAndOrdered,
+
+        /**
+         * The EBus has multiple addresses; the order in which addresses
+         * receive events is undefined.
+         * Behaves like ById, but the addresses are kept in a dense array
+         * of slots, found through an open addressing index from ID to slot.
+         * Addressed events probe a flat array instead of walking hash
+         * buckets, and broadcasts walk the slots in order. Meant for buses
+         * with many addresses receiving a lot of addressed events, such as
+         * buses addressed by entity ID.
+         */
+        ByIdDense,
     };
 
     /**
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Internal/BatchMath_simd.inl>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Transform.h>
+
+namespace AZ
+{
+    namespace BatchMath
+    {
+        namespace Internal
+        {
+            static void MultiplyTransforms(const Transform* lhs, const Transform* rhs, Transform* results, size_t count)
+            {
+                for (size_t index = 0; index < count; ++index)
+                {
+                    results[index] = lhs[index] * rhs[index];
+                }
+            }
+
+            static KernelTable SelectKernelTable()
+            {
+                const Simd::CpuFeatures& cpuFeatures = Simd::GetCpuFeatures();
+                if (cpuFeatures.m_avx2 && cpuFeatures.m_fma)
+                {
+                    if (const KernelTable* avx2KernelTable = GetAvx2KernelTable())
+                    {
+                        return *avx2KernelTable;
+                    }
+                }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+                return CreateKernelTable<Simd::Vec4>("SSE4", &MultiplyTransforms);
+#elif AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+                return CreateKernelTable<Simd::Vec4>("NEON", &MultiplyTransforms);
+#else
+                return CreateKernelTable<Simd::Vec4>("Scalar", &MultiplyTransforms);
+#endif
+            }
+
+            static const KernelTable& GetKernelTable()
+            {
+                static const KernelTable kernelTable = SelectKernelTable();
+                return kernelTable;
+            }
+
+            static size_t GetLaneEnd(const KernelTable& kernelTable, size_t count)
+            {
+                return count - (count % kernelTable.m_laneCount);
+            }
+
+            static Vector3 LoadVector3(ConstVector3Stream stream, size_t index)
+            {
+                return Vector3(stream.m_x[index], stream.m_y[index], stream.m_z[index]);
+            }
+
+            static void StoreVector3(Vector3Stream stream, size_t index, const Vector3& value)
+            {
+                stream.m_x[index] = value.GetX();
+                stream.m_y[index] = value.GetY();
+                stream.m_z[index] = value.GetZ();
+            }
+
+            static Quaternion LoadQuaternion(ConstQuaternionStream stream, size_t index)
+            {
+                return Quaternion(stream.m_x[index], stream.m_y[index], stream.m_z[index], stream.m_w[index]);
+            }
+        } // namespace Internal
+
+        const char* GetBackendName()
+        {
+            return Internal::GetKernelTable().m_name;
+        }
+
+        void TransformPoints(const Transform& transform, ConstVector3Stream points, Vector3Stream results, size_t count)
+        {
+            const Vector3 basisX = transform.GetBasisX();
+            const Vector3 basisY = transform.GetBasisY();
+            const Vector3 basisZ = transform.GetBasisZ();
+            const Vector3& translation = transform.GetTranslation();
+            const Internal::PointTransform pointTransform{ {
+                { basisX.GetX(), basisY.GetX(), basisZ.GetX(), translation.GetX() },
+                { basisX.GetY(), basisY.GetY(), basisZ.GetY(), translation.GetY() },
+                { basisX.GetZ(), basisY.GetZ(), basisZ.GetZ(), translation.GetZ() } } };
+
+            const Internal::KernelTable& kernelTable = Internal::GetKernelTable();
+            const size_t laneEnd = Internal::GetLaneEnd(kernelTable, count);
+            kernelTable.m_transformPoints(pointTransform, points, results, laneEnd);
+            for (size_t index = laneEnd; index < count; ++index)
+            {
+                Internal::StoreVector3(results, index, transform.TransformPoint(Internal::LoadVector3(points, index)));
+            }
+        }
+
+        void TransformPoints(ConstTransformStream transforms, ConstVector3Stream points, Vector3Stream results, size_t count)
+        {
+            const Internal::KernelTable& kernelTable = Internal::GetKernelTable();
+            const size_t laneEnd = Internal::GetLaneEnd(kernelTable, count);
+            kernelTable.m_transformPointStreams(transforms, points, results, laneEnd);
+            for (size_t index = laneEnd; index < count; ++index)
+            {
+                Transform transform = Transform::CreateFromQuaternionAndTranslation(
+                    Internal::LoadQuaternion(transforms.m_rotation, index), Internal::LoadVector3(transforms.m_translation, index));
+                transform.SetUniformScale(transforms.m_scale[index]);
+                Internal::StoreVector3(results, index, transform.TransformPoint(Internal::LoadVector3(points, index)));
+            }
+        }
+
+        void GetDistanceSq(const Vector3& point, ConstVector3Stream points, float* results, size_t count)
+        {
+            const float pointValues[3] = { point.GetX(), point.GetY(), point.GetZ() };
+
+            const Internal::KernelTable& kernelTable = Internal::GetKernelTable();
+            const size_t laneEnd = Internal::GetLaneEnd(kernelTable, count);
+            kernelTable.m_getDistanceSq(pointValues, points, results, laneEnd);
+            for (size_t index = laneEnd; index < count; ++index)
+            {
+                results[index] = point.GetDistanceSq(Internal::LoadVector3(points, index));
+            }
+        }
+
+        void Overlaps(const Frustum& frustum, ConstAabbStream aabbs, bool* results, size_t count)
+        {
+            Internal::FrustumPlanes frustumPlanes;
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                frustum.GetPlane(planeId).GetPlaneEquationCoefficients().StoreToFloat4(frustumPlanes.m_planes[planeId]);
+            }
+
+            const Internal::KernelTable& kernelTable = Internal::GetKernelTable();
+            const size_t laneEnd = Internal::GetLaneEnd(kernelTable, count);
+            kernelTable.m_overlaps(frustumPlanes, aabbs, results, laneEnd);
+            for (size_t index = laneEnd; index < count; ++index)
+            {
+                const Aabb aabb = Aabb::CreateFromMinMax(Internal::LoadVector3(aabbs.m_min, index), Internal::LoadVector3(aabbs.m_max, index));
+                results[index] = ShapeIntersection::Overlaps(frustum, aabb);
+            }
+        }
+
+        void Slerp(ConstQuaternionStream from, ConstQuaternionStream to, const float* t, QuaternionStream results, size_t count)
+        {
+            const Internal::KernelTable& kernelTable = Internal::GetKernelTable();
+            const size_t laneEnd = Internal::GetLaneEnd(kernelTable, count);
+            kernelTable.m_slerp(from, to, t, results, laneEnd);
+            for (size_t index = laneEnd; index < count; ++index)
+            {
+                const Quaternion result = Internal::LoadQuaternion(from, index).Slerp(Internal::LoadQuaternion(to, index), t[index]);
+                results.m_x[index] = result.GetX();
+                results.m_y[index] = result.GetY();
+                results.m_z[index] = result.GetZ();
+                results.m_w[index] = result.GetW();
+            }
+        }
+
+        void Multiply(const Matrix3x4* lhs, const Matrix3x4* rhs, Matrix3x4* results, size_t count)
+        {
+            static_assert(sizeof(Matrix3x4) == sizeof(Simd::Vec4::FloatType) * Matrix3x4::RowCount, "Matrix3x4 rows must be contiguous");
+            if (count > 0)
+            {
+                Internal::GetKernelTable().m_multiplyMatrix3x4(lhs->GetSimdValues(), rhs->GetSimdValues(), results->GetSimdValues(), count);
+            }
+        }
+
+        void Multiply(const Matrix4x4* lhs, const Matrix4x4* rhs, Matrix4x4* results, size_t count)
+        {
+            static_assert(sizeof(Matrix4x4) == sizeof(Simd::Vec4::FloatType) * Matrix4x4::RowCount, "Matrix4x4 rows must be contiguous");
+            if (count > 0)
+            {
+                Internal::GetKernelTable().m_multiplyMatrix4x4(lhs->GetSimdValues(), rhs->GetSimdValues(), results->GetSimdValues(), count);
+            }
+        }
+
+        void Multiply(const Transform* lhs, const Transform* rhs, Transform* results, size_t count)
+        {
+            Internal::GetKernelTable().m_multiplyTransforms(lhs, rhs, results, count);
+        }
+    } // namespace BatchMath
+} // namespace AZ
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    class Frustum;
+    class Matrix3x4;
+    class Matrix4x4;
+    class Transform;
+    class Vector3;
+
+    //! Math operations applied to whole streams of values stored in struct-of-arrays form.
+    //! Each operation processes as many values at once as the SIMD backend has lanes, instead of one Vector3 or Quaternion
+    //! using 3 or 4 lanes of a single register. The backend is selected once at startup for the running CPU.
+    //! Results match the corresponding scalar operations up to floating point rounding.
+    namespace BatchMath
+    {
+        //! Vector3 values stored as separate arrays of x, y and z components.
+        //! @{
+        struct ConstVector3Stream
+        {
+            const float* m_x = nullptr;
+            const float* m_y = nullptr;
+            const float* m_z = nullptr;
+        };
+
+        struct Vector3Stream
+        {
+            float* m_x = nullptr;
+            float* m_y = nullptr;
+            float* m_z = nullptr;
+        };
+        //! @}
+
+        //! Quaternion values stored as separate arrays of x, y, z and w components.
+        //! @{
+        struct ConstQuaternionStream
+        {
+            const float* m_x = nullptr;
+            const float* m_y = nullptr;
+            const float* m_z = nullptr;
+            const float* m_w = nullptr;
+        };
+
+        struct QuaternionStream
+        {
+            float* m_x = nullptr;
+            float* m_y = nullptr;
+            float* m_z = nullptr;
+            float* m_w = nullptr;
+        };
+        //! @}
+
+        //! Transform values stored as separate arrays for each component of their rotation, uniform scale and translation.
+        struct ConstTransformStream
+        {
+            ConstQuaternionStream m_rotation;
+            const float* m_scale = nullptr;
+            ConstVector3Stream m_translation;
+        };
+
+        //! Aabb values stored as separate arrays for each component of their min and max corners.
+        struct ConstAabbStream
+        {
+            ConstVector3Stream m_min;
+            ConstVector3Stream m_max;
+        };
+
+        //! Returns the name of the SIMD backend selected for the running CPU, such as "SSE4" or "AVX2".
+        const char* GetBackendName();
+
+        //! Transforms count points by a single transform, see Transform::TransformPoint.
+        //! The results may be written over the points.
+        void TransformPoints(const Transform& transform, ConstVector3Stream points, Vector3Stream results, size_t count);
+
+        //! Transforms each of count points by the transform at the same index, see Transform::TransformPoint.
+        //! The results may be written over the points.
+        void TransformPoints(ConstTransformStream transforms, ConstVector3Stream points, Vector3Stream results, size_t count);
+
+        //! Computes the squared distance from a point to each of count points, see Vector3::GetDistanceSq.
+        void GetDistanceSq(const Vector3& point, ConstVector3Stream points, float* results, size_t count);
+
+        //! Tests each of count Aabbs against a frustum, see ShapeIntersection::Overlaps(const Frustum&, const Aabb&).
+        void Overlaps(const Frustum& frustum, ConstAabbStream aabbs, bool* results, size_t count);
+
+        //! Spherically interpolates each of count pairs of quaternions by the factor at the same index, see Quaternion::Slerp.
+        //! The results may be written over either input.
+        void Slerp(ConstQuaternionStream from, ConstQuaternionStream to, const float* t, QuaternionStream results, size_t count);
+
+        //! Multiplies each of count pairs of matrices or transforms at the same index, see the corresponding operator*.
+        //! The results must not overlap either input.
+        //! @{
+        void Multiply(const Matrix3x4* lhs, const Matrix3x4* rhs, Matrix3x4* results, size_t count);
+        void Multiply(const Matrix4x4* lhs, const Matrix4x4* rhs, Matrix4x4* results, size_t count);
+        void Multiply(const Transform* lhs, const Transform* rhs, Transform* results, size_t count);
+        //! @}
+    } // namespace BatchMath
+} // namespace AZ
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// This file is compiled for AVX2 and FMA on the platforms which support them, see AZ_TRAIT_USE_PLATFORM_SIMD_AVX2.
+// Its kernels only run after BatchMath.cpp checked the running CPU, so nothing here may call the inline math functions
+// shared with the rest of AzCore, see BatchMath::Internal::Kernels.
+
+#include <AzCore/Math/Internal/BatchMath_simd.inl>
+#include <AzCore/Math/Transform.h>
+
+namespace AZ
+{
+    namespace BatchMath
+    {
+        namespace Internal
+        {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2
+            //! The layout of Transform, whose members can only be read through its inline functions.
+            struct TransformValues
+            {
+                float m_rotation[4];
+                float m_scale;
+                float m_padding[3];
+                float m_translation[4];
+            };
+            static_assert(offsetof(TransformValues, m_rotation) == TransformLayout::RotationOffset &&
+                offsetof(TransformValues, m_scale) == TransformLayout::ScaleOffset &&
+                offsetof(TransformValues, m_translation) == TransformLayout::TranslationOffset &&
+                sizeof(TransformValues) == sizeof(Transform), "TransformValues must match the layout of Transform");
+
+            //! Multiplies two transforms at once, one in each half of the 8 wide registers.
+            static void MultiplyTransformPair(
+                const TransformValues& lhs0, const TransformValues& lhs1,
+                const TransformValues& rhs0, const TransformValues& rhs1,
+                TransformValues& result0, TransformValues& result1)
+            {
+                using Simd::Vec8;
+                const Vec8::FloatType lhsRotation = Vec8::FromVec4(_mm_loadu_ps(lhs0.m_rotation), _mm_loadu_ps(lhs1.m_rotation));
+                const Vec8::FloatType rhsRotation = Vec8::FromVec4(_mm_loadu_ps(rhs0.m_rotation), _mm_loadu_ps(rhs1.m_rotation));
+                const Vec8::FloatType lhsScale = Vec8::FromVec4(_mm_set1_ps(lhs0.m_scale), _mm_set1_ps(lhs1.m_scale));
+                const Vec8::FloatType lhsTranslation = Vec8::FromVec4(_mm_loadu_ps(lhs0.m_translation), _mm_loadu_ps(lhs1.m_translation));
+                const Vec8::FloatType rhsTranslation = Vec8::FromVec4(_mm_loadu_ps(rhs0.m_translation), _mm_loadu_ps(rhs1.m_translation));
+                const float scale0 = lhs0.m_scale * rhs0.m_scale;
+                const float scale1 = lhs1.m_scale * rhs1.m_scale;
+
+                // Same as Transform::operator*, the translation is lhs.TransformPoint(rhs.translation)
+                const Vec8::FloatType rotation = Vec8::QuaternionMultiply(lhsRotation, rhsRotation);
+                const Vec8::FloatType translation =
+                    Vec8::Add(Vec8::QuaternionTransform(lhsRotation, Vec8::Mul(lhsScale, rhsTranslation)), lhsTranslation);
+
+                _mm_storeu_ps(result0.m_rotation, Vec8::ToVec4Low(rotation));
+                _mm_storeu_ps(result1.m_rotation, Vec8::ToVec4High(rotation));
+                result0.m_scale = scale0;
+                result1.m_scale = scale1;
+                _mm_storeu_ps(result0.m_translation, Vec8::ToVec4Low(translation));
+                _mm_storeu_ps(result1.m_translation, Vec8::ToVec4High(translation));
+            }
+
+            static void MultiplyTransforms(const Transform* lhs, const Transform* rhs, Transform* results, size_t count)
+            {
+                const TransformValues* lhsValues = reinterpret_cast<const TransformValues*>(lhs);
+                const TransformValues* rhsValues = reinterpret_cast<const TransformValues*>(rhs);
+                TransformValues* resultValues = reinterpret_cast<TransformValues*>(results);
+
+                size_t index = 0;
+                for (; index + 1 < count; index += 2)
+                {
+                    MultiplyTransformPair(
+                        lhsValues[index], lhsValues[index + 1], rhsValues[index], rhsValues[index + 1],
+                        resultValues[index], resultValues[index + 1]);
+                }
+
+                if (index < count)
+                {
+                    // The last transform of an odd count is multiplied in both halves
+                    MultiplyTransformPair(
+                        lhsValues[index], lhsValues[index], rhsValues[index], rhsValues[index],
+                        resultValues[index], resultValues[index]);
+                }
+            }
+
+            static constexpr KernelTable Avx2KernelTable = CreateKernelTable<Simd::Vec8>("AVX2", &MultiplyTransforms);
+
+            const KernelTable* GetAvx2KernelTable()
+            {
+                return &Avx2KernelTable;
+            }
+#else
+            const KernelTable* GetAvx2KernelTable()
+            {
+                return nullptr;
+            }
+#endif
+        } // namespace Internal
+    } // namespace BatchMath
+} // namespace AZ
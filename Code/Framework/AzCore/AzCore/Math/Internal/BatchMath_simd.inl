@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/SimdMath.h>
+
+namespace AZ
+{
+    namespace BatchMath
+    {
+        namespace Internal
+        {
+            //! A transform expanded to a scaled rotation matrix, each row holds the x, y or z basis components followed by the translation.
+            struct PointTransform
+            {
+                float m_rows[3][4];
+            };
+
+            //! The frustum planes, each holds the normal followed by the distance.
+            struct FrustumPlanes
+            {
+                float m_planes[Frustum::PlaneId::MAX][4];
+            };
+
+            //! Implements the batch operations for a SIMD vector type, each backend instantiates this for its widest vector type.
+            //! The stream kernels only process a whole number of ElementCount values, the values left over at the end of a
+            //! stream are handled by the scalar operations in BatchMath.cpp.
+            //! Backends compiled for instruction sets beyond the platform baseline instantiate this in their own translation unit,
+            //! so nothing here may call the inline scalar math functions, the linker could otherwise keep the copy compiled for
+            //! the wider instruction set and run it on CPUs without support for it.
+            template <typename VecType>
+            struct Kernels
+            {
+                using FloatType = typename VecType::FloatType;
+                static constexpr size_t LaneCount = VecType::ElementCount;
+
+                static void TransformPoints(const PointTransform& transform, ConstVector3Stream points, Vector3Stream results, size_t count)
+                {
+                    // Each point costs 9 multiply-adds per lane
+                    const FloatType m00 = VecType::Splat(transform.m_rows[0][0]);
+                    const FloatType m01 = VecType::Splat(transform.m_rows[0][1]);
+                    const FloatType m02 = VecType::Splat(transform.m_rows[0][2]);
+                    const FloatType tx = VecType::Splat(transform.m_rows[0][3]);
+                    const FloatType m10 = VecType::Splat(transform.m_rows[1][0]);
+                    const FloatType m11 = VecType::Splat(transform.m_rows[1][1]);
+                    const FloatType m12 = VecType::Splat(transform.m_rows[1][2]);
+                    const FloatType ty = VecType::Splat(transform.m_rows[1][3]);
+                    const FloatType m20 = VecType::Splat(transform.m_rows[2][0]);
+                    const FloatType m21 = VecType::Splat(transform.m_rows[2][1]);
+                    const FloatType m22 = VecType::Splat(transform.m_rows[2][2]);
+                    const FloatType tz = VecType::Splat(transform.m_rows[2][3]);
+
+                    for (size_t index = 0; index < count; index += LaneCount)
+                    {
+                        const FloatType x = VecType::LoadUnaligned(points.m_x + index);
+                        const FloatType y = VecType::LoadUnaligned(points.m_y + index);
+                        const FloatType z = VecType::LoadUnaligned(points.m_z + index);
+                        VecType::StoreUnaligned(results.m_x + index, VecType::Madd(m00, x, VecType::Madd(m01, y, VecType::Madd(m02, z, tx))));
+                        VecType::StoreUnaligned(results.m_y + index, VecType::Madd(m10, x, VecType::Madd(m11, y, VecType::Madd(m12, z, ty))));
+                        VecType::StoreUnaligned(results.m_z + index, VecType::Madd(m20, x, VecType::Madd(m21, y, VecType::Madd(m22, z, tz))));
+                    }
+                }
+
+                static void TransformPointStreams(ConstTransformStream transforms, ConstVector3Stream points, Vector3Stream results, size_t count)
+                {
+                    for (size_t index = 0; index < count; index += LaneCount)
+                    {
+                        const FloatType qx = VecType::LoadUnaligned(transforms.m_rotation.m_x + index);
+                        const FloatType qy = VecType::LoadUnaligned(transforms.m_rotation.m_y + index);
+                        const FloatType qz = VecType::LoadUnaligned(transforms.m_rotation.m_z + index);
+                        const FloatType qw = VecType::LoadUnaligned(transforms.m_rotation.m_w + index);
+                        const FloatType scale = VecType::LoadUnaligned(transforms.m_scale + index);
+
+                        const FloatType vx = VecType::Mul(scale, VecType::LoadUnaligned(points.m_x + index));
+                        const FloatType vy = VecType::Mul(scale, VecType::LoadUnaligned(points.m_y + index));
+                        const FloatType vz = VecType::Mul(scale, VecType::LoadUnaligned(points.m_z + index));
+
+                        // v' = v + w * t + cross(q, t), with t = 2 * cross(q, v)
+                        const FloatType two = VecType::Splat(2.0f);
+                        const FloatType cx = VecType::Mul(two, VecType::Sub(VecType::Mul(qy, vz), VecType::Mul(qz, vy)));
+                        const FloatType cy = VecType::Mul(two, VecType::Sub(VecType::Mul(qz, vx), VecType::Mul(qx, vz)));
+                        const FloatType cz = VecType::Mul(two, VecType::Sub(VecType::Mul(qx, vy), VecType::Mul(qy, vx)));
+
+                        const FloatType rx = VecType::Add(VecType::Madd(qw, cx, vx), VecType::Sub(VecType::Mul(qy, cz), VecType::Mul(qz, cy)));
+                        const FloatType ry = VecType::Add(VecType::Madd(qw, cy, vy), VecType::Sub(VecType::Mul(qz, cx), VecType::Mul(qx, cz)));
+                        const FloatType rz = VecType::Add(VecType::Madd(qw, cz, vz), VecType::Sub(VecType::Mul(qx, cy), VecType::Mul(qy, cx)));
+
+                        VecType::StoreUnaligned(results.m_x + index, VecType::Add(rx, VecType::LoadUnaligned(transforms.m_translation.m_x + index)));
+                        VecType::StoreUnaligned(results.m_y + index, VecType::Add(ry, VecType::LoadUnaligned(transforms.m_translation.m_y + index)));
+                        VecType::StoreUnaligned(results.m_z + index, VecType::Add(rz, VecType::LoadUnaligned(transforms.m_translation.m_z + index)));
+                    }
+                }
+
+                static void GetDistanceSq(const float* point, ConstVector3Stream points, float* results, size_t count)
+                {
+                    const FloatType px = VecType::Splat(point[0]);
+                    const FloatType py = VecType::Splat(point[1]);
+                    const FloatType pz = VecType::Splat(point[2]);
+
+                    for (size_t index = 0; index < count; index += LaneCount)
+                    {
+                        const FloatType dx = VecType::Sub(VecType::LoadUnaligned(points.m_x + index), px);
+                        const FloatType dy = VecType::Sub(VecType::LoadUnaligned(points.m_y + index), py);
+                        const FloatType dz = VecType::Sub(VecType::LoadUnaligned(points.m_z + index), pz);
+                        VecType::StoreUnaligned(results + index, VecType::Madd(dx, dx, VecType::Madd(dy, dy, VecType::Mul(dz, dz))));
+                    }
+                }
+
+                static void Overlaps(const FrustumPlanes& frustum, ConstAabbStream aabbs, bool* results, size_t count)
+                {
+                    struct CullPlane
+                    {
+                        FloatType m_normalX;
+                        FloatType m_normalY;
+                        FloatType m_normalZ;
+                        FloatType m_absNormalX;
+                        FloatType m_absNormalY;
+                        FloatType m_absNormalZ;
+                        FloatType m_distance;
+                    };
+
+                    CullPlane planes[Frustum::PlaneId::MAX];
+                    for (size_t planeIndex = 0; planeIndex < Frustum::PlaneId::MAX; ++planeIndex)
+                    {
+                        const float* plane = frustum.m_planes[planeIndex];
+                        const FloatType normalX = VecType::Splat(plane[0]);
+                        const FloatType normalY = VecType::Splat(plane[1]);
+                        const FloatType normalZ = VecType::Splat(plane[2]);
+                        planes[planeIndex] = CullPlane{
+                            normalX, normalY, normalZ, VecType::Abs(normalX), VecType::Abs(normalY), VecType::Abs(normalZ),
+                            VecType::Splat(plane[3]) };
+                    }
+
+                    const FloatType half = VecType::Splat(0.5f);
+                    for (size_t index = 0; index < count; index += LaneCount)
+                    {
+                        const FloatType minX = VecType::LoadUnaligned(aabbs.m_min.m_x + index);
+                        const FloatType minY = VecType::LoadUnaligned(aabbs.m_min.m_y + index);
+                        const FloatType minZ = VecType::LoadUnaligned(aabbs.m_min.m_z + index);
+                        const FloatType maxX = VecType::LoadUnaligned(aabbs.m_max.m_x + index);
+                        const FloatType maxY = VecType::LoadUnaligned(aabbs.m_max.m_y + index);
+                        const FloatType maxZ = VecType::LoadUnaligned(aabbs.m_max.m_z + index);
+
+                        // Like ShapeIntersection::Overlaps, the extents are computed with separate multiplies to avoid overflowing on huge boxes
+                        const FloatType centerX = VecType::Madd(maxX, half, VecType::Mul(minX, half));
+                        const FloatType centerY = VecType::Madd(maxY, half, VecType::Mul(minY, half));
+                        const FloatType centerZ = VecType::Madd(maxZ, half, VecType::Mul(minZ, half));
+                        const FloatType extentX = VecType::Sub(VecType::Mul(maxX, half), VecType::Mul(minX, half));
+                        const FloatType extentY = VecType::Sub(VecType::Mul(maxY, half), VecType::Mul(minY, half));
+                        const FloatType extentZ = VecType::Sub(VecType::Mul(maxZ, half), VecType::Mul(minZ, half));
+
+                        FloatType overlaps = VecType::CastToFloat(VecType::Splat(-1));
+                        for (const CullPlane& plane : planes)
+                        {
+                            const FloatType distance = VecType::Madd(plane.m_normalX, centerX,
+                                VecType::Madd(plane.m_normalY, centerY, VecType::Madd(plane.m_normalZ, centerZ, plane.m_distance)));
+                            const FloatType radius = VecType::Madd(plane.m_absNormalX, extentX,
+                                VecType::Madd(plane.m_absNormalY, extentY, VecType::Mul(plane.m_absNormalZ, extentZ)));
+                            overlaps = VecType::And(overlaps, VecType::CmpGt(VecType::Add(distance, radius), VecType::ZeroFloat()));
+                        }
+
+                        int32_t lanes[LaneCount];
+                        VecType::StoreUnaligned(lanes, VecType::CastToInt(overlaps));
+                        for (size_t lane = 0; lane < LaneCount; ++lane)
+                        {
+                            results[index + lane] = (lanes[lane] != 0);
+                        }
+                    }
+                }
+
+                static void Slerp(ConstQuaternionStream from, ConstQuaternionStream to, const float* t, QuaternionStream results, size_t count)
+                {
+                    const FloatType zero = VecType::ZeroFloat();
+                    const FloatType one = VecType::Splat(1.0f);
+                    const FloatType lerpThreshold = VecType::Splat(0.9999f);
+
+                    for (size_t index = 0; index < count; index += LaneCount)
+                    {
+                        const FloatType ax = VecType::LoadUnaligned(from.m_x + index);
+                        const FloatType ay = VecType::LoadUnaligned(from.m_y + index);
+                        const FloatType az = VecType::LoadUnaligned(from.m_z + index);
+                        const FloatType aw = VecType::LoadUnaligned(from.m_w + index);
+                        const FloatType bx = VecType::LoadUnaligned(to.m_x + index);
+                        const FloatType by = VecType::LoadUnaligned(to.m_y + index);
+                        const FloatType bz = VecType::LoadUnaligned(to.m_z + index);
+                        const FloatType bw = VecType::LoadUnaligned(to.m_w + index);
+                        const FloatType factor = VecType::LoadUnaligned(t + index);
+                        const FloatType oneMinusFactor = VecType::Sub(one, factor);
+
+                        const FloatType dot = VecType::Madd(ax, bx, VecType::Madd(ay, by, VecType::Madd(az, bz, VecType::Mul(aw, bw))));
+                        const FloatType cosom = VecType::Abs(dot);
+
+                        // Lanes too close to each other fall back to a lerp, like Quaternion::Slerp
+                        const FloatType omega = VecType::Acos(VecType::Min(cosom, one));
+                        const FloatType sinom = VecType::Div(one, VecType::Sin(omega));
+                        const FloatType useSlerp = VecType::CmpLt(cosom, lerpThreshold);
+                        FloatType scaleA = VecType::Select(VecType::Mul(VecType::Sin(VecType::Mul(oneMinusFactor, omega)), sinom), oneMinusFactor, useSlerp);
+                        const FloatType scaleB = VecType::Select(VecType::Mul(VecType::Sin(VecType::Mul(factor, omega)), sinom), factor, useSlerp);
+                        scaleA = VecType::Select(VecType::Sub(zero, scaleA), scaleA, VecType::CmpLt(dot, zero));
+
+                        VecType::StoreUnaligned(results.m_x + index, VecType::Madd(ax, scaleA, VecType::Mul(bx, scaleB)));
+                        VecType::StoreUnaligned(results.m_y + index, VecType::Madd(ay, scaleA, VecType::Mul(by, scaleB)));
+                        VecType::StoreUnaligned(results.m_z + index, VecType::Madd(az, scaleA, VecType::Mul(bz, scaleB)));
+                        VecType::StoreUnaligned(results.m_w + index, VecType::Madd(aw, scaleA, VecType::Mul(bw, scaleB)));
+                    }
+                }
+
+                //! The matrix kernels process all count matrices, which are passed as their rows stored one matrix after the other.
+                //! @{
+                static void MultiplyMatrix3x4(
+                    const Simd::Vec4::FloatType* lhs, const Simd::Vec4::FloatType* rhs, Simd::Vec4::FloatType* results, size_t count)
+                {
+                    for (size_t index = 0; index < count * 3; index += 3)
+                    {
+                        VecType::Mat3x4Multiply(lhs + index, rhs + index, results + index);
+                    }
+                }
+
+                static void MultiplyMatrix4x4(
+                    const Simd::Vec4::FloatType* lhs, const Simd::Vec4::FloatType* rhs, Simd::Vec4::FloatType* results, size_t count)
+                {
+                    for (size_t index = 0; index < count * 4; index += 4)
+                    {
+                        VecType::Mat4x4Multiply(lhs + index, rhs + index, results + index);
+                    }
+                }
+                //! @}
+            };
+
+            //! The entry points of one backend, the backend used by all batch operations is selected the first time one of them runs.
+            struct KernelTable
+            {
+                const char* m_name;
+                size_t m_laneCount;
+                void (*m_transformPoints)(const PointTransform&, ConstVector3Stream, Vector3Stream, size_t);
+                void (*m_transformPointStreams)(ConstTransformStream, ConstVector3Stream, Vector3Stream, size_t);
+                void (*m_getDistanceSq)(const float*, ConstVector3Stream, float*, size_t);
+                void (*m_overlaps)(const FrustumPlanes&, ConstAabbStream, bool*, size_t);
+                void (*m_slerp)(ConstQuaternionStream, ConstQuaternionStream, const float*, QuaternionStream, size_t);
+                void (*m_multiplyMatrix3x4)(const Simd::Vec4::FloatType*, const Simd::Vec4::FloatType*, Simd::Vec4::FloatType*, size_t);
+                void (*m_multiplyMatrix4x4)(const Simd::Vec4::FloatType*, const Simd::Vec4::FloatType*, Simd::Vec4::FloatType*, size_t);
+                void (*m_multiplyTransforms)(const Transform*, const Transform*, Transform*, size_t);
+            };
+
+            //! Transform products don't map onto Kernels, each backend provides its own.
+            template <typename VecType>
+            constexpr KernelTable CreateKernelTable(
+                const char* name, void (*multiplyTransforms)(const Transform*, const Transform*, Transform*, size_t))
+            {
+                return KernelTable{
+                    name,
+                    Kernels<VecType>::LaneCount,
+                    &Kernels<VecType>::TransformPoints,
+                    &Kernels<VecType>::TransformPointStreams,
+                    &Kernels<VecType>::GetDistanceSq,
+                    &Kernels<VecType>::Overlaps,
+                    &Kernels<VecType>::Slerp,
+                    &Kernels<VecType>::MultiplyMatrix3x4,
+                    &Kernels<VecType>::MultiplyMatrix4x4,
+                    multiplyTransforms };
+            }
+
+            //! Returns the AVX2 backend, or null if AzCore was built without it.
+            //! Must only be called once Simd::GetCpuFeatures() reported both AVX2 and FMA.
+            const KernelTable* GetAvx2KernelTable();
+        } // namespace Internal
+    } // namespace BatchMath
+} // namespace AZ
@@ -42,7 +42,15 @@ namespace AZ
             AZ_MATH_INLINE typename VecType::FloatType FastLoadConstant(const float* values)
             {
 #if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
-                return *(typename VecType::FloatType*)(values);
+                if constexpr (VecType::ElementCount > 4)
+                {
+                    // The constants hold 4 elements, wider types repeat them in each group of 4 elements
+                    return VecType::FromVec4(*(const __m128*)(values));
+                }
+                else
+                {
+                    return *(typename VecType::FloatType*)(values);
+                }
 #else
                 return VecType::LoadAligned(values);
 #endif
@@ -53,7 +61,14 @@ namespace AZ
             AZ_MATH_INLINE typename VecType::Int32Type FastLoadConstant(const int32_t* values)
             {
 #if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
-                return *(typename VecType::Int32Type*)(values);
+                if constexpr (VecType::ElementCount > 4)
+                {
+                    return VecType::FromVec4(*(const __m128i*)(values));
+                }
+                else
+                {
+                    return *(typename VecType::Int32Type*)(values);
+                }
 #else
                 return VecType::LoadAligned(values);
 #endif
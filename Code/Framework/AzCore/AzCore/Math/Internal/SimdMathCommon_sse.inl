@@ -522,8 +522,8 @@ namespace AZ
 
             AZ_MATH_INLINE __m128 Madd(__m128 mul1, __m128 mul2, __m128 add)
             {
-#if 0
-                return _mm_fmadd_ps(mul1, mul2, add); // Requires FMA CPUID
+#if AZ_TRAIT_USE_PLATFORM_SIMD_FMA
+                return _mm_fmadd_ps(mul1, mul2, add); // Only when the whole build targets AVX2, the SSE baseline can't assume FMA
 #else
                 return Add(Mul(mul1, mul2), add);
 #endif
@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Internal/SimdMathCommon_simd.inl>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        AZ_MATH_INLINE Vec8::FloatType Vec8::FromVec4(Vec4::FloatArgType value)
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(value), value, 1);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::FromVec4(Vec4::Int32ArgType value)
+        {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(value), value, 1);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::FromVec4(Vec4::FloatArgType low, Vec4::FloatArgType high)
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+        }
+
+
+        AZ_MATH_INLINE Vec4::FloatType Vec8::ToVec4Low(FloatArgType value)
+        {
+            return _mm256_castps256_ps128(value);
+        }
+
+
+        AZ_MATH_INLINE Vec4::FloatType Vec8::ToVec4High(FloatArgType value)
+        {
+            return _mm256_extractf128_ps(value, 1);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadAligned(const float* __restrict addr)
+        {
+            return _mm256_load_ps(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadAligned(const int32_t* __restrict addr)
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(addr));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::LoadUnaligned(const float* __restrict addr)
+        {
+            return _mm256_loadu_ps(addr);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr));
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm256_store_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm256_storeu_ps(addr, value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Splat(float value)
+        {
+            return _mm256_set1_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Splat(int32_t value)
+        {
+            return _mm256_set1_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_add_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_sub_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_mul_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return _mm256_fmadd_ps(mul1, mul2, add);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_div_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Abs(FloatArgType value)
+        {
+            return And(value, CastToFloat(Splat(0x7FFFFFFF)));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_add_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_sub_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Mul(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_mullo_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Not(FloatArgType value)
+        {
+            return _mm256_andnot_ps(value, CastToFloat(Splat(static_cast<int32_t>(0xFFFFFFFF))));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_and_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_andnot_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_or_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_xor_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Not(Int32ArgType value)
+        {
+            return _mm256_xor_si256(value, Splat(static_cast<int32_t>(0xFFFFFFFF)));
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_and_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::AndNot(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_andnot_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_or_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Xor(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_xor_si256(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Floor(FloatArgType value)
+        {
+            return _mm256_floor_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Ceil(FloatArgType value)
+        {
+            return _mm256_ceil_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Round(FloatArgType value)
+        {
+            return _mm256_round_ps(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Truncate(FloatArgType value)
+        {
+            return _mm256_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_min_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_max_ps(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return Max(min, Min(value, max));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_EQ_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_NEQ_UQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_GT_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_GE_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_LT_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_LE_OQ);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpeq_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpGt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpgt_epi32(arg1, arg2);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpLt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpgt_epi32(arg2, arg1);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return _mm256_blendv_ps(arg2, arg1, mask);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return _mm256_blendv_epi8(arg2, arg1, mask);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Reciprocal(FloatArgType value)
+        {
+            return Div(Splat(1.0f), value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ReciprocalEstimate(FloatArgType value)
+        {
+            return _mm256_rcp_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sqrt(FloatArgType value)
+        {
+            return _mm256_sqrt_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtEstimate(FloatArgType value)
+        {
+            return ReciprocalEstimate(SqrtInvEstimate(value));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtInv(FloatArgType value)
+        {
+            return Div(Splat(1.0f), Sqrt(value));
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::SqrtInvEstimate(FloatArgType value)
+        {
+            return _mm256_rsqrt_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Sin(FloatArgType value)
+        {
+            return Common::Sin<Vec8>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Cos(FloatArgType value)
+        {
+            return Common::Cos<Vec8>(value);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::SinCos(FloatArgType value, FloatType& sin, FloatType& cos)
+        {
+            Common::SinCos<Vec8>(value, sin, cos);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::Acos(FloatArgType value)
+        {
+            return Common::Acos<Vec8>(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::QuaternionMultiply(FloatArgType arg1, FloatArgType arg2)
+        {
+            // Same terms as Vec4::QuaternionMultiply, the permutes shuffle within each half
+            const FloatType flipWSign = FromVec4(_mm_load_ps(reinterpret_cast<const float*>(g_negateWMask)));
+            const FloatType val1 = _mm256_permute_ps(arg1, _MM_SHUFFLE(3, 0, 2, 1)); // arg1 y z x w
+            const FloatType val2 = _mm256_permute_ps(arg2, _MM_SHUFFLE(3, 1, 0, 2)); // arg2 z x y w
+            const FloatType val3 = _mm256_permute_ps(arg1, _MM_SHUFFLE(0, 1, 0, 2)); // arg1 z x y x
+            const FloatType val4 = _mm256_permute_ps(arg2, _MM_SHUFFLE(0, 0, 2, 1)); // arg2 y z x x
+            const FloatType val5 = _mm256_permute_ps(arg1, _MM_SHUFFLE(1, 3, 3, 3)); // arg1 w w w y
+            const FloatType val6 = _mm256_permute_ps(arg2, _MM_SHUFFLE(1, 2, 1, 0)); // arg2 x y z y
+            const FloatType val7 = _mm256_permute_ps(arg1, _MM_SHUFFLE(2, 2, 1, 0)); // arg1 x y z z
+            const FloatType val8 = _mm256_permute_ps(arg2, _MM_SHUFFLE(2, 3, 3, 3)); // arg2 w w w z
+            const FloatType partialOne = _mm256_fmsub_ps(val1, val2, Mul(val3, val4));
+            const FloatType partialTwo = Xor(Madd(val5, val6, Mul(val7, val8)), flipWSign);
+            return Add(partialOne, partialTwo);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::QuaternionTransform(FloatArgType quat, FloatArgType vec3)
+        {
+            // v' = v + w * t + cross(q, t), with t = 2 * cross(q, v)
+            // cross(a, b) is computed as (a * b.yzx - a.yzx * b).yzx
+            const FloatType quatYzx = _mm256_permute_ps(quat, _MM_SHUFFLE(3, 0, 2, 1));
+            const FloatType vecYzx = _mm256_permute_ps(vec3, _MM_SHUFFLE(3, 0, 2, 1));
+            const FloatType cross = _mm256_permute_ps(_mm256_fmsub_ps(quat, vecYzx, Mul(quatYzx, vec3)), _MM_SHUFFLE(3, 0, 2, 1));
+            const FloatType t = Add(cross, cross);
+            const FloatType tYzx = _mm256_permute_ps(t, _MM_SHUFFLE(3, 0, 2, 1));
+            const FloatType crossT = _mm256_permute_ps(_mm256_fmsub_ps(quat, tYzx, Mul(quatYzx, t)), _MM_SHUFFLE(3, 0, 2, 1));
+            const FloatType w = _mm256_permute_ps(quat, _MM_SHUFFLE(3, 3, 3, 3));
+            return Add(Madd(w, t, vec3), crossT);
+        }
+
+
+        AZ_MATH_INLINE void Vec8::Mat3x4Multiply(const Vec4::FloatType* __restrict rowsA, const Vec4::FloatType* __restrict rowsB, Vec4::FloatType* __restrict out)
+        {
+            const FloatType b0 = FromVec4(rowsB[0]);
+            const FloatType b1 = FromVec4(rowsB[1]);
+            const FloatType b2 = FromVec4(rowsB[2]);
+            const FloatType fourth = FromVec4(_mm_load_ps(g_vec0001));
+
+            const FloatType a01 = _mm256_loadu_ps(reinterpret_cast<const float*>(rowsA));
+            const FloatType out01 = Madd(_mm256_permute_ps(a01, _MM_SHUFFLE(3, 3, 3, 3)), fourth,
+                Madd(_mm256_permute_ps(a01, _MM_SHUFFLE(2, 2, 2, 2)), b2,
+                Madd(_mm256_permute_ps(a01, _MM_SHUFFLE(1, 1, 1, 1)), b1, Mul(_mm256_permute_ps(a01, _MM_SHUFFLE(0, 0, 0, 0)), b0))));
+            _mm256_storeu_ps(reinterpret_cast<float*>(out), out01);
+
+            const Vec4::FloatType a2 = rowsA[2];
+            out[2] = _mm_fmadd_ps(_mm_permute_ps(a2, _MM_SHUFFLE(3, 3, 3, 3)), ToVec4Low(fourth),
+                _mm_fmadd_ps(_mm_permute_ps(a2, _MM_SHUFFLE(2, 2, 2, 2)), rowsB[2],
+                _mm_fmadd_ps(_mm_permute_ps(a2, _MM_SHUFFLE(1, 1, 1, 1)), rowsB[1], _mm_mul_ps(_mm_permute_ps(a2, _MM_SHUFFLE(0, 0, 0, 0)), rowsB[0]))));
+        }
+
+
+        AZ_MATH_INLINE void Vec8::Mat4x4Multiply(const Vec4::FloatType* __restrict rowsA, const Vec4::FloatType* __restrict rowsB, Vec4::FloatType* __restrict out)
+        {
+            const FloatType b0 = FromVec4(rowsB[0]);
+            const FloatType b1 = FromVec4(rowsB[1]);
+            const FloatType b2 = FromVec4(rowsB[2]);
+            const FloatType b3 = FromVec4(rowsB[3]);
+
+            for (int32_t row = 0; row < 4; row += 2)
+            {
+                const FloatType a = _mm256_loadu_ps(reinterpret_cast<const float*>(rowsA + row));
+                const FloatType result = Madd(_mm256_permute_ps(a, _MM_SHUFFLE(3, 3, 3, 3)), b3,
+                    Madd(_mm256_permute_ps(a, _MM_SHUFFLE(2, 2, 2, 2)), b2,
+                    Madd(_mm256_permute_ps(a, _MM_SHUFFLE(1, 1, 1, 1)), b1, Mul(_mm256_permute_ps(a, _MM_SHUFFLE(0, 0, 0, 0)), b0))));
+                _mm256_storeu_ps(reinterpret_cast<float*>(out + row), result);
+            }
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ConvertToFloat(Int32ArgType value)
+        {
+            return _mm256_cvtepi32_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToInt(FloatArgType value)
+        {
+            return _mm256_cvttps_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToIntNearest(FloatArgType value)
+        {
+            return _mm256_cvtps_epi32(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::CastToFloat(Int32ArgType value)
+        {
+            return _mm256_castsi256_ps(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::CastToInt(FloatArgType value)
+        {
+            return _mm256_castps_si256(value);
+        }
+
+
+        AZ_MATH_INLINE Vec8::FloatType Vec8::ZeroFloat()
+        {
+            return _mm256_setzero_ps();
+        }
+
+
+        AZ_MATH_INLINE Vec8::Int32Type Vec8::ZeroInt()
+        {
+            return _mm256_setzero_si256();
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Internal/MathTypes.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   if defined(AZ_COMPILER_MSVC)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+namespace AZ
+{
+    namespace Simd
+    {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        static void GetCpuId(uint32_t leaf, uint32_t subleaf, uint32_t registers[4])
+        {
+#   if defined(AZ_COMPILER_MSVC)
+            int values[4];
+            __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (int index = 0; index < 4; ++index)
+            {
+                registers[index] = static_cast<uint32_t>(values[index]);
+            }
+#   else
+            if (!__get_cpuid_count(leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3]))
+            {
+                registers[0] = registers[1] = registers[2] = registers[3] = 0;
+            }
+#   endif
+        }
+
+        static uint64_t GetExtendedControlRegister()
+        {
+#   if defined(AZ_COMPILER_MSVC)
+            return _xgetbv(0);
+#   else
+            // The _xgetbv intrinsic requires compiling for XSAVE, which the SSE baseline doesn't
+            uint32_t low;
+            uint32_t high;
+            __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            return (static_cast<uint64_t>(high) << 32) | low;
+#   endif
+        }
+
+        static CpuFeatures DetectCpuFeatures()
+        {
+            CpuFeatures features;
+
+            uint32_t registers[4];
+            GetCpuId(0, 0, registers);
+            const uint32_t maxLeaf = registers[0];
+            if (maxLeaf < 7)
+            {
+                return features;
+            }
+
+            GetCpuId(1, 0, registers);
+            const bool fma = (registers[2] & (1u << 12)) != 0;
+            const bool osxsave = (registers[2] & (1u << 27)) != 0;
+            const bool avx = (registers[2] & (1u << 28)) != 0;
+
+            // The OS must also save the upper halves of the AVX registers on context switches
+            if (!osxsave || !avx || (GetExtendedControlRegister() & 0x6) != 0x6)
+            {
+                return features;
+            }
+
+            GetCpuId(7, 0, registers);
+            features.m_avx2 = (registers[1] & (1u << 5)) != 0;
+            features.m_fma = fma;
+            return features;
+        }
+#else
+        static CpuFeatures DetectCpuFeatures()
+        {
+            return CpuFeatures();
+        }
+#endif
+
+        const CpuFeatures& GetCpuFeatures()
+        {
+            static const CpuFeatures cpuFeatures = DetectCpuFeatures();
+            return cpuFeatures;
+        }
+    }
+}
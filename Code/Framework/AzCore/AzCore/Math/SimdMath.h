@@ -20,6 +20,26 @@
 #   endif
 #endif
 
+// AVX2 and FMA are not part of the baseline of any platform, Vec8 is only available in translation units compiled for them.
+// Code using Vec8 must only run after checking Simd::GetCpuFeatures(), see BatchMath for an example.
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE && defined(__AVX2__) && (defined(__FMA__) || defined(AZ_COMPILER_MSVC))
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 1
+#else
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+#endif
+
+// The inline math functions are compiled in every translation unit, so they only use FMA when the whole build targets AVX2
+// and FMA, see LY_BUILD_WITH_AVX2. Following the flags of each translation unit would give them different definitions.
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE && defined(AZ_BUILD_WITH_AVX2)
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_FMA 1
+#else
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_FMA 0
+#endif
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 || AZ_TRAIT_USE_PLATFORM_SIMD_FMA
+#   include <immintrin.h>
+#endif
+
 namespace AZ
 {
     namespace Simd
@@ -49,6 +69,23 @@ namespace AZ
 #include <AzCore/Math/SimdMathVec2.h>
 #include <AzCore/Math/SimdMathVec3.h>
 #include <AzCore/Math/SimdMathVec4.h>
+#include <AzCore/Math/SimdMathVec8.h>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        //! Instruction set extensions supported by the running CPU beyond the platform SIMD baseline.
+        struct CpuFeatures
+        {
+            bool m_avx2 = false;
+            bool m_fma = false;
+        };
+
+        //! Returns the extensions supported by the running CPU, they are detected the first time this is called.
+        const CpuFeatures& GetCpuFeatures();
+    }
+}
 
 namespace AZ
 {
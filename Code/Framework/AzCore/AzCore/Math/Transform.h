@@ -143,11 +143,28 @@ namespace AZ
 
     private:
 
+        friend struct TransformLayout;
+
         Quaternion m_rotation;
         float m_scale;
         Vector3 m_translation;
     };
 
+    //! Offsets of the Transform members, for code which reads arrays of transforms with wide loads, see BatchMath.
+    struct TransformLayout
+    {
+        static constexpr size_t RotationOffset = offsetof(Transform, m_rotation);
+        static constexpr size_t ScaleOffset = offsetof(Transform, m_scale);
+        static constexpr size_t TranslationOffset = offsetof(Transform, m_translation);
+    };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+    // The AVX2 batch math kernels read 4 rotation floats, the scale followed by 3 padding floats, and 4 translation floats
+    static_assert(TransformLayout::RotationOffset == 0 && TransformLayout::ScaleOffset == 4 * sizeof(float) &&
+        TransformLayout::TranslationOffset == 8 * sizeof(float) && sizeof(Transform) == 12 * sizeof(float),
+        "BatchMath_avx2.cpp relies on this layout of Transform");
+#endif
+
     extern const Transform g_transformIdentity;
 
     //! Non-member functionality belonging to the AZ namespace
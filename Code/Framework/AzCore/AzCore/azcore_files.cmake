@@ -44,6 +44,8 @@ set(FILES
     Component/ComponentBus.cpp
     Component/ComponentBus.h
     Component/ComponentExport.h
+    Component/DependencySortCache.cpp
+    Component/DependencySortCache.h
     Component/Entity.cpp
     Component/Entity.h
     Component/EntityBus.h
@@ -52,6 +54,8 @@ set(FILES
     Component/EntityIdSerializer.h
     Component/EntitySerializer.cpp
     Component/EntitySerializer.h
+    Component/EntitySlotMap.cpp
+    Component/EntitySlotMap.h
     Component/EntityUtils.cpp
     Component/EntityUtils.h
     Component/NamedEntityId.cpp
@@ -243,6 +247,9 @@ set(FILES
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
+    Math/BatchMath.cpp
+    Math/BatchMath.h
+    Math/BatchMath_avx2.cpp
     Math/Color.cpp
     Math/Color.h
     Math/Color.inl
@@ -258,6 +265,7 @@ set(FILES
     Math/Geometry2DUtils.cpp
     Math/Geometry2DUtils.h
     Math/Guid.h
+    Math/Internal/BatchMath_simd.inl
     Math/Internal/MathTypes.h
     Math/Internal/SimdMathVec1_neon.inl
     Math/Internal/SimdMathVec1_scalar.inl
@@ -271,6 +279,7 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -320,11 +329,13 @@ set(FILES
     Math/Sfmt.h
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
+    Math/SimdMath.cpp
     Math/SimdMath.h
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
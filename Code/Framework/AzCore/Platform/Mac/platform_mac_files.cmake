@@ -70,3 +70,10 @@ set(FILES
     ../Common/Apple/AzCore/Utils/Utils_Apple.cpp
     ../Common/UnixLike/AzCore/Utils/Utils_UnixLike.cpp
 )
+
+# The AVX2 batch math kernels are only selected at runtime on CPUs which support them
+ly_add_source_properties(
+    SOURCES AzCore/Math/BatchMath_avx2.cpp
+    PROPERTY COMPILE_OPTIONS
+    VALUES -mavx2 -mfma
+)
@@ -73,3 +73,10 @@ set(FILES
     ../Common/WinAPI/AzCore/Utils/Utils_WinAPI.cpp
     AzCore/Utils/Utils_Windows.cpp
 )
+
+# The AVX2 batch math kernels are only selected at runtime on CPUs which support them
+ly_add_source_properties(
+    SOURCES AzCore/Math/BatchMath_avx2.cpp
+    PROPERTY COMPILE_OPTIONS
+    VALUES /arch:AVX2
+)
@@ -213,6 +213,10 @@ EBUS_TEST_ALIAS(ManyToManyOrdered, ById, MultipleAndOrdered)
 EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
+// ByIdDense
+EBUS_TEST_ALIAS(ManyDenseToOne, ByIdDense, Single)
+EBUS_TEST_ALIAS(ManyDenseToMany, ByIdDense, Multiple)
+EBUS_TEST_ALIAS(ManyDenseToManyOrdered, ByIdDense, MultipleAndOrdered)
 
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
@@ -362,11 +366,13 @@ namespace UnitTest
 {
     using BusTypesId = ::testing::Types<
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyDenseToOne,   ManyDenseToMany,   ManyDenseToManyOrdered>;
     using BusTypesAll = ::testing::Types<
         OneToOne,         OneToMany,         OneToManyOrdered,
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyDenseToOne,   ManyDenseToMany,   ManyDenseToManyOrdered>;
 
     template <typename Bus>
     class EBusTestAll
@@ -564,7 +570,8 @@ namespace UnitTest
 
     using BusTypesIdMultiHandlers = ::testing::Types<
         ManyToMany, ManyToManyOrdered,
-        ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyDenseToMany, ManyDenseToManyOrdered>;
     template <typename Bus>
     class EBusTestIdMultiHandlers
         : public EBusTestAll<Bus>
@@ -4156,7 +4163,10 @@ namespace Benchmark
     cb(fn, ManyToManyOrdered, ManyToMany)        \
     cb(fn, ManyOrderedToOne, ManyToOne)          \
     cb(fn, ManyOrderedToMany, ManyToMany)        \
-    cb(fn, ManyOrderedToManyOrdered, ManyToMany)
+    cb(fn, ManyOrderedToManyOrdered, ManyToMany) \
+    cb(fn, ManyDenseToOne, ManyToOne)            \
+    cb(fn, ManyDenseToMany, ManyToMany)          \
+    cb(fn, ManyDenseToManyOrdered, ManyToMany)
 
 // Internal macro callback for listing all buses
 #define BUS_BENCHMARK_PRIVATE_LIST_ALL(cb, fn)  \
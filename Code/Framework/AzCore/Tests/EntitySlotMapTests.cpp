@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/EntitySlotMap.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+class EntitySlotMapTests
+    : public UnitTest::AllocatorsFixture
+{
+protected:
+    static AZStd::vector<AZ::Entity*> GetEntities(AZ::EntitySlotMap& slotMap)
+    {
+        AZStd::vector<AZ::Entity*> entities;
+        slotMap.Enumerate([&entities](AZ::Entity* entity) { entities.push_back(entity); });
+        return entities;
+    }
+};
+
+TEST_F(EntitySlotMapTests, Insert_NewEntity_IsFoundByIdAndHandle)
+{
+    AZ::Entity entity(AZ::EntityId(1));
+    AZ::EntitySlotMap slotMap;
+    EXPECT_TRUE(slotMap.Insert(&entity));
+
+    EXPECT_EQ(slotMap.Find(entity.GetId()), &entity);
+    const AZ::EntitySlotMap::Handle handle = slotMap.GetHandle(entity.GetId());
+    EXPECT_TRUE(handle.IsValid());
+    EXPECT_EQ(slotMap.Find(handle), &entity);
+    EXPECT_EQ(entity.GetSlotHandle(), handle);
+    EXPECT_EQ(slotMap.size(), 1u);
+
+    slotMap.Clear();
+}
+
+TEST_F(EntitySlotMapTests, Insert_SameIdTwice_ReturnsFalse)
+{
+    AZ::Entity entity(AZ::EntityId(1));
+    AZ::Entity duplicate(AZ::EntityId(1));
+    AZ::EntitySlotMap slotMap;
+    EXPECT_TRUE(slotMap.Insert(&entity));
+    EXPECT_FALSE(slotMap.Insert(&duplicate));
+    EXPECT_EQ(slotMap.Find(AZ::EntityId(1)), &entity);
+    EXPECT_EQ(slotMap.size(), 1u);
+
+    slotMap.Clear();
+}
+
+TEST_F(EntitySlotMapTests, Find_UnknownId_ReturnsNull)
+{
+    AZ::EntitySlotMap slotMap;
+    EXPECT_EQ(slotMap.Find(AZ::EntityId(1)), nullptr);
+    EXPECT_FALSE(slotMap.GetHandle(AZ::EntityId(1)).IsValid());
+    EXPECT_EQ(slotMap.Find(AZ::EntitySlotMap::Handle()), nullptr);
+}
+
+TEST_F(EntitySlotMapTests, Remove_Entity_HandleBecomesStale)
+{
+    AZ::Entity entity(AZ::EntityId(1));
+    AZ::Entity nextEntity(AZ::EntityId(2));
+    AZ::EntitySlotMap slotMap;
+    slotMap.Insert(&entity);
+    const AZ::EntitySlotMap::Handle handle = slotMap.GetHandle(entity.GetId());
+
+    EXPECT_TRUE(slotMap.Remove(entity.GetId()));
+    EXPECT_FALSE(slotMap.Remove(entity.GetId()));
+    EXPECT_EQ(slotMap.Find(entity.GetId()), nullptr);
+    EXPECT_EQ(slotMap.Find(handle), nullptr);
+    EXPECT_FALSE(entity.GetSlotHandle().IsValid());
+
+    // The slot is reused, but the old handle must not resolve to the new entity
+    slotMap.Insert(&nextEntity);
+    const AZ::EntitySlotMap::Handle nextHandle = slotMap.GetHandle(nextEntity.GetId());
+    EXPECT_EQ(nextHandle.m_index, handle.m_index);
+    EXPECT_NE(nextHandle, handle);
+    EXPECT_EQ(slotMap.Find(handle), nullptr);
+    EXPECT_EQ(slotMap.Find(nextHandle), &nextEntity);
+
+    slotMap.Clear();
+}
+
+TEST_F(EntitySlotMapTests, Remove_FromMiddle_KeepsOtherEntitiesDense)
+{
+    AZ::Entity first(AZ::EntityId(1));
+    AZ::Entity second(AZ::EntityId(2));
+    AZ::Entity third(AZ::EntityId(3));
+    AZ::EntitySlotMap slotMap;
+    slotMap.Insert(&first);
+    slotMap.Insert(&second);
+    slotMap.Insert(&third);
+    const AZ::EntitySlotMap::Handle secondHandle = slotMap.GetHandle(second.GetId());
+    const AZ::EntitySlotMap::Handle thirdHandle = slotMap.GetHandle(third.GetId());
+
+    slotMap.Remove(first.GetId());
+    EXPECT_THAT(GetEntities(slotMap), ::testing::UnorderedElementsAre(&second, &third));
+    EXPECT_EQ(slotMap.Find(secondHandle), &second);
+    EXPECT_EQ(slotMap.Find(thirdHandle), &third);
+    EXPECT_EQ(slotMap.Find(third.GetId()), &third);
+
+    slotMap.Clear();
+    EXPECT_TRUE(slotMap.empty());
+    EXPECT_EQ(slotMap.Find(secondHandle), nullptr);
+    EXPECT_FALSE(second.GetSlotHandle().IsValid());
+}
+
+TEST_F(EntitySlotMapTests, Enumerate_RemoveDuringEnumeration_VisitsRemainingEntities)
+{
+    AZ::Entity first(AZ::EntityId(1));
+    AZ::Entity second(AZ::EntityId(2));
+    AZ::Entity third(AZ::EntityId(3));
+    AZ::Entity fourth(AZ::EntityId(4));
+    AZ::EntitySlotMap slotMap;
+    slotMap.Insert(&first);
+    slotMap.Insert(&second);
+    slotMap.Insert(&third);
+    slotMap.Insert(&fourth);
+
+    // Removing the visited entity and one which wasn't visited yet must neither skip nor revisit the others
+    AZStd::vector<AZ::Entity*> visited;
+    slotMap.Enumerate(
+        [&](AZ::Entity* entity)
+        {
+            visited.push_back(entity);
+            if (entity == &first)
+            {
+                slotMap.Remove(first.GetId());
+                slotMap.Remove(third.GetId());
+            }
+        });
+    EXPECT_THAT(visited, ::testing::ElementsAre(&first, &second, &fourth));
+
+    EXPECT_EQ(slotMap.size(), 2u);
+    EXPECT_THAT(GetEntities(slotMap), ::testing::ElementsAre(&second, &fourth));
+    EXPECT_EQ(slotMap.Find(second.GetSlotHandle()), &second);
+    EXPECT_EQ(slotMap.Find(fourth.GetSlotHandle()), &fourth);
+    EXPECT_EQ(slotMap.Find(fourth.GetId()), &fourth);
+
+    // The dense entries were compacted, removing from the middle must still find the last entity
+    slotMap.Remove(second.GetId());
+    EXPECT_THAT(GetEntities(slotMap), ::testing::ElementsAre(&fourth));
+    EXPECT_EQ(slotMap.Find(fourth.GetSlotHandle()), &fourth);
+
+    slotMap.Clear();
+}
+
+TEST_F(EntitySlotMapTests, Enumerate_InsertDuringEnumeration_VisitsNewEntity)
+{
+    AZ::Entity first(AZ::EntityId(1));
+    AZ::Entity second(AZ::EntityId(2));
+    AZ::Entity added(AZ::EntityId(3));
+    AZ::EntitySlotMap slotMap;
+    slotMap.Insert(&first);
+    slotMap.Insert(&second);
+
+    // The entity added in the freed slot of the removed one is visited once
+    AZStd::vector<AZ::Entity*> visited;
+    slotMap.Enumerate(
+        [&](AZ::Entity* entity)
+        {
+            visited.push_back(entity);
+            if (entity == &first)
+            {
+                slotMap.Remove(first.GetId());
+                slotMap.Insert(&added);
+            }
+        });
+    EXPECT_THAT(visited, ::testing::ElementsAre(&first, &second, &added));
+
+    EXPECT_THAT(GetEntities(slotMap), ::testing::ElementsAre(&second, &added));
+    EXPECT_EQ(slotMap.Find(added.GetSlotHandle()), &added);
+    EXPECT_EQ(slotMap.Find(added.GetId()), &added);
+
+    slotMap.Clear();
+}
@@ -9,6 +9,7 @@
 
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/DependencySortCache.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Serialization/Utils.h>
 
@@ -438,6 +439,103 @@ namespace UnitTest
         }
     };
 
+    // Components with distinct types, used to test looking up components on entities with many of them.
+#define ENTITY_LOOKUP_TEST_COMPONENT(Index, Uuid)                       \
+    class LookupTestComponent##Index                                    \
+        : public AZ::Component                                          \
+    {                                                                   \
+    public:                                                             \
+        AZ_COMPONENT(LookupTestComponent##Index, Uuid);                 \
+        void Activate() override { }                                    \
+        void Deactivate() override { }                                  \
+        static void Reflect(AZ::ReflectContext*) { }                    \
+    };
+
+    ENTITY_LOOKUP_TEST_COMPONENT(0, "{68EC0CFC-673F-4730-AC3E-912D6D1FD67B}")
+    ENTITY_LOOKUP_TEST_COMPONENT(1, "{04EA55D5-2720-473E-8F40-E92052516E14}")
+    ENTITY_LOOKUP_TEST_COMPONENT(2, "{BF664081-A00B-417F-B931-260015C5C0BA}")
+    ENTITY_LOOKUP_TEST_COMPONENT(3, "{98AAEB94-74CB-446A-9205-C9817FAB9F9F}")
+    ENTITY_LOOKUP_TEST_COMPONENT(4, "{15A7978A-6C96-4CF8-BA9D-B448F3A40290}")
+    ENTITY_LOOKUP_TEST_COMPONENT(5, "{E03F2062-5488-4BFD-92C3-E9874971394E}")
+    ENTITY_LOOKUP_TEST_COMPONENT(6, "{0EF35170-FD0C-4BB9-924C-AAC9AAAEAC0F}")
+    ENTITY_LOOKUP_TEST_COMPONENT(7, "{04A09F7D-E7D6-432B-9011-3F779AD4AC8F}")
+    ENTITY_LOOKUP_TEST_COMPONENT(8, "{EF3560F5-2F83-4C42-9C22-4DA8ECCB53EF}")
+    ENTITY_LOOKUP_TEST_COMPONENT(9, "{9B9ED7C3-9DCF-4EF0-A58E-95F581059526}")
+    ENTITY_LOOKUP_TEST_COMPONENT(10, "{06E6FC5D-06C1-4BAF-9E81-A66260095284}")
+    ENTITY_LOOKUP_TEST_COMPONENT(11, "{7C1A7CD2-DB6D-4E0A-BE4E-83E818CCBC63}")
+    ENTITY_LOOKUP_TEST_COMPONENT(12, "{E5ED44CE-33B0-4CB5-9A6B-79CEE7530991}")
+    ENTITY_LOOKUP_TEST_COMPONENT(13, "{F176C240-522A-46C1-9836-295795FB3144}")
+    ENTITY_LOOKUP_TEST_COMPONENT(14, "{895FF7FC-C7FA-4DA1-90AB-4C89D88353FB}")
+    ENTITY_LOOKUP_TEST_COMPONENT(15, "{5E0E14F3-B560-47B8-9E45-7E42D95D9247}")
+    ENTITY_LOOKUP_TEST_COMPONENT(16, "{C89E8008-AAC5-45DE-AA05-3C55ED0F6140}")
+    ENTITY_LOOKUP_TEST_COMPONENT(17, "{A780428E-8890-4BEE-8C02-C3873DCBBBEB}")
+    ENTITY_LOOKUP_TEST_COMPONENT(18, "{01688E2C-B069-4425-BA7D-61CDC7AE0053}")
+    ENTITY_LOOKUP_TEST_COMPONENT(19, "{02A423F8-831D-4797-A412-711BC293BBF9}")
+    ENTITY_LOOKUP_TEST_COMPONENT(20, "{2E523796-CA34-4B9C-8A3C-E69D4543430B}")
+    ENTITY_LOOKUP_TEST_COMPONENT(21, "{03E79F02-4EFF-4F1C-AD0D-474CD31744C9}")
+    ENTITY_LOOKUP_TEST_COMPONENT(22, "{8540F5A9-E0EA-40EB-912E-78B65660A28D}")
+    ENTITY_LOOKUP_TEST_COMPONENT(23, "{FE7BA2C9-9656-4135-8B0F-F2091178474F}")
+
+#undef ENTITY_LOOKUP_TEST_COMPONENT
+
+    static void AddLookupTestComponents(AZ::Entity& entity)
+    {
+        entity.CreateComponent<LookupTestComponent0>();
+        entity.CreateComponent<LookupTestComponent1>();
+        entity.CreateComponent<LookupTestComponent2>();
+        entity.CreateComponent<LookupTestComponent3>();
+        entity.CreateComponent<LookupTestComponent4>();
+        entity.CreateComponent<LookupTestComponent5>();
+        entity.CreateComponent<LookupTestComponent6>();
+        entity.CreateComponent<LookupTestComponent7>();
+        entity.CreateComponent<LookupTestComponent8>();
+        entity.CreateComponent<LookupTestComponent9>();
+        entity.CreateComponent<LookupTestComponent10>();
+        entity.CreateComponent<LookupTestComponent11>();
+        entity.CreateComponent<LookupTestComponent12>();
+        entity.CreateComponent<LookupTestComponent13>();
+        entity.CreateComponent<LookupTestComponent14>();
+        entity.CreateComponent<LookupTestComponent15>();
+        entity.CreateComponent<LookupTestComponent16>();
+        entity.CreateComponent<LookupTestComponent17>();
+        entity.CreateComponent<LookupTestComponent18>();
+        entity.CreateComponent<LookupTestComponent19>();
+        entity.CreateComponent<LookupTestComponent20>();
+        entity.CreateComponent<LookupTestComponent21>();
+        entity.CreateComponent<LookupTestComponent22>();
+        entity.CreateComponent<LookupTestComponent23>();
+    }
+
+    static AZStd::vector<AZ::Uuid> GetLookupTestComponentTypes()
+    {
+        return {
+            azrtti_typeid<LookupTestComponent0>(),
+            azrtti_typeid<LookupTestComponent1>(),
+            azrtti_typeid<LookupTestComponent2>(),
+            azrtti_typeid<LookupTestComponent3>(),
+            azrtti_typeid<LookupTestComponent4>(),
+            azrtti_typeid<LookupTestComponent5>(),
+            azrtti_typeid<LookupTestComponent6>(),
+            azrtti_typeid<LookupTestComponent7>(),
+            azrtti_typeid<LookupTestComponent8>(),
+            azrtti_typeid<LookupTestComponent9>(),
+            azrtti_typeid<LookupTestComponent10>(),
+            azrtti_typeid<LookupTestComponent11>(),
+            azrtti_typeid<LookupTestComponent12>(),
+            azrtti_typeid<LookupTestComponent13>(),
+            azrtti_typeid<LookupTestComponent14>(),
+            azrtti_typeid<LookupTestComponent15>(),
+            azrtti_typeid<LookupTestComponent16>(),
+            azrtti_typeid<LookupTestComponent17>(),
+            azrtti_typeid<LookupTestComponent18>(),
+            azrtti_typeid<LookupTestComponent19>(),
+            azrtti_typeid<LookupTestComponent20>(),
+            azrtti_typeid<LookupTestComponent21>(),
+            azrtti_typeid<LookupTestComponent22>(),
+            azrtti_typeid<LookupTestComponent23>(),
+        };
+    }
+
     class EntityTests : public UnitTest::SerializeContextFixture
     {
         void SetUp() override
@@ -673,6 +771,89 @@ namespace UnitTest
         entity.EvaluateDependencies();
     }
 
+    TEST_F(EntityTests, DependencySortCache_SameComponentTypes_ReusesSortedOrder)
+    {
+        AZ::Entity entity1;
+        entity1.CreateComponent<SortOrderTestRequiresSecondAndThirdComponent>();
+        entity1.CreateComponent<SortOrderTestThirdComponent>();
+        entity1.CreateComponent<SortOrderTestNoService>();
+        entity1.CreateComponent<SortOrderTestSecondComponent>();
+        AZ::Entity::ComponentArrayType sortedComponents = entity1.GetComponents();
+        ASSERT_TRUE(AZ::Entity::DependencySort(sortedComponents).IsSuccess());
+
+        AZ::DependencySortCache sortCache;
+        sortCache.Store(entity1.GetComponents(), sortedComponents);
+        EXPECT_EQ(sortCache.size(), 1);
+
+        AZ::Entity entity2;
+        entity2.CreateComponent<SortOrderTestRequiresSecondAndThirdComponent>();
+        entity2.CreateComponent<SortOrderTestThirdComponent>();
+        entity2.CreateComponent<SortOrderTestNoService>();
+        entity2.CreateComponent<SortOrderTestSecondComponent>();
+        AZ::Entity::ComponentArrayType cachedComponents = entity2.GetComponents();
+        ASSERT_TRUE(sortCache.Apply(cachedComponents));
+        ASSERT_EQ(cachedComponents.size(), sortedComponents.size());
+        for (size_t i = 0; i < cachedComponents.size(); ++i)
+        {
+            EXPECT_EQ(cachedComponents[i]->RTTI_GetType(), sortedComponents[i]->RTTI_GetType());
+        }
+
+        // The order of the component types is part of the key
+        AZ::Entity entity3;
+        entity3.CreateComponent<SortOrderTestSecondComponent>();
+        entity3.CreateComponent<SortOrderTestThirdComponent>();
+        entity3.CreateComponent<SortOrderTestNoService>();
+        entity3.CreateComponent<SortOrderTestRequiresSecondAndThirdComponent>();
+        AZ::Entity::ComponentArrayType otherComponents = entity3.GetComponents();
+        EXPECT_FALSE(sortCache.Apply(otherComponents));
+        EXPECT_EQ(otherComponents, entity3.GetComponents());
+
+        sortCache.Clear();
+        EXPECT_EQ(sortCache.size(), 0);
+    }
+
+    TEST_F(EntityTests, DependencySortCache_DuplicateComponentTypes_MatchesDependencySort)
+    {
+        AZ::Entity entity1;
+        entity1.CreateComponent<SortOrderTestSecondComponent>()->SetId(1);
+        entity1.CreateComponent<SortOrderTestFirstComponent>()->SetId(2);
+        entity1.CreateComponent<SortOrderTestSecondComponent>()->SetId(3);
+        AZ::Entity::ComponentArrayType sortedComponents = entity1.GetComponents();
+        ASSERT_TRUE(AZ::Entity::DependencySort(sortedComponents).IsSuccess());
+
+        AZ::DependencySortCache sortCache;
+        sortCache.Store(entity1.GetComponents(), sortedComponents);
+
+        // Same types with the ids of the duplicates swapped, the cached order must still match a full sort
+        AZ::Entity entity2;
+        entity2.CreateComponent<SortOrderTestSecondComponent>()->SetId(3);
+        entity2.CreateComponent<SortOrderTestFirstComponent>()->SetId(2);
+        entity2.CreateComponent<SortOrderTestSecondComponent>()->SetId(1);
+        AZ::Entity::ComponentArrayType expectedComponents = entity2.GetComponents();
+        ASSERT_TRUE(AZ::Entity::DependencySort(expectedComponents).IsSuccess());
+        AZ::Entity::ComponentArrayType cachedComponents = entity2.GetComponents();
+        ASSERT_TRUE(sortCache.Apply(cachedComponents));
+        EXPECT_EQ(cachedComponents, expectedComponents);
+
+        sortCache.Clear();
+    }
+
+    TEST_F(EntityTests, DependencySortCache_InstanceDependentServices_IsNotCached)
+    {
+        AZ::Entity entity;
+        entity.CreateComponent<SortOrderTestSecondComponent>();
+        entity.CreateComponent<SortOrderTestComponentWrapper>(aznew SortOrderTestFirstComponent());
+        AZ::Entity::ComponentArrayType sortedComponents = entity.GetComponents();
+        ASSERT_TRUE(AZ::Entity::DependencySort(sortedComponents).IsSuccess());
+
+        AZ::DependencySortCache sortCache;
+        sortCache.Store(entity.GetComponents(), sortedComponents);
+        EXPECT_EQ(sortCache.size(), 0);
+
+        AZ::Entity::ComponentArrayType components = entity.GetComponents();
+        EXPECT_FALSE(sortCache.Apply(components));
+    }
+
     TEST_F(EntityTests, EntityIsMoveConstructed)
     {
         static_assert(!AZStd::is_copy_constructible<AZ::Entity>::value, "Entity is dangerous to copy construct.");
@@ -698,4 +879,93 @@ namespace UnitTest
             EXPECT_EQ(entity2.GetComponents().size(), 1);
         } // there will be a crash here if they go out of scope if they weren't properly moved.
     }
+
+    TEST_F(EntityTests, FindComponent_ManyComponentsInitialized_ReturnsFirstComponentOfEachType)
+    {
+        AZ::Entity entity;
+        AddLookupTestComponents(entity);
+        LookupTestComponent0* duplicateComponent = entity.CreateComponent<LookupTestComponent0>();
+        entity.Init();
+
+        const AZ::Entity::ComponentArrayType& components = entity.GetComponents();
+        const AZStd::vector<AZ::Uuid> componentTypes = GetLookupTestComponentTypes();
+        for (size_t typeIndex = 0; typeIndex < componentTypes.size(); ++typeIndex)
+        {
+            EXPECT_EQ(entity.FindComponent(componentTypes[typeIndex]), components[typeIndex]);
+        }
+        EXPECT_NE(entity.FindComponent<LookupTestComponent0>(), duplicateComponent);
+        EXPECT_EQ(entity.FindComponent<SortOrderTestFirstComponent>(), nullptr);
+    }
+
+    TEST_F(EntityTests, FindComponent_ComponentRemovedAfterInit_ReturnsNextComponentOfSameType)
+    {
+        AZ::Entity entity;
+        AddLookupTestComponents(entity);
+        LookupTestComponent0* duplicateComponent = entity.CreateComponent<LookupTestComponent0>();
+        entity.Init();
+
+        LookupTestComponent0* firstComponent = entity.FindComponent<LookupTestComponent0>();
+        ASSERT_NE(firstComponent, nullptr);
+        EXPECT_TRUE(entity.RemoveComponent(firstComponent));
+        delete firstComponent;
+        EXPECT_EQ(entity.FindComponent<LookupTestComponent0>(), duplicateComponent);
+
+        EXPECT_TRUE(entity.RemoveComponent(duplicateComponent));
+        delete duplicateComponent;
+        EXPECT_EQ(entity.FindComponent<LookupTestComponent0>(), nullptr);
+        EXPECT_NE(entity.FindComponent<LookupTestComponent1>(), nullptr);
+    }
 } // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class EntityFindComponentBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            m_entity = aznew AZ::Entity("FindComponentBenchmark");
+            UnitTest::AddLookupTestComponents(*m_entity);
+            m_componentTypes = UnitTest::GetLookupTestComponentTypes();
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            delete m_entity;
+            m_componentTypes = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void FindAllComponents(::benchmark::State& state)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (const AZ::Uuid& componentType : m_componentTypes)
+                {
+                    benchmark::DoNotOptimize(m_entity->FindComponent(componentType));
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * m_componentTypes.size());
+        }
+
+        AZ::Entity* m_entity = nullptr;
+        AZStd::vector<AZ::Uuid> m_componentTypes;
+    };
+
+    // The lookup table is only built once the entity is initialized, before that FindComponent() scans the components.
+    BENCHMARK_F(EntityFindComponentBenchmarkFixture, FindComponent_Scan)(benchmark::State& state)
+    {
+        FindAllComponents(state);
+    }
+
+    BENCHMARK_F(EntityFindComponentBenchmarkFixture, FindComponent_Lookup)(benchmark::State& state)
+    {
+        m_entity->Init();
+        FindAllComponents(state);
+    }
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <random>
+
+namespace Benchmark
+{
+    //! Each benchmark runs an operation over the same values stored as arrays of math types and as struct-of-arrays streams,
+    //! the *Scalar variants loop over the math types and the *Batch variants pass the streams to AZ::BatchMath.
+    class BM_MathBatch
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr size_t Count = 1000;
+
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> unitUnif(0.0f, 1.0f);
+
+            auto randomVector3 = [&unif, &rng]() { return AZ::Vector3(unif(rng), unif(rng), unif(rng)); };
+            auto randomQuaternion = [&unif, &rng]() { return AZ::Quaternion(unif(rng), unif(rng), unif(rng), unif(rng)).GetNormalized(); };
+
+            m_transform = AZ::Transform::CreateFromQuaternionAndTranslation(randomQuaternion(), randomVector3());
+            m_point = randomVector3();
+            m_frustum = AZ::Frustum(
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 1.f, 0.f), AZ::Vector3(0.f, -50.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, -1.f, 0.f), AZ::Vector3(0.f, 50.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(1.f, 0.f, 0.f), AZ::Vector3(-50.f, 0.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(-1.f, 0.f, 0.f), AZ::Vector3(50.f, 0.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, -1.f), AZ::Vector3(0.f, 0.f, 50.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, 1.f), AZ::Vector3(0.f, 0.f, -50.f)));
+
+            m_points.resize(Count);
+            m_transforms.resize(Count);
+            m_aabbs.resize(Count);
+            m_rotations.resize(Count);
+            m_targetRotations.resize(Count);
+            m_factors.resize(Count);
+            for (size_t index = 0; index < Count; ++index)
+            {
+                m_points[index] = randomVector3();
+                m_transforms[index] = AZ::Transform::CreateFromQuaternionAndTranslation(randomQuaternion(), randomVector3());
+                m_aabbs[index] = AZ::Aabb::CreateCenterHalfExtents(randomVector3(), randomVector3().GetAbs() * 0.1f);
+                m_rotations[index] = randomQuaternion();
+                m_targetRotations[index] = randomQuaternion();
+                m_factors[index] = unitUnif(rng);
+            }
+
+            m_pointStream.Resize(Count);
+            m_resultStream.Resize(Count);
+            m_translationStream.Resize(Count);
+            m_minStream.Resize(Count);
+            m_maxStream.Resize(Count);
+            m_rotationStream.Resize(Count);
+            m_sourceRotationStream.Resize(Count);
+            m_targetRotationStream.Resize(Count);
+            m_quaternionResultStream.Resize(Count);
+            m_scales.resize(Count);
+            m_floatResults.resize(Count);
+            for (size_t index = 0; index < Count; ++index)
+            {
+                m_pointStream.Set(index, m_points[index]);
+                m_translationStream.Set(index, m_transforms[index].GetTranslation());
+                m_scales[index] = m_transforms[index].GetUniformScale();
+                m_minStream.Set(index, m_aabbs[index].GetMin());
+                m_maxStream.Set(index, m_aabbs[index].GetMax());
+                m_rotationStream.Set(index, m_transforms[index].GetRotation());
+                m_sourceRotationStream.Set(index, m_rotations[index]);
+                m_targetRotationStream.Set(index, m_targetRotations[index]);
+            }
+        }
+
+        struct Vector3Array
+        {
+            void Resize(size_t count)
+            {
+                m_x.resize(count);
+                m_y.resize(count);
+                m_z.resize(count);
+            }
+
+            void Set(size_t index, const AZ::Vector3& value)
+            {
+                m_x[index] = value.GetX();
+                m_y[index] = value.GetY();
+                m_z[index] = value.GetZ();
+            }
+
+            AZ::BatchMath::ConstVector3Stream GetConstStream() const
+            {
+                return { m_x.data(), m_y.data(), m_z.data() };
+            }
+
+            AZ::BatchMath::Vector3Stream GetStream()
+            {
+                return { m_x.data(), m_y.data(), m_z.data() };
+            }
+
+            std::vector<float> m_x;
+            std::vector<float> m_y;
+            std::vector<float> m_z;
+        };
+
+        struct QuaternionArray
+        {
+            void Resize(size_t count)
+            {
+                m_x.resize(count);
+                m_y.resize(count);
+                m_z.resize(count);
+                m_w.resize(count);
+            }
+
+            void Set(size_t index, const AZ::Quaternion& value)
+            {
+                m_x[index] = value.GetX();
+                m_y[index] = value.GetY();
+                m_z[index] = value.GetZ();
+                m_w[index] = value.GetW();
+            }
+
+            AZ::BatchMath::ConstQuaternionStream GetConstStream() const
+            {
+                return { m_x.data(), m_y.data(), m_z.data(), m_w.data() };
+            }
+
+            AZ::BatchMath::QuaternionStream GetStream()
+            {
+                return { m_x.data(), m_y.data(), m_z.data(), m_w.data() };
+            }
+
+            std::vector<float> m_x;
+            std::vector<float> m_y;
+            std::vector<float> m_z;
+            std::vector<float> m_w;
+        };
+
+        AZ::Transform m_transform;
+        AZ::Vector3 m_point;
+        AZ::Frustum m_frustum;
+
+        // Array of math types
+        std::vector<AZ::Vector3> m_points;
+        std::vector<AZ::Transform> m_transforms;
+        std::vector<AZ::Aabb> m_aabbs;
+        std::vector<AZ::Quaternion> m_rotations;
+        std::vector<AZ::Quaternion> m_targetRotations;
+        std::vector<float> m_factors;
+
+        // Struct-of-arrays streams
+        Vector3Array m_pointStream;
+        Vector3Array m_resultStream;
+        Vector3Array m_translationStream;
+        Vector3Array m_minStream;
+        Vector3Array m_maxStream;
+        QuaternionArray m_rotationStream;
+        QuaternionArray m_sourceRotationStream;
+        QuaternionArray m_targetRotationStream;
+        QuaternionArray m_quaternionResultStream;
+        std::vector<float> m_scales;
+        std::vector<float> m_floatResults;
+        bool m_boolResults[Count];
+    };
+
+    BENCHMARK_F(BM_MathBatch, TransformPointsScalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (const AZ::Vector3& point : m_points)
+            {
+                AZ::Vector3 result = m_transform.TransformPoint(point);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPointsBatch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(m_transform, m_pointStream.GetConstStream(), m_resultStream.GetStream(), Count);
+            benchmark::DoNotOptimize(m_resultStream.m_x.data());
+            benchmark::ClobberMemory();
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPointStreamsScalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t index = 0; index < Count; ++index)
+            {
+                AZ::Vector3 result = m_transforms[index].TransformPoint(m_points[index]);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPointStreamsBatch)(benchmark::State& state)
+    {
+        const AZ::BatchMath::ConstTransformStream transforms{
+            m_rotationStream.GetConstStream(), m_scales.data(), m_translationStream.GetConstStream() };
+        for (auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(transforms, m_pointStream.GetConstStream(), m_resultStream.GetStream(), Count);
+            benchmark::DoNotOptimize(m_resultStream.m_x.data());
+            benchmark::ClobberMemory();
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, GetDistanceSqScalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (const AZ::Vector3& point : m_points)
+            {
+                float result = m_point.GetDistanceSq(point);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, GetDistanceSqBatch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::GetDistanceSq(m_point, m_pointStream.GetConstStream(), m_floatResults.data(), Count);
+            benchmark::DoNotOptimize(m_floatResults.data());
+            benchmark::ClobberMemory();
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsFrustumAabbScalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (const AZ::Aabb& aabb : m_aabbs)
+            {
+                bool result = AZ::ShapeIntersection::Overlaps(m_frustum, aabb);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsFrustumAabbBatch)(benchmark::State& state)
+    {
+        const AZ::BatchMath::ConstAabbStream aabbs{ m_minStream.GetConstStream(), m_maxStream.GetConstStream() };
+        for (auto _ : state)
+        {
+            AZ::BatchMath::Overlaps(m_frustum, aabbs, m_boolResults, Count);
+            benchmark::DoNotOptimize(m_boolResults);
+            benchmark::ClobberMemory();
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, SlerpScalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t index = 0; index < Count; ++index)
+            {
+                AZ::Quaternion result = m_rotations[index].Slerp(m_targetRotations[index], m_factors[index]);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+
+    BENCHMARK_F(BM_MathBatch, SlerpBatch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::Slerp(
+                m_sourceRotationStream.GetConstStream(), m_targetRotationStream.GetConstStream(), m_factors.data(),
+                m_quaternionResultStream.GetStream(), Count);
+            benchmark::DoNotOptimize(m_quaternionResultStream.m_x.data());
+            benchmark::ClobberMemory();
+        }
+    }
+} // namespace Benchmark
+
+#endif
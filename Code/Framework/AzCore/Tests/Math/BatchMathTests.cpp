@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/Transform.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <random>
+
+namespace UnitTest
+{
+    // Not a multiple of any SIMD width, so the scalar path handling the end of the streams is tested too
+    static constexpr size_t BatchTestCount = 103;
+
+    struct BatchTestVector3Array
+    {
+        explicit BatchTestVector3Array(size_t count)
+            : m_x(count)
+            , m_y(count)
+            , m_z(count)
+        {
+        }
+
+        void Set(size_t index, const AZ::Vector3& value)
+        {
+            m_x[index] = value.GetX();
+            m_y[index] = value.GetY();
+            m_z[index] = value.GetZ();
+        }
+
+        AZ::Vector3 Get(size_t index) const
+        {
+            return AZ::Vector3(m_x[index], m_y[index], m_z[index]);
+        }
+
+        AZ::BatchMath::ConstVector3Stream GetConstStream() const
+        {
+            return { m_x.data(), m_y.data(), m_z.data() };
+        }
+
+        AZ::BatchMath::Vector3Stream GetStream()
+        {
+            return { m_x.data(), m_y.data(), m_z.data() };
+        }
+
+        AZStd::vector<float> m_x;
+        AZStd::vector<float> m_y;
+        AZStd::vector<float> m_z;
+    };
+
+    struct BatchTestQuaternionArray
+    {
+        explicit BatchTestQuaternionArray(size_t count)
+            : m_x(count)
+            , m_y(count)
+            , m_z(count)
+            , m_w(count)
+        {
+        }
+
+        void Set(size_t index, const AZ::Quaternion& value)
+        {
+            m_x[index] = value.GetX();
+            m_y[index] = value.GetY();
+            m_z[index] = value.GetZ();
+            m_w[index] = value.GetW();
+        }
+
+        AZ::Quaternion Get(size_t index) const
+        {
+            return AZ::Quaternion(m_x[index], m_y[index], m_z[index], m_w[index]);
+        }
+
+        AZ::BatchMath::ConstQuaternionStream GetConstStream() const
+        {
+            return { m_x.data(), m_y.data(), m_z.data(), m_w.data() };
+        }
+
+        AZ::BatchMath::QuaternionStream GetStream()
+        {
+            return { m_x.data(), m_y.data(), m_z.data(), m_w.data() };
+        }
+
+        AZStd::vector<float> m_x;
+        AZStd::vector<float> m_y;
+        AZStd::vector<float> m_z;
+        AZStd::vector<float> m_w;
+    };
+
+    static AZ::Vector3 GetRandomVector3(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> unif(-10.0f, 10.0f);
+        return AZ::Vector3(unif(rng), unif(rng), unif(rng));
+    }
+
+    static AZ::Quaternion GetRandomQuaternion(std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+        return AZ::Quaternion(unif(rng), unif(rng), unif(rng), unif(rng)).GetNormalized();
+    }
+
+    template<size_t Count>
+    static void GetRandomFloats(std::mt19937& rng, float (&values)[Count])
+    {
+        std::uniform_real_distribution<float> unif(-10.0f, 10.0f);
+        for (float& value : values)
+        {
+            value = unif(rng);
+        }
+    }
+
+    TEST(MATH_BatchMath, GetBackendName_IsNotEmpty)
+    {
+        EXPECT_STRNE(AZ::BatchMath::GetBackendName(), "");
+    }
+
+    TEST(MATH_BatchMath, TransformPoints_SingleTransform_MatchesTransformPoint)
+    {
+        std::mt19937 rng(1);
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(GetRandomQuaternion(rng), GetRandomVector3(rng));
+        transform.SetUniformScale(2.5f);
+
+        BatchTestVector3Array points(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            points.Set(index, GetRandomVector3(rng));
+        }
+
+        BatchTestVector3Array results(BatchTestCount);
+        AZ::BatchMath::TransformPoints(transform, points.GetConstStream(), results.GetStream(), BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            EXPECT_THAT(results.Get(index), IsCloseTolerance(transform.TransformPoint(points.Get(index)), 1e-4f));
+        }
+
+        // Transforming in place gives the same results
+        AZ::BatchMath::TransformPoints(transform, points.GetConstStream(), points.GetStream(), BatchTestCount);
+        EXPECT_EQ(points.m_x, results.m_x);
+        EXPECT_EQ(points.m_y, results.m_y);
+        EXPECT_EQ(points.m_z, results.m_z);
+    }
+
+    TEST(MATH_BatchMath, TransformPoints_TransformStream_MatchesTransformPoint)
+    {
+        std::mt19937 rng(2);
+        std::uniform_real_distribution<float> scaleDistribution(0.1f, 3.0f);
+
+        BatchTestQuaternionArray rotations(BatchTestCount);
+        AZStd::vector<float> scales(BatchTestCount);
+        BatchTestVector3Array translations(BatchTestCount);
+        BatchTestVector3Array points(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            rotations.Set(index, GetRandomQuaternion(rng));
+            scales[index] = scaleDistribution(rng);
+            translations.Set(index, GetRandomVector3(rng));
+            points.Set(index, GetRandomVector3(rng));
+        }
+
+        const AZ::BatchMath::ConstTransformStream transforms{ rotations.GetConstStream(), scales.data(), translations.GetConstStream() };
+        BatchTestVector3Array results(BatchTestCount);
+        AZ::BatchMath::TransformPoints(transforms, points.GetConstStream(), results.GetStream(), BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(rotations.Get(index), translations.Get(index));
+            transform.SetUniformScale(scales[index]);
+            EXPECT_THAT(results.Get(index), IsCloseTolerance(transform.TransformPoint(points.Get(index)), 1e-4f));
+        }
+    }
+
+    TEST(MATH_BatchMath, GetDistanceSq_MatchesVector3GetDistanceSq)
+    {
+        std::mt19937 rng(3);
+        const AZ::Vector3 point = GetRandomVector3(rng);
+
+        BatchTestVector3Array points(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            points.Set(index, GetRandomVector3(rng));
+        }
+
+        AZStd::vector<float> results(BatchTestCount);
+        AZ::BatchMath::GetDistanceSq(point, points.GetConstStream(), results.data(), BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            EXPECT_NEAR(results[index], point.GetDistanceSq(points.Get(index)), 1e-3f);
+        }
+    }
+
+    TEST(MATH_BatchMath, Overlaps_FrustumAabbs_MatchesShapeIntersectionOverlaps)
+    {
+        AZ::Plane nearPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 1.f, 0.f), AZ::Vector3(0.f, -5.f, 0.f));
+        AZ::Plane farPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, -1.f, 0.f), AZ::Vector3(0.f, 5.f, 0.f));
+        AZ::Plane leftPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(1.f, 0.f, 0.f), AZ::Vector3(-5.f, 0.f, 0.f));
+        AZ::Plane rightPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(-1.f, 0.f, 0.f), AZ::Vector3(5.f, 0.f, 0.f));
+        AZ::Plane topPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, -1.f), AZ::Vector3(0.f, 0.f, 5.f));
+        AZ::Plane bottomPlane = AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, 1.f), AZ::Vector3(0.f, 0.f, -5.f));
+        AZ::Frustum frustum(nearPlane, farPlane, leftPlane, rightPlane, topPlane, bottomPlane);
+
+        std::mt19937 rng(4);
+        std::uniform_real_distribution<float> extentDistribution(0.0f, 3.0f);
+        BatchTestVector3Array mins(BatchTestCount);
+        BatchTestVector3Array maxs(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            const AZ::Vector3 min = GetRandomVector3(rng);
+            mins.Set(index, min);
+            maxs.Set(index, min + AZ::Vector3(extentDistribution(rng), extentDistribution(rng), extentDistribution(rng)));
+        }
+
+        // Boxes with infinite extents must not overflow
+        const size_t hugeIndex = BatchTestCount / 2;
+        mins.Set(hugeIndex, AZ::Vector3(-AZ::Constants::FloatMax));
+        maxs.Set(hugeIndex, AZ::Vector3(AZ::Constants::FloatMax));
+
+        AZStd::vector<bool> expected(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            expected[index] = AZ::ShapeIntersection::Overlaps(frustum, AZ::Aabb::CreateFromMinMax(mins.Get(index), maxs.Get(index)));
+        }
+        EXPECT_TRUE(expected[hugeIndex]);
+
+        bool results[BatchTestCount];
+        AZ::BatchMath::Overlaps(frustum, { mins.GetConstStream(), maxs.GetConstStream() }, results, BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            EXPECT_EQ(results[index], expected[index]);
+        }
+    }
+
+    TEST(MATH_BatchMath, Slerp_MatchesQuaternionSlerp)
+    {
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> factorDistribution(0.0f, 1.0f);
+
+        BatchTestQuaternionArray from(BatchTestCount);
+        BatchTestQuaternionArray to(BatchTestCount);
+        AZStd::vector<float> factors(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            const AZ::Quaternion rotation = GetRandomQuaternion(rng);
+            from.Set(index, rotation);
+
+            // Include nearly identical rotations, which are lerped, and rotations in opposite hemispheres
+            if (index % 7 == 0)
+            {
+                to.Set(index, rotation);
+            }
+            else if (index % 5 == 0)
+            {
+                to.Set(index, -GetRandomQuaternion(rng));
+            }
+            else
+            {
+                to.Set(index, GetRandomQuaternion(rng));
+            }
+            factors[index] = factorDistribution(rng);
+        }
+
+        BatchTestQuaternionArray results(BatchTestCount);
+        AZ::BatchMath::Slerp(from.GetConstStream(), to.GetConstStream(), factors.data(), results.GetStream(), BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            EXPECT_THAT(results.Get(index), IsCloseTolerance(from.Get(index).Slerp(to.Get(index), factors[index]), 1e-4f));
+        }
+    }
+
+    TEST(MATH_BatchMath, Multiply_Matrix3x4_MatchesOperatorMultiply)
+    {
+        std::mt19937 rng(6);
+
+        AZStd::vector<AZ::Matrix3x4> lhs(BatchTestCount);
+        AZStd::vector<AZ::Matrix3x4> rhs(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            float values[12];
+            GetRandomFloats(rng, values);
+            lhs[index] = AZ::Matrix3x4::CreateFromRowMajorFloat12(values);
+            GetRandomFloats(rng, values);
+            rhs[index] = AZ::Matrix3x4::CreateFromRowMajorFloat12(values);
+        }
+
+        AZStd::vector<AZ::Matrix3x4> results(BatchTestCount);
+        AZ::BatchMath::Multiply(lhs.data(), rhs.data(), results.data(), BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            EXPECT_THAT(results[index], IsCloseTolerance(lhs[index] * rhs[index], 1e-3f));
+        }
+    }
+
+    TEST(MATH_BatchMath, Multiply_Matrix4x4_MatchesOperatorMultiply)
+    {
+        std::mt19937 rng(7);
+
+        AZStd::vector<AZ::Matrix4x4> lhs(BatchTestCount);
+        AZStd::vector<AZ::Matrix4x4> rhs(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            float values[16];
+            GetRandomFloats(rng, values);
+            lhs[index] = AZ::Matrix4x4::CreateFromRowMajorFloat16(values);
+            GetRandomFloats(rng, values);
+            rhs[index] = AZ::Matrix4x4::CreateFromRowMajorFloat16(values);
+        }
+
+        AZStd::vector<AZ::Matrix4x4> results(BatchTestCount);
+        AZ::BatchMath::Multiply(lhs.data(), rhs.data(), results.data(), BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            EXPECT_THAT(results[index], IsCloseTolerance(lhs[index] * rhs[index], 1e-3f));
+        }
+    }
+
+    TEST(MATH_BatchMath, Multiply_Transform_MatchesOperatorMultiply)
+    {
+        std::mt19937 rng(8);
+        std::uniform_real_distribution<float> scaleDistribution(0.1f, 4.0f);
+
+        AZStd::vector<AZ::Transform> lhs(BatchTestCount);
+        AZStd::vector<AZ::Transform> rhs(BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            lhs[index] = AZ::Transform::CreateFromQuaternionAndTranslation(GetRandomQuaternion(rng), GetRandomVector3(rng));
+            lhs[index].SetUniformScale(scaleDistribution(rng));
+            rhs[index] = AZ::Transform::CreateFromQuaternionAndTranslation(GetRandomQuaternion(rng), GetRandomVector3(rng));
+            rhs[index].SetUniformScale(scaleDistribution(rng));
+        }
+
+        AZStd::vector<AZ::Transform> results(BatchTestCount);
+        AZ::BatchMath::Multiply(lhs.data(), rhs.data(), results.data(), BatchTestCount);
+        for (size_t index = 0; index < BatchTestCount; ++index)
+        {
+            EXPECT_THAT(results[index], IsCloseTolerance(lhs[index] * rhs[index], 1e-3f));
+        }
+    }
+} // namespace UnitTest
@@ -8,6 +8,7 @@
 
 #if defined(HAVE_BENCHMARK)
 
+#include <AzCore/Math/BatchMath.h>
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -40,6 +41,16 @@ namespace Benchmark
                 testData.v2 = AZ::Vector3(unif(rng), unif(rng), unif(rng));
                 return testData;
             });
+
+            // BatchMath::Multiply needs the matrices in contiguous arrays
+            m_lhsArray.resize(m_testDataArray.size());
+            m_rhsArray.resize(m_testDataArray.size());
+            m_resultArray.resize(m_testDataArray.size());
+            for (size_t index = 0; index < m_testDataArray.size(); ++index)
+            {
+                m_lhsArray[index] = m_testDataArray[index].m1;
+                m_rhsArray[index] = m_testDataArray[index].m2;
+            }
         }
 
         struct TestData
@@ -52,6 +63,9 @@ namespace Benchmark
         };
 
         std::vector<TestData> m_testDataArray;
+        std::vector<AZ::Matrix4x4> m_lhsArray;
+        std::vector<AZ::Matrix4x4> m_rhsArray;
+        std::vector<AZ::Matrix4x4> m_resultArray;
     };
 
     BENCHMARK_F(BM_MathMatrix4x4, CreateIdentity)(benchmark::State& state)
@@ -440,6 +454,16 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_F(BM_MathMatrix4x4, BatchMultiply)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::Multiply(m_lhsArray.data(), m_rhsArray.data(), m_resultArray.data(), m_resultArray.size());
+            benchmark::DoNotOptimize(m_resultArray.data());
+            benchmark::ClobberMemory();
+        }
+    }
+
     BENCHMARK_F(BM_MathMatrix4x4, OperatorMultiplyAssign)(benchmark::State& state)
     {
         for (auto _ : state)
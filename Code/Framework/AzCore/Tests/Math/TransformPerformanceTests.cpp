@@ -8,6 +8,7 @@
 
 #if defined(HAVE_BENCHMARK)
 
+#include <AzCore/Math/BatchMath.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector3.h>
@@ -50,6 +51,16 @@ namespace Benchmark
                 testData.index = distInt(rng) % 3;
                 return testData;
             });
+
+            // BatchMath::Multiply needs the transforms in contiguous arrays
+            m_lhsArray.resize(m_testDataArray.size());
+            m_rhsArray.resize(m_testDataArray.size());
+            m_resultArray.resize(m_testDataArray.size());
+            for (size_t index = 0; index < m_testDataArray.size(); ++index)
+            {
+                m_lhsArray[index] = m_testDataArray[index].t1;
+                m_rhsArray[index] = m_testDataArray[index].t2;
+            }
         }
 
         struct TestData
@@ -66,6 +77,9 @@ namespace Benchmark
         };
 
         std::vector<TestData> m_testDataArray;
+        std::vector<AZ::Transform> m_lhsArray;
+        std::vector<AZ::Transform> m_rhsArray;
+        std::vector<AZ::Transform> m_resultArray;
     };
 
     BENCHMARK_F(BM_MathTransform, CreateIdentity)(benchmark::State& state)
@@ -390,6 +404,16 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_F(BM_MathTransform, BatchMultiplyTransform)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::Multiply(m_lhsArray.data(), m_rhsArray.data(), m_resultArray.data(), m_resultArray.size());
+            benchmark::DoNotOptimize(m_resultArray.data());
+            benchmark::ClobberMemory();
+        }
+    }
+
     BENCHMARK_F(BM_MathTransform, OperatorMultiplyEqualsTransform)(benchmark::State& state)
     {
         for (auto _ : state)
@@ -31,6 +31,7 @@ set(FILES
     DLL.cpp
     EBus.cpp
     EntityIdTests.cpp
+    EntitySlotMapTests.cpp
     EntityTests.cpp
     EnumTests.cpp
     EventTests.cpp
@@ -127,6 +128,8 @@ set(FILES
     Serialization/Json/UnsupportedTypesSerializerTests.cpp
     Serialization/Json/UuidSerializerTests.cpp
     Math/AabbTests.cpp
+    Math/BatchMathPerformanceTests.cpp
+    Math/BatchMathTests.cpp
     Math/ColorTests.cpp
     Math/CrcTests.cpp
     Math/CrcTestsCompileTimeLiterals.h
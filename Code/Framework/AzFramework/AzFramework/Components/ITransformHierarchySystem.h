@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Batches the propagation of transform changes down entity hierarchies.
+    //! When batching is enabled, a TransformComponent whose parent moves does not recompute its world transform and notify
+    //! its own children immediately. It is queued instead, and all queued subtrees are recomputed together in one pass over
+    //! contiguous, hierarchy-sorted arrays, sending a single change notification per entity no matter how many times its
+    //! ancestors moved. Reading the world transform of a queued entity before the pass returns the last propagated value,
+    //! reads never modify the transform so they are safe to run concurrently. Modifying a queued transform brings it up to
+    //! date first.
+    class ITransformHierarchySystem
+    {
+    public:
+        AZ_RTTI(ITransformHierarchySystem, "{5C0F3B6E-2E7B-4D49-9A1D-6F4C1E8B2A73}");
+
+        static constexpr uint32_t InvalidNode = AZStd::numeric_limits<uint32_t>::max();
+
+        //! Returns whether transforms activated from now on take part in batched propagation.
+        virtual bool IsBatchingEnabled() const = 0;
+
+        //! Enables or disables batched propagation, pending updates are processed before batching is disabled.
+        //! @note Only transforms activated after batching is enabled take part in batched propagation.
+        virtual void SetBatchingEnabled(bool enabled) = 0;
+
+        //! Recomputes the world transforms of all queued subtrees and sends their change notifications.
+        //! @note During normal operation this is called every frame in OnTick but can
+        //! also be called explicitly (e.g. before a system reads the transforms of many entities).
+        virtual void ProcessTransformUpdates() = 0;
+
+        //! Methods used by TransformComponent to take part in batched propagation.
+        //! @{
+        virtual void RegisterTransform(TransformComponent& transform) = 0;
+        virtual void UnregisterTransform(TransformComponent& transform) = 0;
+        //! Updates the hierarchy after the parent interface of the transform changed.
+        virtual void OnTransformParentChanged(TransformComponent& transform) = 0;
+        //! Queues the transform for the next pass after its parent moved.
+        //! @return true if the update was deferred, false if the transform should update immediately.
+        virtual bool QueueTransformUpdate(TransformComponent& transform) = 0;
+        //! Brings the world transform up to date if the transform or one of its ancestors is queued.
+        //! Writes the world transforms of the queued ancestors too, so this must only be called before modifying the transform.
+        virtual void ResolveWorldTM(TransformComponent& transform) = 0;
+        //! @}
+
+    protected:
+        ~ITransformHierarchySystem() = default;
+    };
+} // namespace AzFramework
@@ -152,12 +152,23 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        ITransformHierarchySystem* hierarchySystem = AZ::Interface<ITransformHierarchySystem>::Get();
+        if (hierarchySystem && hierarchySystem->IsBatchingEnabled())
+        {
+            hierarchySystem->RegisterTransform(*this);
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
 
     void TransformComponent::Deactivate()
     {
+        if (m_hierarchySystem)
+        {
+            m_hierarchySystem->UnregisterTransform(*this);
+        }
+
         EBUS_EVENT_ID(m_parentId, AZ::TransformNotificationBus, OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -223,6 +234,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
+        ResolveWorldTM();
         AZ::Transform newWorldTransform = m_worldTM;
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
@@ -247,24 +259,28 @@ namespace AzFramework
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
+        ResolveWorldTM();
         const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
+        ResolveWorldTM();
         const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
+        ResolveWorldTM();
         const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
+        ResolveWorldTM();
         const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
@@ -325,6 +341,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldRotationQuaternion(const AZ::Quaternion& quaternion)
     {
+        ResolveWorldTM();
         AZ::Transform newWorldTransform = m_worldTM;
         newWorldTransform.SetRotation(quaternion);
         SetWorldTM(newWorldTransform);
@@ -500,7 +517,12 @@ namespace AzFramework
         AZ_Assert(parentEntity, "We expect to have a parent entity associated with the provided parent's entity Id.");
         if (parentEntity)
         {
+            ResolveWorldTM();
             m_parentTM = parentEntity->GetTransform();
+            if (m_hierarchySystem)
+            {
+                m_hierarchySystem->OnTransformParentChanged(*this);
+            }
 
             AZ_Warning("TransformComponent", !m_isStatic || m_parentTM->IsStaticTransform(),
                 "Entity '%s' %s has static transform, but parent has non-static transform. This may lead to unexpected movement.",
@@ -520,7 +542,12 @@ namespace AzFramework
     void TransformComponent::OnEntityDeactivated([[maybe_unused]] const AZ::EntityId& parentEntityId)
     {
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+        ResolveWorldTM();
         m_parentTM = nullptr;
+        if (m_hierarchySystem)
+        {
+            m_hierarchySystem->OnTransformParentChanged(*this);
+        }
         m_parentActive = false;
         ComputeLocalTM();
     }
@@ -557,7 +584,12 @@ namespace AzFramework
         }
         else
         {
+            ResolveWorldTM();
             m_parentTM = nullptr;
+            if (m_hierarchySystem)
+            {
+                m_hierarchySystem->OnTransformParentChanged(*this);
+            }
 
             if (isKeepWorldTM)
             {
@@ -598,12 +630,16 @@ namespace AzFramework
 
     void TransformComponent::SetLocalTMImpl(const AZ::Transform& tm)
     {
+        // Bring queued ancestors up to date first, the world transform is derived from the parent's.
+        ResolveWorldTM();
         m_localTM = tm;
         ComputeWorldTM();  // We can user dirty flags and compute it later on demand
     }
 
     void TransformComponent::SetWorldTMImpl(const AZ::Transform& tm)
     {
+        // Bring queued ancestors up to date first, the local transform is derived from the parent's.
+        ResolveWorldTM();
         m_worldTM = tm;
         ComputeLocalTM(); // We can user dirty flags and compute it later on demand
     }
@@ -614,6 +650,12 @@ namespace AzFramework
         // Ignore the event until we've already derived our local transform.
         if (m_parentTM)
         {
+            // When batched, the new world transform is computed and notified together with the rest of the hierarchy.
+            if (m_hierarchySystem && m_hierarchySystem->QueueTransformUpdate(*this))
+            {
+                return;
+            }
+
             m_worldTM = parentWorldTM * m_localTM;
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -656,6 +698,12 @@ namespace AzFramework
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
 
+    void TransformComponent::NotifyTransformChanged()
+    {
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+    }
+
     bool TransformComponent::AreMoveRequestsAllowed() const
     {
         // Don't allow static transform to be moved while entity is activated.
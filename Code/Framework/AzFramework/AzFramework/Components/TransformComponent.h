@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Components/ITransformHierarchySystem.h>
 
 namespace AzToolsFramework
 {
@@ -41,6 +42,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class TransformHierarchySystem;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -159,6 +161,19 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Brings m_worldTM up to date when a parent change is waiting for batched propagation.
+        //! Only called before the transform is modified, reads return the last propagated world transform.
+        void ResolveWorldTM()
+        {
+            if (m_hierarchySystem)
+            {
+                m_hierarchySystem->ResolveWorldTM(*this);
+            }
+        }
+
+        //! Notifies all interested parties of the current local and world transforms.
+        void NotifyTransformChanged();
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -185,5 +200,8 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+
+        ITransformHierarchySystem* m_hierarchySystem = nullptr; ///< Set while parent changes are propagated to this transform in batches.
+        uint32_t m_hierarchyNode = ITransformHierarchySystem::InvalidNode; ///< Node of this transform in m_hierarchySystem.
     };
 }   // namespace AZ
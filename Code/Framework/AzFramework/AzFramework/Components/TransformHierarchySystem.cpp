@@ -0,0 +1,459 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchySystem.h>
+#include <AzFramework/Components/TransformComponent.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    static void OnBatchTransformUpdatesChanged(const bool& batchTransformUpdates)
+    {
+        if (ITransformHierarchySystem* transformHierarchySystem = AZ::Interface<ITransformHierarchySystem>::Get())
+        {
+            transformHierarchySystem->SetBatchingEnabled(batchTransformUpdates);
+        }
+    }
+
+    AZ_CVAR(bool, bg_batchTransformUpdates, false, &OnBatchTransformUpdatesChanged, AZ::ConsoleFunctorFlags::Null,
+        "If true, parent transform changes are propagated to descendants in one batched pass per frame instead of immediately");
+
+    //! Approximate number of transforms recomputed by each job.
+    static constexpr size_t TransformsPerJob = 1024;
+
+    //! Notification handlers can move transforms that were already processed, which queues them again for another pass.
+    //! Bounds the passes of a single update so handlers that keep moving transforms can not stall the frame.
+    static constexpr uint32_t MaxPassesPerUpdate = 8;
+
+    TransformHierarchySystem::~TransformHierarchySystem()
+    {
+        AZ_Assert(!m_connected, "TransformHierarchySystem destroyed while still connected.");
+    }
+
+    void TransformHierarchySystem::Connect()
+    {
+        AZ::Interface<ITransformHierarchySystem>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+
+        m_batchingEnabled = bg_batchTransformUpdates;
+        m_connected = true;
+    }
+
+    void TransformHierarchySystem::Disconnect()
+    {
+        SetBatchingEnabled(false);
+        m_connected = false;
+
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<ITransformHierarchySystem>::Unregister(this);
+    }
+
+    bool TransformHierarchySystem::IsBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    void TransformHierarchySystem::SetBatchingEnabled(bool enabled)
+    {
+        AZ_Assert(!m_processing, "Batched transform updates can not be toggled while they are being processed.");
+        if (enabled == m_batchingEnabled)
+        {
+            return;
+        }
+
+        if (!enabled)
+        {
+            ProcessTransformUpdates();
+
+            // Registered transforms go back to immediate propagation.
+            for (HierarchyNode& node : m_nodes)
+            {
+                if (node.m_transform)
+                {
+                    node.m_transform->m_hierarchySystem = nullptr;
+                    node.m_transform->m_hierarchyNode = InvalidNode;
+                }
+            }
+            m_nodes.clear();
+            m_freeNodes.clear();
+            m_queuedNodes.clear();
+        }
+
+        m_batchingEnabled = enabled;
+    }
+
+    void TransformHierarchySystem::ProcessTransformUpdates()
+    {
+        if (m_processing || m_queuedNodes.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        m_processing = true;
+        for (uint32_t pass = 0; pass < MaxPassesPerUpdate && !m_queuedNodes.empty(); ++pass)
+        {
+            GatherBatch();
+            ComputeBatch();
+            ApplyBatch();
+        }
+        m_processing = false;
+    }
+
+    void TransformHierarchySystem::RegisterTransform(TransformComponent& transform)
+    {
+        AZ_Assert(transform.m_hierarchyNode == InvalidNode, "Transform is already registered with the transform hierarchy system.");
+
+        uint32_t nodeIndex = InvalidNode;
+        if (!m_freeNodes.empty())
+        {
+            nodeIndex = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            nodeIndex = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        m_nodes[nodeIndex].m_transform = &transform;
+        transform.m_hierarchySystem = this;
+        transform.m_hierarchyNode = nodeIndex;
+
+        OnTransformParentChanged(transform);
+    }
+
+    void TransformHierarchySystem::UnregisterTransform(TransformComponent& transform)
+    {
+        const uint32_t nodeIndex = transform.m_hierarchyNode;
+        if (nodeIndex == InvalidNode)
+        {
+            return;
+        }
+
+        // The children lose the node they may be queued behind, so bring them up to date and queue them as roots of their own.
+        ResolveWorldTM(transform);
+        const bool isStale = m_nodes[nodeIndex].m_queued || HasQueuedAncestor(nodeIndex);
+        for (uint32_t childIndex : m_nodes[nodeIndex].m_children)
+        {
+            HierarchyNode& child = m_nodes[childIndex];
+            if (isStale)
+            {
+                child.m_transform->m_worldTM = transform.m_worldTM * child.m_transform->m_localTM;
+                if (!child.m_queued)
+                {
+                    child.m_queued = true;
+                    m_queuedNodes.push_back(childIndex);
+                }
+            }
+            child.m_parent = InvalidNode;
+        }
+
+        UnlinkFromParent(nodeIndex);
+
+        HierarchyNode& node = m_nodes[nodeIndex];
+        node.m_children.clear();
+        node.m_transform = nullptr;
+        node.m_queued = false;
+        node.m_pendingNotification = false;
+        m_freeNodes.push_back(nodeIndex);
+
+        transform.m_hierarchySystem = nullptr;
+        transform.m_hierarchyNode = InvalidNode;
+    }
+
+    void TransformHierarchySystem::OnTransformParentChanged(TransformComponent& transform)
+    {
+        const uint32_t nodeIndex = transform.m_hierarchyNode;
+        if (nodeIndex == InvalidNode)
+        {
+            return;
+        }
+
+        // Only parents registered with this system are linked, any other parent makes the transform the root of its subtree.
+        uint32_t parentIndex = InvalidNode;
+        if (TransformComponent* parentTransform = azrtti_cast<TransformComponent*>(transform.m_parentTM))
+        {
+            if (parentTransform->m_hierarchySystem == this)
+            {
+                parentIndex = parentTransform->m_hierarchyNode;
+            }
+        }
+
+        if (m_nodes[nodeIndex].m_parent != parentIndex)
+        {
+            UnlinkFromParent(nodeIndex);
+            LinkToParent(nodeIndex, parentIndex);
+        }
+    }
+
+    bool TransformHierarchySystem::QueueTransformUpdate(TransformComponent& transform)
+    {
+        const uint32_t nodeIndex = transform.m_hierarchyNode;
+        if (!m_batchingEnabled || nodeIndex == InvalidNode)
+        {
+            return false;
+        }
+
+        HierarchyNode& node = m_nodes[nodeIndex];
+        if (node.m_pendingNotification && node.m_parent != InvalidNode && node.m_parent == m_notifyingNode)
+        {
+            // The pass being processed notifies this transform next, but a handler of the parent's notification may
+            // have moved the parent again, so recompute it from the parent's current world transform.
+            transform.m_worldTM = m_nodes[node.m_parent].m_transform->m_worldTM * transform.m_localTM;
+            return true;
+        }
+
+        if (!node.m_queued)
+        {
+            node.m_queued = true;
+            m_queuedNodes.push_back(nodeIndex);
+        }
+        return true;
+    }
+
+    void TransformHierarchySystem::ResolveWorldTM(TransformComponent& transform)
+    {
+        if (m_queuedNodes.empty() || transform.m_hierarchyNode == InvalidNode)
+        {
+            return;
+        }
+
+        // Find the topmost queued node between the transform and the root of its hierarchy.
+        uint32_t staleDepth = 0;
+        uint32_t depth = 0;
+        for (uint32_t nodeIndex = transform.m_hierarchyNode; nodeIndex != InvalidNode; nodeIndex = m_nodes[nodeIndex].m_parent)
+        {
+            ++depth;
+            if (m_nodes[nodeIndex].m_queued)
+            {
+                staleDepth = depth;
+            }
+        }
+
+        if (staleDepth > 0)
+        {
+            RecomputeWorldTM(transform.m_hierarchyNode, staleDepth);
+        }
+    }
+
+    void TransformHierarchySystem::RecomputeWorldTM(uint32_t nodeIndex, uint32_t depth)
+    {
+        TransformComponent* transform = m_nodes[nodeIndex].m_transform;
+        if (depth > 1)
+        {
+            const uint32_t parentIndex = m_nodes[nodeIndex].m_parent;
+            RecomputeWorldTM(parentIndex, depth - 1);
+            transform->m_worldTM = m_nodes[parentIndex].m_transform->m_worldTM * transform->m_localTM;
+        }
+        else if (transform->m_parentTM)
+        {
+            transform->m_worldTM = transform->m_parentTM->GetWorldTM() * transform->m_localTM;
+        }
+    }
+
+    void TransformHierarchySystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ProcessTransformUpdates();
+    }
+
+    int TransformHierarchySystem::GetTickOrder()
+    {
+        // After gameplay, animation and physics have moved their entities, before render data is gathered.
+        return AZ::TICK_ATTACHMENT;
+    }
+
+    void TransformHierarchySystem::LinkToParent(uint32_t nodeIndex, uint32_t parentIndex)
+    {
+        m_nodes[nodeIndex].m_parent = parentIndex;
+        if (parentIndex != InvalidNode)
+        {
+            m_nodes[parentIndex].m_children.push_back(nodeIndex);
+        }
+    }
+
+    void TransformHierarchySystem::UnlinkFromParent(uint32_t nodeIndex)
+    {
+        const uint32_t parentIndex = m_nodes[nodeIndex].m_parent;
+        if (parentIndex == InvalidNode)
+        {
+            return;
+        }
+
+        AZStd::vector<uint32_t>& siblings = m_nodes[parentIndex].m_children;
+        auto childIter = AZStd::find(siblings.begin(), siblings.end(), nodeIndex);
+        if (childIter != siblings.end())
+        {
+            *childIter = siblings.back();
+            siblings.pop_back();
+        }
+        m_nodes[nodeIndex].m_parent = InvalidNode;
+    }
+
+    bool TransformHierarchySystem::HasQueuedAncestor(uint32_t nodeIndex) const
+    {
+        for (uint32_t parentIndex = m_nodes[nodeIndex].m_parent; parentIndex != InvalidNode; parentIndex = m_nodes[parentIndex].m_parent)
+        {
+            if (m_nodes[parentIndex].m_queued)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TransformHierarchySystem::GatherBatch()
+    {
+        m_batchNodes.clear();
+        m_batchParents.clear();
+        m_batchLocalTMs.clear();
+        m_batchSegments.clear();
+
+        // Only the topmost queued nodes start a segment, queued nodes below them are part of their subtree.
+        m_batchRoots.clear();
+        for (uint32_t nodeIndex : m_queuedNodes)
+        {
+            const HierarchyNode& node = m_nodes[nodeIndex];
+            if (node.m_transform && node.m_queued && !HasQueuedAncestor(nodeIndex))
+            {
+                m_batchRoots.push_back(nodeIndex);
+            }
+        }
+        m_queuedNodes.clear();
+
+        auto addToBatch = [this](uint32_t nodeIndex, int32_t parentSlot, const AZ::Transform& localTM)
+        {
+            HierarchyNode& node = m_nodes[nodeIndex];
+            node.m_queued = false;
+            node.m_pendingNotification = true;
+            m_batchNodes.push_back(nodeIndex);
+            m_batchParents.push_back(parentSlot);
+            m_batchLocalTMs.push_back(localTM);
+        };
+
+        for (uint32_t rootIndex : m_batchRoots)
+        {
+            if (m_nodes[rootIndex].m_pendingNotification)
+            {
+                // Queued more than once.
+                continue;
+            }
+
+            BatchSegment& segment = m_batchSegments.emplace_back();
+            segment.m_begin = static_cast<uint32_t>(m_batchNodes.size());
+
+            // A root without a parent interface keeps its world transform, only its descendants are recomputed.
+            TransformComponent* rootTransform = m_nodes[rootIndex].m_transform;
+            if (rootTransform->m_parentTM)
+            {
+                segment.m_parentWorldTM = rootTransform->m_parentTM->GetWorldTM();
+                addToBatch(rootIndex, -1, rootTransform->m_localTM);
+            }
+            else
+            {
+                segment.m_parentWorldTM = AZ::Transform::CreateIdentity();
+                addToBatch(rootIndex, -1, rootTransform->m_worldTM);
+            }
+
+            // Breadth first, so every parent is ahead of its children in the batch arrays.
+            for (uint32_t slot = segment.m_begin; slot < m_batchNodes.size(); ++slot)
+            {
+                const uint32_t parentIndex = m_batchNodes[slot];
+                for (uint32_t childIndex : m_nodes[parentIndex].m_children)
+                {
+                    addToBatch(childIndex, static_cast<int32_t>(slot), m_nodes[childIndex].m_transform->m_localTM);
+                }
+            }
+
+            segment.m_end = static_cast<uint32_t>(m_batchNodes.size());
+        }
+
+        m_batchWorldTMs.resize(m_batchNodes.size());
+    }
+
+    void TransformHierarchySystem::ComputeSegments(size_t segmentBegin, size_t segmentEnd)
+    {
+        for (size_t segmentIndex = segmentBegin; segmentIndex < segmentEnd; ++segmentIndex)
+        {
+            const BatchSegment& segment = m_batchSegments[segmentIndex];
+            for (uint32_t slot = segment.m_begin; slot < segment.m_end; ++slot)
+            {
+                const int32_t parentSlot = m_batchParents[slot];
+                const AZ::Transform& parentWorldTM = (parentSlot < 0) ? segment.m_parentWorldTM : m_batchWorldTMs[parentSlot];
+                m_batchWorldTMs[slot] = parentWorldTM * m_batchLocalTMs[slot];
+            }
+        }
+    }
+
+    void TransformHierarchySystem::ComputeBatch()
+    {
+        // Segments are independent of each other, so they can be recomputed concurrently.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext == nullptr || m_batchSegments.size() < 2 || m_batchNodes.size() < ParallelBatchMinTransforms)
+        {
+            ComputeSegments(0, m_batchSegments.size());
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        size_t segmentBegin = 0;
+        size_t jobTransformCount = 0;
+        for (size_t segmentIndex = 0; segmentIndex < m_batchSegments.size(); ++segmentIndex)
+        {
+            jobTransformCount += m_batchSegments[segmentIndex].m_end - m_batchSegments[segmentIndex].m_begin;
+            const size_t segmentEnd = segmentIndex + 1;
+            if (jobTransformCount >= TransformsPerJob || segmentEnd == m_batchSegments.size())
+            {
+                AZ::Job* job = AZ::CreateJobFunction([this, segmentBegin, segmentEnd]()
+                {
+                    ComputeSegments(segmentBegin, segmentEnd);
+                }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+
+                segmentBegin = segmentEnd;
+                jobTransformCount = 0;
+            }
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    void TransformHierarchySystem::ApplyBatch()
+    {
+        // Write every recomputed transform back before sending any notification,
+        // handlers then read up to date world transforms anywhere in the batch.
+        for (size_t slot = 0; slot < m_batchNodes.size(); ++slot)
+        {
+            m_nodes[m_batchNodes[slot]].m_transform->m_worldTM = m_batchWorldTMs[slot];
+        }
+
+        for (uint32_t nodeIndex : m_batchNodes)
+        {
+            // Notification handlers may deactivate entities of the batch, which unregisters their transforms.
+            if (!m_nodes[nodeIndex].m_pendingNotification)
+            {
+                continue;
+            }
+
+            m_nodes[nodeIndex].m_pendingNotification = false;
+            m_notifyingNode = nodeIndex;
+            m_nodes[nodeIndex].m_transform->NotifyTransformChanged();
+        }
+        m_notifyingNode = InvalidNode;
+    }
+} // namespace AzFramework
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Components/ITransformHierarchySystem.h>
+
+namespace AzFramework
+{
+    //! Default implementation of ITransformHierarchySystem, owned by the game entity context.
+    class TransformHierarchySystem
+        : public ITransformHierarchySystem
+        , private AZ::TickBus::Handler
+    {
+    public:
+        //! Passes with at least this many transforms recompute their subtrees on the job system.
+        static constexpr size_t ParallelBatchMinTransforms = 4096;
+
+        TransformHierarchySystem() = default;
+        ~TransformHierarchySystem();
+
+        void Connect();
+        void Disconnect();
+
+        // ITransformHierarchySystem overrides ...
+        bool IsBatchingEnabled() const override;
+        void SetBatchingEnabled(bool enabled) override;
+        void ProcessTransformUpdates() override;
+        void RegisterTransform(TransformComponent& transform) override;
+        void UnregisterTransform(TransformComponent& transform) override;
+        void OnTransformParentChanged(TransformComponent& transform) override;
+        bool QueueTransformUpdate(TransformComponent& transform) override;
+        void ResolveWorldTM(TransformComponent& transform) override;
+
+    private:
+        struct HierarchyNode
+        {
+            TransformComponent* m_transform = nullptr;
+            uint32_t m_parent = InvalidNode;
+            AZStd::vector<uint32_t> m_children;
+            bool m_queued = false; //!< The world transform of this node and its descendants is out of date.
+            bool m_pendingNotification = false; //!< The node is part of the pass being processed and has not been notified yet.
+        };
+
+        //! A subtree recomputed by a pass, stored in the batch arrays in the range [m_begin, m_end) with its root first.
+        struct BatchSegment
+        {
+            uint32_t m_begin = 0;
+            uint32_t m_end = 0;
+            AZ::Transform m_parentWorldTM = AZ::Transform::CreateIdentity();
+        };
+
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        void LinkToParent(uint32_t nodeIndex, uint32_t parentIndex);
+        void UnlinkFromParent(uint32_t nodeIndex);
+        bool HasQueuedAncestor(uint32_t nodeIndex) const;
+        //! Recomputes the world transform of a node and of the (depth - 1) ancestors above it, topmost first.
+        void RecomputeWorldTM(uint32_t nodeIndex, uint32_t depth);
+
+        //! Gathers the queued subtrees into the batch arrays, parents always ahead of their children.
+        void GatherBatch();
+        //! Recomputes the world transforms of a range of segments.
+        void ComputeSegments(size_t segmentBegin, size_t segmentEnd);
+        void ComputeBatch();
+        //! Writes the recomputed world transforms back to the components and sends their change notifications.
+        void ApplyBatch();
+
+        AZStd::vector<HierarchyNode> m_nodes;
+        AZStd::vector<uint32_t> m_freeNodes;
+        AZStd::vector<uint32_t> m_queuedNodes;
+
+        // Batch arrays, kept between passes to reuse their memory.
+        AZStd::vector<uint32_t> m_batchRoots;
+        AZStd::vector<uint32_t> m_batchNodes;
+        AZStd::vector<int32_t> m_batchParents; //!< Index of the parent in the batch arrays, negative for the root of a segment.
+        AZStd::vector<AZ::Transform> m_batchLocalTMs;
+        AZStd::vector<AZ::Transform> m_batchWorldTMs;
+        AZStd::vector<BatchSegment> m_batchSegments;
+
+        uint32_t m_notifyingNode = InvalidNode; //!< Node whose change notification is being sent by the pass being processed.
+        bool m_batchingEnabled = false;
+        bool m_connected = false;
+        bool m_processing = false;
+    };
+} // namespace AzFramework
@@ -87,6 +87,8 @@ namespace AzFramework
     {
         m_entityOwnershipService = AZStd::make_unique<SliceGameEntityOwnershipService>(GetContextId(), GetSerializeContext());
 
+        m_transformHierarchySystem.Connect();
+
         InitContext();
 
         GameEntityContextRequestBus::Handler::BusConnect();
@@ -106,6 +108,8 @@ namespace AzFramework
         DestroyContext();
 
         m_entityOwnershipService.reset();
+
+        m_transformHierarchySystem.Disconnect();
     }
 
     //=========================================================================
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Component/Component.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
@@ -97,6 +98,7 @@ namespace AzFramework
         /////////////////////////////////////////////////////////////////////////
 
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AzFramework::TransformHierarchySystem m_transformHierarchySystem;
     };
 } // namespace AzFramework
 
@@ -128,6 +128,14 @@ namespace AzPhysics
         //! @note There may be a performance penalty for enabling the Active Actor Notification.
         using OnSceneActiveSimulatedBodiesEvent = AZ::Event<AzPhysics::SceneHandle, const AzPhysics::SimulatedBodyHandleList&>;
 
+        //! Event triggers during the Scene::FinishSimulation call before the OnSceneSimulationFinishEvent for a scene,
+        //! once the entity transforms of all simulated bodies that moved during the step have been updated.
+        //! This will not trigger if the scene is not Enabled (Scene::IsEnabled() must return true to trigger).
+        //! When triggered, the event will send a handle of the Scene that triggered the event and a list of SimulatedBodyHandles whose entity transforms were updated.
+        //! Listeners that track many entities can use this to process all physics driven movement in one pass.
+        //! The SimulatedBodyHandleList is only valid for the duration of the callback.
+        using OnSceneTransformsUpdatedEvent = AZ::Event<AzPhysics::SceneHandle, const AzPhysics::SimulatedBodyHandleList&>;
+
         //! Event triggers with an ordered list of all the collision Begin/Persist/End events that happened during a single sub simulation step.
         //! When triggered the event will send a handle to the Scene that triggers the event and the list of collision events that occurred.
         //! @note The event will trigger at the end of the Scene::FinishSimulation call and only if collision events were generated and will be
@@ -138,6 +138,7 @@ namespace AzPhysics
         //! @param requestId A user defined value to identify the request when the callback is called.
         //! @param request The request to make. Should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @param callback The callback to trigger when the request is complete.
+        //! The request must remain valid until the callback is called. Callbacks are called when the scene finishes its next simulation.
         //! @return Returns If the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsync(SceneHandle sceneHandle, SceneQuery::AsyncRequestId requestId,
             const SceneQueryRequest* request, SceneQuery::AsyncCallback callback) = 0;
@@ -147,6 +148,7 @@ namespace AzPhysics
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @param callback The callback to trigger when all the request are complete.
+        //! Callbacks are called when the scene finishes its next simulation.
         //! @return Returns If the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsyncBatch(SceneHandle sceneHandle, SceneQuery::AsyncRequestId requestId,
             const SceneQueryRequests& requests, SceneQuery::AsyncBatchCallback callback) = 0;
@@ -225,6 +227,12 @@ namespace AzPhysics
         //! @param handler The handler to receive the event.
         virtual void RegisterSceneActiveSimulatedBodiesHandler(SceneHandle sceneHandle, SceneEvents::OnSceneActiveSimulatedBodiesEvent::Handler& handler) = 0;
 
+        //! Register a handler to receive an event with a list of SimulatedBodyHandles whose entity transforms were updated this scene tick.
+        //! @note This will fire before the OnSceneSimulationFinishEvent.
+        //! @param sceneHandle A handle to the scene to register the event with.
+        //! @param handler The handler to receive the event.
+        virtual void RegisterSceneTransformsUpdatedHandler(SceneHandle sceneHandle, SceneEvents::OnSceneTransformsUpdatedEvent::Handler& handler) = 0;
+
         //! Register a handler to receive all collision events in the scene.
         //! @param sceneHandle A handle to the scene to register the event with.
         //! @param handler The handler to receive the event.
@@ -348,6 +356,7 @@ namespace AzPhysics
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param request The request to make. Should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @param callback The callback to trigger when the request is complete.
+        //! The request must remain valid until the callback is called. Callbacks are called when the scene finishes its next simulation.
         //! @return Returns if the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsync(SceneQuery::AsyncRequestId requestId,
             const SceneQueryRequest* request, SceneQuery::AsyncCallback callback) = 0;
@@ -356,6 +365,7 @@ namespace AzPhysics
         //! @param requestId A user defined valid to identify the request when the callback is called.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @param callback The callback to trigger when all the request are complete.
+        //! Callbacks are called when the scene finishes its next simulation.
         //! @return Returns If the request was queued successfully. If returns false, the callback will never be called.
         [[nodiscard]] virtual bool QuerySceneAsyncBatch(SceneQuery::AsyncRequestId requestId,
             const SceneQueryRequests& requests, SceneQuery::AsyncBatchCallback callback) = 0;
@@ -426,6 +436,11 @@ namespace AzPhysics
         //! @param handler The handler to receive the event.
         void RegisterSceneActiveSimulatedBodiesHandler(SceneEvents::OnSceneActiveSimulatedBodiesEvent::Handler& handler);
 
+        //! Register a handler to receive an event with a list of SimulatedBodyHandles whose entity transforms were updated this scene tick.
+        //! @note This will fire before the OnSceneSimulationFinishEvent.
+        //! @param handler The handler to receive the event.
+        void RegisterSceneTransformsUpdatedHandler(SceneEvents::OnSceneTransformsUpdatedEvent::Handler& handler);
+
         //! Register a handler to receive all collision events in the scene.
         //! @param handler The handler to receive the event.
         void RegisterSceneCollisionEventHandler(SceneEvents::OnSceneCollisionsEvent::Handler& handler);
@@ -447,6 +462,7 @@ namespace AzPhysics
         SceneEvents::OnSceneSimulationStartEvent m_sceneSimuationStartEvent;
         SceneEvents::OnSceneSimulationFinishEvent m_sceneSimuationFinishEvent;
         SceneEvents::OnSceneActiveSimulatedBodiesEvent m_sceneActiveSimulatedBodies;
+        SceneEvents::OnSceneTransformsUpdatedEvent m_sceneTransformsUpdatedEvent;
         SceneEvents::OnSceneCollisionsEvent m_sceneCollisionEvent;
         SceneEvents::OnSceneTriggersEvent m_sceneTriggerEvent;
         SceneEvents::OnSceneGravityChangedEvent m_sceneGravityChangedEvent;
@@ -498,6 +514,11 @@ namespace AzPhysics
         handler.Connect(m_sceneActiveSimulatedBodies);
     }
 
+    inline void Scene::RegisterSceneTransformsUpdatedHandler(SceneEvents::OnSceneTransformsUpdatedEvent::Handler& handler)
+    {
+        handler.Connect(m_sceneTransformsUpdatedEvent);
+    }
+
     inline void Scene::RegisterSceneCollisionEventHandler(SceneEvents::OnSceneCollisionsEvent::Handler& handler)
     {
         handler.Connect(m_sceneCollisionEvent);
@@ -120,6 +120,12 @@ namespace Physics
         //! @param request Ray parameters in local space.
         virtual AzPhysics::SceneQueryHit RayCastLocal(const AzPhysics::RayCastRequest& localSpaceRequest) = 0;
 
+        //! Overlap test against this shape.
+        //! @param request Overlap parameters in world space.
+        //! @param worldTransform World transform of this shape.
+        //! @return true if the request's shape intersects this shape.
+        virtual bool Overlap(const AzPhysics::OverlapRequest& worldSpaceRequest, const AZ::Transform& worldTransform) = 0;
+
         //! Retrieve this shape AABB.
         //! @param worldTransform World transform of this shape.
         virtual AZ::Aabb GetAabb(const AZ::Transform& worldTransform) const = 0;
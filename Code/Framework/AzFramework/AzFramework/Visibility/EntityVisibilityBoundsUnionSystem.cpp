@@ -83,7 +83,7 @@ namespace AzFramework
         }
     }
 
-    void EntityVisibilityBoundsUnionSystem::UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    bool EntityVisibilityBoundsUnionSystem::UpdateWorldBoundsUnion(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
     {
         if (const auto& localEntityBoundsUnions = instance.m_localEntityBoundsUnion; localEntityBoundsUnions.IsValid())
         {
@@ -91,13 +91,22 @@ namespace AzFramework
             // there will be some wasted space but it should be sufficient for the visibility system
             AZ::TransformInterface* transformInterface = entity->GetTransform();
             const AZ::Aabb worldEntityBoundsUnion = localEntityBoundsUnions.GetTransformedAabb(transformInterface->GetWorldTM());
-            IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
-            if (visibilitySystem && !worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
+            if (!worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
             {
                 instance.m_visibilityEntry.m_boundingVolume = worldEntityBoundsUnion;
-                visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+                return true;
             }
         }
+        return false;
+    }
+
+    void EntityVisibilityBoundsUnionSystem::UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    {
+        if (IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
+            visibilitySystem && UpdateWorldBoundsUnion(entity, instance))
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+        }
     }
 
     void EntityVisibilityBoundsUnionSystem::RefreshEntityLocalBoundsUnion(const AZ::EntityId entityId)
@@ -132,17 +141,29 @@ namespace AzFramework
     {
         AZ_PROFILE_FUNCTION(AzFramework);
 
-        // iterate over all entities whose bounds changed and recalculate them
+        IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
+
+        // iterate over all entities whose bounds changed and recalculate them, gathering the visibility
+        // entries that moved so the visibility system can update them together in a single batch
         for (const auto& entity : m_entityBoundsDirty)
         {
             if (auto instance_it = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
                 instance_it != m_entityVisibilityBoundsUnionInstanceMapping.end())
             {
                 instance_it->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
-                UpdateVisibilitySystem(entity, instance_it->second);
+                if (visibilitySystem && UpdateWorldBoundsUnion(entity, instance_it->second))
+                {
+                    m_visibilityEntryBatch.push_back(&instance_it->second.m_visibilityEntry);
+                }
             }
         }
 
+        if (!m_visibilityEntryBatch.empty())
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntries(m_visibilityEntryBatch);
+            m_visibilityEntryBatch.clear();
+        }
+
         // clear dirty entities once the visibility system has been updated
         m_entityBoundsDirty.clear();
     }
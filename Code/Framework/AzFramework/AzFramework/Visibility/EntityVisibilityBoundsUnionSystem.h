@@ -51,10 +51,13 @@ namespace AzFramework
         // TickBus overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
+        //! Recalculates the world bounds union of the entity, returning true if its visibility entry needs to be updated.
+        bool UpdateWorldBoundsUnion(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
         void UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
 
         EntityVisibilityBoundsUnionInstanceMapping m_entityVisibilityBoundsUnionInstanceMapping;
         UniqueEntities m_entityBoundsDirty;
+        AZStd::vector<VisibilityEntry*> m_visibilityEntryBatch; //!< Visibility entries updated together by ProcessEntityBoundsUnionRequests.
 
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
@@ -72,6 +72,12 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Insert or update a batch of entries within the visibility system.
+        //! This gives the same result as calling InsertOrUpdateEntry for each entry, but allows the implementation to apply the batch
+        //! in parallel on the job system and to defer any restructuring of the spatial hash until the whole batch has been applied.
+        //! @param visibilityEntries data for the objects being added/updated, each entry must appear at most once in the batch
+        virtual void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& visibilityEntries) = 0;
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
@@ -94,6 +100,11 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a frustum against the visibility system, enumerating independent parts of the scene in parallel on the job system.
+        //! @param frustum the frustum to test against
+        //! @param callback the callback to invoke when a node is visible, it is invoked concurrently from multiple threads and must be thread safe
+        virtual void EnumerateParallel(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -7,8 +7,14 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 
 namespace AzFramework
 {
@@ -16,6 +22,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,       64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,       32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(float,    bg_octreeLooseness,          1.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Scale applied to the bounds of new octree nodes to get the loose bounds their entries must fit in, 1 is a regular octree and 2 a typical loose octree");
 
 
     static uint32_t GetChildNodeCount()
@@ -26,8 +33,167 @@ namespace AzFramework
     }
 
 
+    // Cull volumes test the loose bounds of 4 child nodes at once, returning a mask with all bits set in the lanes of the overlapping
+    // children. Each of them gives the same result as the matching AZ::ShapeIntersection::Overlaps overload.
+    namespace OctreeCulling
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        struct ChildBoundsLanes
+        {
+            Vec4::FloatType m_minX;
+            Vec4::FloatType m_minY;
+            Vec4::FloatType m_minZ;
+            Vec4::FloatType m_maxX;
+            Vec4::FloatType m_maxY;
+            Vec4::FloatType m_maxZ;
+        };
+
+        static ChildBoundsLanes LoadChildBounds(const OctreeNode::ChildBounds& childBounds, uint32_t firstChild)
+        {
+            return ChildBoundsLanes{
+                Vec4::LoadAligned(childBounds.m_minX + firstChild), Vec4::LoadAligned(childBounds.m_minY + firstChild),
+                Vec4::LoadAligned(childBounds.m_minZ + firstChild), Vec4::LoadAligned(childBounds.m_maxX + firstChild),
+                Vec4::LoadAligned(childBounds.m_maxY + firstChild), Vec4::LoadAligned(childBounds.m_maxZ + firstChild) };
+        }
+
+        class AabbCullVolume
+        {
+        public:
+            explicit AabbCullVolume(const AZ::Aabb& aabb)
+                : m_minX(Vec4::Splat(aabb.GetMin().GetX()))
+                , m_minY(Vec4::Splat(aabb.GetMin().GetY()))
+                , m_minZ(Vec4::Splat(aabb.GetMin().GetZ()))
+                , m_maxX(Vec4::Splat(aabb.GetMax().GetX()))
+                , m_maxY(Vec4::Splat(aabb.GetMax().GetY()))
+                , m_maxZ(Vec4::Splat(aabb.GetMax().GetZ()))
+            {
+            }
+
+            Vec4::FloatType Overlaps(const ChildBoundsLanes& children) const
+            {
+                const Vec4::FloatType overlapsX = Vec4::And(Vec4::CmpLtEq(children.m_minX, m_maxX), Vec4::CmpGtEq(children.m_maxX, m_minX));
+                const Vec4::FloatType overlapsY = Vec4::And(Vec4::CmpLtEq(children.m_minY, m_maxY), Vec4::CmpGtEq(children.m_maxY, m_minY));
+                const Vec4::FloatType overlapsZ = Vec4::And(Vec4::CmpLtEq(children.m_minZ, m_maxZ), Vec4::CmpGtEq(children.m_maxZ, m_minZ));
+                return Vec4::And(overlapsX, Vec4::And(overlapsY, overlapsZ));
+            }
+
+        private:
+            Vec4::FloatType m_minX;
+            Vec4::FloatType m_minY;
+            Vec4::FloatType m_minZ;
+            Vec4::FloatType m_maxX;
+            Vec4::FloatType m_maxY;
+            Vec4::FloatType m_maxZ;
+        };
+
+        class SphereCullVolume
+        {
+        public:
+            explicit SphereCullVolume(const AZ::Sphere& sphere)
+                : m_centerX(Vec4::Splat(sphere.GetCenter().GetX()))
+                , m_centerY(Vec4::Splat(sphere.GetCenter().GetY()))
+                , m_centerZ(Vec4::Splat(sphere.GetCenter().GetZ()))
+                , m_radiusSq(Vec4::Splat(sphere.GetRadius() * sphere.GetRadius()))
+            {
+            }
+
+            Vec4::FloatType Overlaps(const ChildBoundsLanes& children) const
+            {
+                // Distance from the sphere center to the closest point of each box, zero on the axes the center is inside the box
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+                const Vec4::FloatType distX = Vec4::Max(Vec4::Max(Vec4::Sub(children.m_minX, m_centerX), Vec4::Sub(m_centerX, children.m_maxX)), zero);
+                const Vec4::FloatType distY = Vec4::Max(Vec4::Max(Vec4::Sub(children.m_minY, m_centerY), Vec4::Sub(m_centerY, children.m_maxY)), zero);
+                const Vec4::FloatType distZ = Vec4::Max(Vec4::Max(Vec4::Sub(children.m_minZ, m_centerZ), Vec4::Sub(m_centerZ, children.m_maxZ)), zero);
+                const Vec4::FloatType distSq = Vec4::Madd(distX, distX, Vec4::Madd(distY, distY, Vec4::Mul(distZ, distZ)));
+                return Vec4::CmpLtEq(distSq, m_radiusSq);
+            }
+
+        private:
+            Vec4::FloatType m_centerX;
+            Vec4::FloatType m_centerY;
+            Vec4::FloatType m_centerZ;
+            Vec4::FloatType m_radiusSq;
+        };
+
+        class FrustumCullVolume
+        {
+        public:
+            explicit FrustumCullVolume(const AZ::Frustum& frustum)
+            {
+                for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const AZ::Plane plane = frustum.GetPlane(planeId);
+                    const AZ::Vector3 normal = plane.GetNormal();
+                    m_planes[planeId] = CullPlane{
+                        Vec4::Splat(normal.GetX()), Vec4::Splat(normal.GetY()), Vec4::Splat(normal.GetZ()),
+                        Vec4::Splat(AZStd::abs(normal.GetX())), Vec4::Splat(AZStd::abs(normal.GetY())), Vec4::Splat(AZStd::abs(normal.GetZ())),
+                        Vec4::Splat(plane.GetDistance()) };
+                }
+            }
+
+            Vec4::FloatType Overlaps(const ChildBoundsLanes& children) const
+            {
+                // Boxes are culled when they are fully behind any plane, like in AZ::ShapeIntersection::Overlaps the
+                // center and extents are computed with separate multiplies to avoid overflowing on huge boxes
+                const Vec4::FloatType half = Vec4::Splat(0.5f);
+                const Vec4::FloatType centerX = Vec4::Madd(children.m_maxX, half, Vec4::Mul(children.m_minX, half));
+                const Vec4::FloatType centerY = Vec4::Madd(children.m_maxY, half, Vec4::Mul(children.m_minY, half));
+                const Vec4::FloatType centerZ = Vec4::Madd(children.m_maxZ, half, Vec4::Mul(children.m_minZ, half));
+                const Vec4::FloatType extentX = Vec4::Sub(Vec4::Mul(children.m_maxX, half), Vec4::Mul(children.m_minX, half));
+                const Vec4::FloatType extentY = Vec4::Sub(Vec4::Mul(children.m_maxY, half), Vec4::Mul(children.m_minY, half));
+                const Vec4::FloatType extentZ = Vec4::Sub(Vec4::Mul(children.m_maxZ, half), Vec4::Mul(children.m_minZ, half));
+
+                Vec4::FloatType overlaps = Vec4::CastToFloat(Vec4::Splat(-1));
+                for (const CullPlane& plane : m_planes)
+                {
+                    const Vec4::FloatType distance =
+                        Vec4::Madd(plane.m_normalX, centerX, Vec4::Madd(plane.m_normalY, centerY, Vec4::Madd(plane.m_normalZ, centerZ, plane.m_distance)));
+                    const Vec4::FloatType radius =
+                        Vec4::Madd(plane.m_absNormalX, extentX, Vec4::Madd(plane.m_absNormalY, extentY, Vec4::Mul(plane.m_absNormalZ, extentZ)));
+                    overlaps = Vec4::And(overlaps, Vec4::CmpGt(Vec4::Add(distance, radius), Vec4::ZeroFloat()));
+                }
+                return overlaps;
+            }
+
+        private:
+            struct CullPlane
+            {
+                Vec4::FloatType m_normalX;
+                Vec4::FloatType m_normalY;
+                Vec4::FloatType m_normalZ;
+                Vec4::FloatType m_absNormalX;
+                Vec4::FloatType m_absNormalY;
+                Vec4::FloatType m_absNormalZ;
+                Vec4::FloatType m_distance;
+            };
+            CullPlane m_planes[AZ::Frustum::PlaneId::MAX];
+        };
+
+        static uint32_t ToChildMask(Vec4::FloatArgType overlaps)
+        {
+            alignas(16) int32_t lanes[4];
+            Vec4::StoreAligned(lanes, Vec4::CastToInt(overlaps));
+            return (lanes[0] & 0x01) | (lanes[1] & 0x02) | (lanes[2] & 0x04) | (lanes[3] & 0x08);
+        }
+
+        //! Returns a mask with a bit set for each child node overlapping the cull volume.
+        template <typename CullVolume>
+        static uint32_t GetOverlappingChildren(const CullVolume& cullVolume, const OctreeNode::ChildBounds& childBounds)
+        {
+            uint32_t childMask = ToChildMask(cullVolume.Overlaps(LoadChildBounds(childBounds, 0)));
+            if (GetChildNodeCount() > 4)
+            {
+                childMask |= ToChildMask(cullVolume.Overlaps(LoadChildBounds(childBounds, 4))) << 4;
+            }
+            return childMask;
+        }
+    } // namespace OctreeCulling
+
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
+        , m_looseBounds(bounds)
     {
         ;
     }
@@ -35,6 +201,8 @@ namespace AzFramework
 
     OctreeNode::OctreeNode(OctreeNode&& rhs)
         : m_bounds(rhs.m_bounds)
+        , m_looseBounds(rhs.m_looseBounds)
+        , m_childBounds(rhs.m_childBounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
         , m_entries(AZStd::move(rhs.m_entries))
@@ -50,6 +218,8 @@ namespace AzFramework
     OctreeNode& OctreeNode::operator=(OctreeNode&& rhs)
     {
         m_bounds = rhs.m_bounds;
+        m_looseBounds = rhs.m_looseBounds;
+        m_childBounds = rhs.m_childBounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
         m_entries = AZStd::move(rhs.m_entries);
@@ -68,21 +238,18 @@ namespace AzFramework
     {
         AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the OctreeScene");
 
-        // If this is not a leaf node, try to insert into the child nodes
+        // If this is not a leaf node, try to insert into the child node containing the center of the entry
         if (m_children != nullptr)
         {
             const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            OctreeNode& child = m_children[GetChildIndexForBounds(boundingVolume)];
+            if (AZ::ShapeIntersection::Contains(child.m_looseBounds, boundingVolume))
             {
-                if (AZ::ShapeIntersection::Contains(m_children[child].m_bounds, boundingVolume))
-                {
-                    return m_children[child].Insert(octreeScene, entry);
-                }
+                return child.Insert(octreeScene, entry);
             }
         }
 
-        // If we reach here, either we don't have children or the entry overlaps multiple child nodes
+        // If we reach here, either we don't have children or the entry doesn't fit the loose bounds of the child node
         // Attempt to add the entry to the current nodes entry set, forcing a split if necessary
         if ((m_children == nullptr) && (m_entries.size() >= bg_octreeNodeMaxEntries))
         {
@@ -92,9 +259,7 @@ namespace AzFramework
         }
         else
         {
-            m_entries.push_back(entry);
-            entry->m_internalNode = this;
-            entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+            BindEntry(entry);
         }
     }
 
@@ -104,7 +269,7 @@ namespace AzFramework
         AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different OctreeNode");
 
         const AZ::Aabb boundingVolume = entry->m_boundingVolume;
-        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume))
         {
             // Entry moved, but is still fully contained within the current node
             // We can only do this for leaf nodes, otherwise entries can get 'stuck' in non-leaf nodes
@@ -120,7 +285,7 @@ namespace AzFramework
         OctreeNode* insertCheck = this;
         while (insertCheck != nullptr)
         {
-            if (AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume) || !insertCheck->m_parent)
+            if (AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) || !insertCheck->m_parent)
             {
                 // Insert here if the entry is fully contained or if we've reached the root node
                 return insertCheck->Insert(octreeScene, entry);
@@ -133,6 +298,82 @@ namespace AzFramework
     void OctreeNode::Remove(OctreeScene& octreeScene, VisibilityEntry* entry)
     {
         AZ_Assert(entry->m_internalNode == this, "Remove invoked for an entry bound to a different OctreeNode");
+
+        UnbindEntry(entry);
+        MergeParentIfSparse(octreeScene);
+    }
+
+
+    OctreeNode* OctreeNode::FindInsertNode(const AZ::Aabb& boundingVolume)
+    {
+        // Follows the same path down the tree as Insert
+        OctreeNode* insertNode = this;
+        while (insertNode->m_children != nullptr)
+        {
+            OctreeNode& child = insertNode->m_children[insertNode->GetChildIndexForBounds(boundingVolume)];
+            if (!AZ::ShapeIntersection::Contains(child.m_looseBounds, boundingVolume))
+            {
+                break;
+            }
+            insertNode = &child;
+        }
+        return insertNode;
+    }
+
+
+    OctreeNode* OctreeNode::FindUpdateNode(const VisibilityEntry* entry)
+    {
+        AZ_Assert(entry->m_internalNode == this, "FindUpdateNode invoked for an entry bound to a different OctreeNode");
+
+        // Follows the same path through the tree as Update
+        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
+        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_looseBounds, boundingVolume))
+        {
+            return this;
+        }
+
+        OctreeNode* insertCheck = this;
+        while (!AZ::ShapeIntersection::Contains(insertCheck->m_looseBounds, boundingVolume) && insertCheck->m_parent)
+        {
+            insertCheck = insertCheck->m_parent;
+        }
+        return insertCheck->FindInsertNode(boundingVolume);
+    }
+
+
+    const OctreeNode* OctreeNode::GetAncestorAtDepth(uint32_t depth) const
+    {
+        // Walk a second pointer depth levels behind the first one, it reaches the requested ancestor when the first one reaches the root
+        const OctreeNode* ancestor = this;
+        const OctreeNode* lead = this;
+        for (uint32_t level = 0; level < depth; ++level)
+        {
+            if (lead->m_parent == nullptr)
+            {
+                return nullptr;
+            }
+            lead = lead->m_parent;
+        }
+
+        while (lead->m_parent != nullptr)
+        {
+            lead = lead->m_parent;
+            ancestor = ancestor->m_parent;
+        }
+        return ancestor;
+    }
+
+
+    void OctreeNode::BindEntry(VisibilityEntry* entry)
+    {
+        m_entries.push_back(entry);
+        entry->m_internalNode = this;
+        entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+    }
+
+
+    void OctreeNode::UnbindEntry(VisibilityEntry* entry)
+    {
         AZ_Assert(m_entries[entry->m_internalNodeIndex] == entry, "Visibility entry data is corrupt");
 
         // Swap and pop the removed entry
@@ -145,7 +386,21 @@ namespace AzFramework
             m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
         }
         m_entries.pop_back();
+    }
+
+
+    void OctreeNode::SplitIfFull(OctreeScene& octreeScene)
+    {
+        // Insert splits a leaf node when an entry is added to it while it already holds the maximum number of entries
+        if (IsLeaf() && (m_entries.size() > bg_octreeNodeMaxEntries))
+        {
+            Split(octreeScene);
+        }
+    }
 
+
+    void OctreeNode::MergeParentIfSparse(OctreeScene& octreeScene)
+    {
         if (m_parent != nullptr)
         {
             m_parent->TryMerge(octreeScene);
@@ -155,19 +410,56 @@ namespace AzFramework
 
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(aabb, callback);
+        EnumerateHelper(OctreeCulling::AabbCullVolume(aabb), callback);
     }
 
 
     void OctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(sphere, callback);
+        EnumerateHelper(OctreeCulling::SphereCullVolume(sphere), callback);
     }
 
 
     void OctreeNode::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
     {
-        EnumerateHelper(frustum, callback);
+        EnumerateHelper(OctreeCulling::FrustumCullVolume(frustum), callback);
+    }
+
+
+    void OctreeNode::EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        const OctreeCulling::FrustumCullVolume cullVolume(frustum);
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext == nullptr)
+        {
+            EnumerateHelper(cullVolume, callback);
+            return;
+        }
+
+        // Enumerate the top levels of the tree on this thread, then hand each overlapping subtree below them to a job
+        SubtreeList subtrees;
+        GatherSubtrees(cullVolume, callback, ParallelEnumerateDepth, subtrees);
+        if (subtrees.size() <= 1)
+        {
+            for (const OctreeNode* subtree : subtrees)
+            {
+                subtree->EnumerateHelper(cullVolume, callback);
+            }
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (const OctreeNode* subtree : subtrees)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([subtree, &cullVolume, &callback]()
+            {
+                subtree->EnumerateHelper(cullVolume, callback);
+            }, true, jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
     }
 
 
@@ -176,7 +468,7 @@ namespace AzFramework
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
@@ -209,6 +501,12 @@ namespace AzFramework
     }
 
 
+    const AZ::Aabb& OctreeNode::GetLooseBounds() const
+    {
+        return m_looseBounds;
+    }
+
+
     void OctreeNode::TryMerge(OctreeScene& octreeScene)
     {
         if (IsLeaf())
@@ -237,32 +535,69 @@ namespace AzFramework
     }
 
 
-    template <typename T>
-    void OctreeNode::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    uint32_t OctreeNode::GetChildIndexForBounds(const AZ::Aabb& boundingVolume) const
     {
-        AZ_Assert(AZ::ShapeIntersection::Overlaps(boundingVolume, m_bounds), "EnumerateHelper invoked on an octreeSystemComponent node that is not within the bounding volume");
+        // The first child node ends at the split point along every axis
+        const AZ::Vector3 splitPoint = m_children[0].m_bounds.GetMax();
+        const AZ::Vector3 center = (0.5f * boundingVolume.GetMin()) + (0.5f * boundingVolume.GetMax());
+
+        uint32_t child = 0;
+        child |= (center.GetX() >= splitPoint.GetX()) ? 0x01 : 0;
+        child |= (center.GetY() >= splitPoint.GetY()) ? 0x02 : 0;
+        if (GetChildNodeCount() > 4)
+        {
+            child |= (center.GetZ() >= splitPoint.GetZ()) ? 0x04 : 0;
+        }
+        return child;
+    }
 
+
+    template <typename CullVolume>
+    void OctreeNode::EnumerateHelper(const CullVolume& cullVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    {
         // Invoke the callback for the current node
         if (!m_entries.empty())
         {
-            callback({m_bounds, m_entries});
+            callback({m_looseBounds, m_entries});
         }
 
         if (m_children != nullptr)
         {
-            // If this is not a leaf node, recurse into the children
-            const uint32_t childCount = GetChildNodeCount();
-            for (uint32_t child = 0; child < childCount; ++child)
+            // If this is not a leaf node, recurse into the children overlapping the cull volume
+            uint32_t overlappingChildren = OctreeCulling::GetOverlappingChildren(cullVolume, m_childBounds);
+            while (overlappingChildren != 0)
             {
-                if (AZ::ShapeIntersection::Overlaps(boundingVolume, m_children[child].m_bounds))
-                {
-                    m_children[child].EnumerateHelper(boundingVolume, callback);
-                }
+                m_children[az_ctz_u32(overlappingChildren)].EnumerateHelper(cullVolume, callback);
+                overlappingChildren &= overlappingChildren - 1;
             }
         }
     }
 
 
+    template <typename CullVolume>
+    void OctreeNode::GatherSubtrees(
+        const CullVolume& cullVolume, const IVisibilityScene::EnumerateCallback& callback, uint32_t depth, SubtreeList& subtrees) const
+    {
+        if (depth == 0 || m_children == nullptr)
+        {
+            subtrees.push_back(this);
+            return;
+        }
+
+        if (!m_entries.empty())
+        {
+            callback({m_looseBounds, m_entries});
+        }
+
+        uint32_t overlappingChildren = OctreeCulling::GetOverlappingChildren(cullVolume, m_childBounds);
+        while (overlappingChildren != 0)
+        {
+            m_children[az_ctz_u32(overlappingChildren)].GatherSubtrees(cullVolume, callback, depth - 1, subtrees);
+            overlappingChildren &= overlappingChildren - 1;
+        }
+    }
+
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -273,6 +608,7 @@ namespace AzFramework
         {
             const AZ::Vector3 childExtent = (m_bounds.GetMax() - m_bounds.GetMin()) * 0.5f;
             const AZ::Aabb childBound = AZ::Aabb::CreateFromMinMax(m_bounds.GetMin(), m_bounds.GetMin() + childExtent);
+            const AZ::Vector3 looseMargin = childExtent * (0.5f * (AZ::GetMax(static_cast<float>(bg_octreeLooseness), 1.0f) - 1.0f));
             const uint32_t childCount = GetChildNodeCount();
 
             for (uint32_t child = 0; child < childCount; ++child)
@@ -297,8 +633,20 @@ namespace AzFramework
                     childOffset.SetZ(childExtent.GetZ());
                 }
 
-                m_children[child].m_bounds = childBound.GetTranslated(childOffset);
-                m_children[child].m_parent = this;
+                OctreeNode& childNode = m_children[child];
+                childNode.m_bounds = childBound.GetTranslated(childOffset);
+                childNode.m_looseBounds = AZ::Aabb::CreateFromMinMax(
+                    childNode.m_bounds.GetMin() - looseMargin, childNode.m_bounds.GetMax() + looseMargin);
+                childNode.m_parent = this;
+
+                const AZ::Vector3 looseMin = childNode.m_looseBounds.GetMin();
+                const AZ::Vector3 looseMax = childNode.m_looseBounds.GetMax();
+                m_childBounds.m_minX[child] = looseMin.GetX();
+                m_childBounds.m_minY[child] = looseMin.GetY();
+                m_childBounds.m_minZ[child] = looseMin.GetZ();
+                m_childBounds.m_maxX[child] = looseMax.GetX();
+                m_childBounds.m_maxY[child] = looseMax.GetY();
+                m_childBounds.m_maxZ[child] = looseMax.GetZ();
             }
         }
 
@@ -372,6 +720,148 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        m_batchUpdates.clear();
+        m_batchUpdates.reserve(entries.size());
+        for (VisibilityEntry* entry : entries)
+        {
+            BatchUpdate batchUpdate;
+            batchUpdate.m_entry = entry;
+            batchUpdate.m_sourceNode = static_cast<OctreeNode*>(entry->m_internalNode);
+            m_batchUpdates.push_back(batchUpdate);
+        }
+
+        // Find the node each entry moves to, this does not modify the tree so the entries are split across jobs freely
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (jobContext != nullptr && m_batchUpdates.size() > ParallelUpdateBatchSize)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t begin = 0; begin < m_batchUpdates.size(); begin += ParallelUpdateBatchSize)
+            {
+                const size_t end = AZStd::min(begin + ParallelUpdateBatchSize, m_batchUpdates.size());
+                AZ::Job* job = AZ::CreateJobFunction([this, begin, end]()
+                {
+                    ResolveBatchUpdates(begin, end);
+                }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            ResolveBatchUpdates(0, m_batchUpdates.size());
+        }
+
+        // Group the updates by subtree, the updates moving entries across subtrees or through the top levels of the tree come first
+        AZStd::sort(m_batchUpdates.begin(), m_batchUpdates.end(), [](const BatchUpdate& lhs, const BatchUpdate& rhs)
+        {
+            return lhs.m_subtree < rhs.m_subtree;
+        });
+
+        size_t serialEnd = 0;
+        while (serialEnd < m_batchUpdates.size() && m_batchUpdates[serialEnd].m_subtree == nullptr)
+        {
+            ++serialEnd;
+        }
+
+        // Each subtree only holds entries moving within it, so the subtrees are updated in parallel without splitting or merging any node
+        if (jobContext != nullptr && serialEnd < m_batchUpdates.size() &&
+            m_batchUpdates[serialEnd].m_subtree != m_batchUpdates.back().m_subtree)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t begin = serialEnd; begin < m_batchUpdates.size();)
+            {
+                size_t end = begin + 1;
+                while (end < m_batchUpdates.size() && m_batchUpdates[end].m_subtree == m_batchUpdates[begin].m_subtree)
+                {
+                    ++end;
+                }
+
+                AZ::Job* job = AZ::CreateJobFunction([this, begin, end]()
+                {
+                    ApplyBatchUpdates(begin, end);
+                }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+                begin = end;
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            ApplyBatchUpdates(serialEnd, m_batchUpdates.size());
+        }
+        ApplyBatchUpdates(0, serialEnd);
+
+        // Perform the merges and then the splits deferred while the batch was applied, merges never allocate nodes so the nodes
+        // they release are not reused before all of them are done. Merging or splitting an already restructured node is a no-op.
+        for (const BatchUpdate& batchUpdate : m_batchUpdates)
+        {
+            if (batchUpdate.m_sourceNode != nullptr && batchUpdate.m_sourceNode != batchUpdate.m_targetNode)
+            {
+                batchUpdate.m_sourceNode->MergeParentIfSparse(*this);
+            }
+            else if (batchUpdate.m_sourceNode == nullptr)
+            {
+                ++m_entryCount;
+            }
+        }
+
+        for (const BatchUpdate& batchUpdate : m_batchUpdates)
+        {
+            if (batchUpdate.m_sourceNode != batchUpdate.m_targetNode)
+            {
+                static_cast<OctreeNode*>(batchUpdate.m_entry->m_internalNode)->SplitIfFull(*this);
+            }
+        }
+    }
+
+
+    void OctreeScene::ResolveBatchUpdates(size_t begin, size_t end)
+    {
+        for (size_t index = begin; index < end; ++index)
+        {
+            BatchUpdate& batchUpdate = m_batchUpdates[index];
+            if (batchUpdate.m_sourceNode != nullptr)
+            {
+                batchUpdate.m_targetNode = batchUpdate.m_sourceNode->FindUpdateNode(batchUpdate.m_entry);
+            }
+            else
+            {
+                batchUpdate.m_targetNode = m_root.FindInsertNode(batchUpdate.m_entry->m_boundingVolume);
+            }
+
+            // Updates can only be applied in parallel when both nodes belong to the same subtree
+            const OctreeNode* targetSubtree = batchUpdate.m_targetNode->GetAncestorAtDepth(ParallelUpdateDepth);
+            if (batchUpdate.m_sourceNode == nullptr || batchUpdate.m_sourceNode->GetAncestorAtDepth(ParallelUpdateDepth) == targetSubtree)
+            {
+                batchUpdate.m_subtree = targetSubtree;
+            }
+        }
+    }
+
+
+    void OctreeScene::ApplyBatchUpdates(size_t begin, size_t end)
+    {
+        for (size_t index = begin; index < end; ++index)
+        {
+            const BatchUpdate& batchUpdate = m_batchUpdates[index];
+            if (batchUpdate.m_sourceNode != batchUpdate.m_targetNode)
+            {
+                if (batchUpdate.m_sourceNode != nullptr)
+                {
+                    batchUpdate.m_sourceNode->UnbindEntry(batchUpdate.m_entry);
+                }
+                batchUpdate.m_targetNode->BindEntry(batchUpdate.m_entry);
+            }
+        }
+    }
+
+
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -404,6 +894,13 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateParallel(frustum, callback);
+    }
+
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
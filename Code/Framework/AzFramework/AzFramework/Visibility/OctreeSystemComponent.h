@@ -22,7 +22,9 @@ namespace AzFramework
     class OctreeScene;
 
     //! An internal node within the tree.
-    //! It contains all objects that are *fully contained* by the node, if an object spans multiple child nodes that object will be stored in the parent.
+    //! It contains all objects that are *fully contained* by the loose bounds of the node, if an object does not fit the loose bounds of
+    //! the child node containing its center that object will be stored in the parent.
+    //! The loose bounds are the node bounds scaled around their center by bg_octreeLooseness, with a looseness of 1 this is a regular octree.
     class OctreeNode
         : public VisibilityNode
     {
@@ -47,6 +49,24 @@ namespace AzFramework
         //! The provided entry must be bound to this node.
         void Remove(OctreeScene& octreeScene, VisibilityEntry* entry);
 
+        //! Methods used by OctreeScene::InsertOrUpdateEntries to apply a batch of updates.
+        //! None of them splits or merges nodes, so they can be used concurrently on disjoint subtrees.
+        //! @{
+        //! Returns the node Insert would bind an entry with the provided bounding volume to, ignoring any split it would trigger.
+        OctreeNode* FindInsertNode(const AZ::Aabb& boundingVolume);
+        //! Returns the node Update would bind the entry to, ignoring any split or merge it would trigger.
+        //! The provided entry must be bound to this node.
+        OctreeNode* FindUpdateNode(const VisibilityEntry* entry);
+        //! Returns the ancestor of this node the provided number of levels below the root, or nullptr if this node is not that deep.
+        const OctreeNode* GetAncestorAtDepth(uint32_t depth) const;
+        void BindEntry(VisibilityEntry* entry);
+        void UnbindEntry(VisibilityEntry* entry);
+        //! Performs the split Insert would have triggered if this leaf node holds too many entries.
+        void SplitIfFull(OctreeScene& octreeScene);
+        //! Performs the merge Remove would have triggered on the parent of this node.
+        void MergeParentIfSparse(OctreeScene& octreeScene);
+        //! @}
+
         //! Recursively enumerates any OctreeNodes and their children that intersect the provided bounding volume.
         //! @{
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const;
@@ -54,6 +74,10 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Enumerates the OctreeNodes that intersect the provided frustum like Enumerate, but processes the subtrees below the top
+        //! levels of the tree in parallel on the job system. The callback is invoked concurrently and must be thread safe.
+        void EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
@@ -66,12 +90,39 @@ namespace AzFramework
         //! Returns true if this is a leaf node.
         bool IsLeaf() const;
 
+        //! Returns the loose bounds of this node, which contain every entry bound to it.
+        const AZ::Aabb& GetLooseBounds() const;
+
+        static constexpr uint32_t MaxChildNodeCount = 8;
+
+        //! The loose bounds of the child nodes in SoA form, so that all the child nodes can be culled with a few SIMD operations.
+        struct ChildBounds
+        {
+            alignas(16) float m_minX[MaxChildNodeCount];
+            alignas(16) float m_minY[MaxChildNodeCount];
+            alignas(16) float m_minZ[MaxChildNodeCount];
+            alignas(16) float m_maxX[MaxChildNodeCount];
+            alignas(16) float m_maxY[MaxChildNodeCount];
+            alignas(16) float m_maxZ[MaxChildNodeCount];
+        };
+
     private:
 
         void TryMerge(OctreeScene& octreeScene);
 
-        template <typename T>
-        void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+        //! Returns the index of the child node whose bounds contain the center of the provided bounding volume.
+        uint32_t GetChildIndexForBounds(const AZ::Aabb& boundingVolume) const;
+
+        template <typename CullVolume>
+        void EnumerateHelper(const CullVolume& cullVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        //! Number of tree levels enumerated serially by EnumerateParallel before the remaining subtrees are handed to jobs.
+        static constexpr uint32_t ParallelEnumerateDepth = 2;
+        using SubtreeList = AZStd::fixed_vector<const OctreeNode*, MaxChildNodeCount * MaxChildNodeCount>;
+
+        template <typename CullVolume>
+        void GatherSubtrees(
+            const CullVolume& cullVolume, const IVisibilityScene::EnumerateCallback& callback, uint32_t depth, SubtreeList& subtrees) const;
 
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
@@ -81,13 +132,15 @@ namespace AzFramework
         static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
         uint32_t m_childNodeIndex = InvalidChildNodeIndex;
         AZ::Aabb m_bounds;
+        AZ::Aabb m_looseBounds;
+        ChildBounds m_childBounds; //< Only valid if this is not a leaf node.
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
         AZStd::vector<VisibilityEntry*> m_entries;
     };
 
     //! Implementation of the visibility system interface.
-    //! This uses a simple adaptive octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
+    //! This uses a simple adaptive (optionally loose) octree to support partitioning an object set for a specific scene and efficiently running gathers and visibility queries.
     class OctreeScene
         : public IVisibilityScene
     {
@@ -103,10 +156,12 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries) override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -121,6 +176,23 @@ namespace AzFramework
         //! @}
 
     private:
+        //! An entry of a batch passed to InsertOrUpdateEntries, along with the node it is moving from and the node it is moving to.
+        struct BatchUpdate
+        {
+            VisibilityEntry* m_entry = nullptr;
+            OctreeNode* m_sourceNode = nullptr; //< nullptr for entries being inserted.
+            OctreeNode* m_targetNode = nullptr;
+            const OctreeNode* m_subtree = nullptr; //< The subtree containing both nodes, nullptr if the update has to be applied serially.
+        };
+
+        //! Number of tree levels above the subtrees InsertOrUpdateEntries updates in parallel.
+        static constexpr uint32_t ParallelUpdateDepth = 2;
+        //! Number of entries resolved by each job of InsertOrUpdateEntries.
+        static constexpr uint32_t ParallelUpdateBatchSize = 256;
+
+        void ResolveBatchUpdates(size_t begin, size_t end);
+        void ApplyBatchUpdates(size_t begin, size_t end);
+
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
@@ -140,6 +212,8 @@ namespace AzFramework
         AZStd::vector<OctreeNodePage*> m_nodeCache; //< Array of contiguous memory blocks for all allocated nodes within the tree.
         AZStd::stack<uint32_t> m_freeOctreeNodes; //< Indices of free nodes, each entry represents a contiguous block of free OctreeNodeChildCount nodes.
 
+        AZStd::vector<BatchUpdate> m_batchUpdates; //< Kept between calls to InsertOrUpdateEntries to reuse its memory.
+
         friend class OctreeNode; // For access to the node allocator methods
     };
 
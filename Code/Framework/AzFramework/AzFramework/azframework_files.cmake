@@ -129,6 +129,9 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/ITransformHierarchySystem.h
+    Components/TransformHierarchySystem.cpp
+    Components/TransformHierarchySystem.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -9,7 +9,12 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
@@ -38,6 +43,7 @@ namespace UnitTest
             m_console->GetCvarValue("bg_octreeNodeMaxEntries", m_savedMaxEntries);
             m_console->GetCvarValue("bg_octreeNodeMinEntries", m_savedMinEntries);
             m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+            m_console->GetCvarValue("bg_octreeLooseness", m_savedLooseness);
 
             // To ease unit testing, configure the octreeSystemComponent to only allow one entry per node
             m_console->PerformCommand("bg_octreeNodeMaxEntries 1");
@@ -63,6 +69,8 @@ namespace UnitTest
             m_console->PerformCommand(commandString.c_str());
             commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
             m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_octreeLooseness %f", m_savedLooseness);
+            m_console->PerformCommand(commandString.c_str());
 
             m_octreeSystemComponent->DestroyVisibilityScene(m_octreeScene);
             delete m_octreeSystemComponent;
@@ -88,9 +96,52 @@ namespace UnitTest
         uint32_t m_savedMaxEntries = 0;
         uint32_t m_savedMinEntries = 0;
         float m_savedBounds = 0.0f;
+        float m_savedLooseness = 1.0f;
         AZ::Console* m_console;
     };
 
+    //! Runs the octree tests with a global JobContext, so batch updates and parallel enumeration are spread across worker threads.
+    class OctreeParallelTests
+        : public OctreeTests
+    {
+    public:
+        static constexpr uint32_t WorkerThreadCount = 4;
+
+        void SetUp() override
+        {
+            OctreeTests::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc desc;
+            for (uint32_t i = 0; i < WorkerThreadCount; ++i)
+            {
+                desc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = aznew AZ::JobManager(desc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+        }
+
+        void TearDown() override
+        {
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            m_jobContext = nullptr;
+            delete m_jobManager;
+            m_jobManager = nullptr;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            OctreeTests::TearDown();
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
     void ValidateEntryCountEqualsExpectedCount(const IVisibilityScene* visScene, uint32_t expectedEntryCount)
     {
         // InsertOrUpdateEntry assumes that updating an existing entry won't change the count
@@ -420,4 +471,202 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, static_cast<uint32_t>(visEntries.size()));
     }
+
+    TEST_F(OctreeParallelTests, EnumerateParallelFrustum_MultipleEntries_MatchesEnumerate)
+    {
+        // Enough entries for the tree to be much deeper than the levels EnumerateParallel walks before starting jobs
+        constexpr uint32_t EntryCount = 512;
+
+        std::mt19937 generator(4321);
+        std::uniform_real_distribution<float> positionDistribution(-0.95f, 0.85f);
+        std::uniform_real_distribution<float> sizeDistribution(0.01f, 0.1f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        AZStd::vector<AzFramework::VisibilityEntry*> batch;
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 min(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(sizeDistribution(generator)));
+            batch.push_back(&entry);
+        }
+        m_octreeScene->InsertOrUpdateEntries(batch);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, EntryCount);
+
+        // A frustum looking down +Y that covers part of the world, so some subtrees are culled and many are enumerated
+        AZ::Vector3 frustumOrigin = AZ::Vector3(0.3f, -2.0f, 0.0f);
+        AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), frustumOrigin);
+        AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.4f), 1.0f, 3.5f));
+
+        AZStd::vector<VisibilityEntry*> expectedEntries;
+        m_octreeScene->Enumerate(frustum, [&expectedEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(expectedEntries, nodeData); });
+
+        AZStd::mutex gatherMutex;
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        m_octreeScene->EnumerateParallel(frustum, [&gatheredEntries, &gatherMutex](const AzFramework::IVisibilityScene::NodeData& nodeData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(gatherMutex);
+            AppendEntries(gatheredEntries, nodeData);
+        });
+
+        // Jobs invoke the callback in any order, so compare the sets of entries
+        EXPECT_GT(expectedEntries.size(), 0);
+        EXPECT_LT(expectedEntries.size(), EntryCount);
+        AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+        AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+        EXPECT_EQ(gatheredEntries, expectedEntries);
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
+    TEST_F(OctreeTests, InsertOrUpdateEntry_LooseOctree_EntryStraddlingSplitIsStoredInChildNode)
+    {
+        m_console->PerformCommand("bg_octreeLooseness 2");
+
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        m_octreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->InsertOrUpdateEntry(visEntry[1]); // This should force a split of the root node
+        EXPECT_EQ(m_octreeScene->GetNodeCount(), 1 + m_octreeScene->GetChildNodeCount());
+
+        // Straddles the split planes of the root node, a regular octree would have to keep it in the root node
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.1f), AZ::Vector3(0.2f));
+        m_octreeScene->InsertOrUpdateEntry(visEntry[1]);
+        const OctreeNode* node = static_cast<const OctreeNode*>(visEntry[1].m_internalNode);
+        ASSERT_NE(node, nullptr);
+        EXPECT_TRUE(node->IsLeaf());
+        EXPECT_TRUE(node->GetLooseBounds().Contains(visEntry[1].m_boundingVolume));
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 2);
+
+        // Queries only overlapping the loose part of the node bounds still find the entry
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.15f), AZ::Vector3(-0.05f));
+        m_octreeScene->Enumerate(query, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_NE(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &visEntry[1]), gatheredEntries.end());
+
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+        EXPECT_EQ(m_octreeScene->GetNodeCount(), 1);
+    }
+
+    TEST_F(OctreeTests, InsertOrUpdateEntries_BatchInsert_SplitsLikeSerialInserts)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+
+        // The splits are deferred until the whole batch is in the root node, which must end up split the same way as with serial inserts
+        m_octreeScene->InsertOrUpdateEntries({ &visEntry[0], &visEntry[1], &visEntry[2] });
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+        for (const AzFramework::VisibilityEntry& entry : visEntry)
+        {
+            const OctreeNode* node = static_cast<const OctreeNode*>(entry.m_internalNode);
+            ASSERT_NE(node, nullptr);
+            EXPECT_TRUE(node->IsLeaf());
+            EXPECT_EQ(node->GetEntries()[entry.m_internalNodeIndex], &entry);
+        }
+
+        // Moving the last two entries next to the first one merges the +/+/+ child node and splits the -/-/- child node
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.4f), AZ::Vector3(-0.1f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.35f), AZ::Vector3(-0.15f));
+        m_octreeScene->InsertOrUpdateEntries({ &visEntry[1], &visEntry[2] });
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        for (const AzFramework::VisibilityEntry& entry : visEntry)
+        {
+            const OctreeNode* node = static_cast<const OctreeNode*>(entry.m_internalNode);
+            ASSERT_NE(node, nullptr);
+            EXPECT_TRUE(node->GetLooseBounds().Contains(entry.m_boundingVolume));
+            EXPECT_EQ(node->GetEntries()[entry.m_internalNodeIndex], &entry);
+        }
+
+        m_octreeScene->RemoveEntry(visEntry[2]);
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
+    TEST_F(OctreeParallelTests, InsertOrUpdateEntries_RandomBatches_TreeStaysConsistent)
+    {
+        // Every batch moves half of the entries, more than the 256 entries needed to resolve a batch on worker threads
+        constexpr uint32_t EntryCount = 1024;
+        constexpr uint32_t BatchCount = 4;
+
+        std::mt19937 generator(1234);
+        std::uniform_real_distribution<float> positionDistribution(-0.95f, 0.85f);
+        std::uniform_real_distribution<float> sizeDistribution(0.01f, 0.1f);
+        std::uniform_real_distribution<float> offsetDistribution(-0.05f, 0.05f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(EntryCount);
+        AZStd::vector<AzFramework::VisibilityEntry*> batch;
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 min(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(min, min + AZ::Vector3(sizeDistribution(generator)));
+            batch.push_back(&entry);
+        }
+        m_octreeScene->InsertOrUpdateEntries(batch);
+
+        for (uint32_t batchIndex = 0; batchIndex <= BatchCount; ++batchIndex)
+        {
+            ValidateEntryCountEqualsExpectedCount(m_octreeScene, EntryCount);
+            for (const AzFramework::VisibilityEntry& entry : visEntries)
+            {
+                const OctreeNode* node = static_cast<const OctreeNode*>(entry.m_internalNode);
+                ASSERT_NE(node, nullptr);
+                EXPECT_TRUE(node->GetLooseBounds().Contains(entry.m_boundingVolume));
+                EXPECT_EQ(node->GetEntries()[entry.m_internalNodeIndex], &entry);
+                EXPECT_TRUE(!node->IsLeaf() || node->GetEntries().size() <= 1);
+            }
+
+            // Queries must still find every entry overlapping them
+            const AZ::Aabb query = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.3f), AZ::Vector3(0.2f));
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_octreeScene->Enumerate(query, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+            for (AzFramework::VisibilityEntry& entry : visEntries)
+            {
+                if (entry.m_boundingVolume.Overlaps(query))
+                {
+                    EXPECT_NE(AZStd::find(gatheredEntries.begin(), gatheredEntries.end(), &entry), gatheredEntries.end());
+                }
+            }
+
+            if (batchIndex == BatchCount)
+            {
+                break;
+            }
+
+            // Move every other entry, most of them a short distance and some of them across the world
+            batch.clear();
+            for (uint32_t entryIndex = batchIndex % 2; entryIndex < EntryCount; entryIndex += 2)
+            {
+                AzFramework::VisibilityEntry& entry = visEntries[entryIndex];
+                AZ::Vector3 min = entry.m_boundingVolume.GetMin();
+                if (entryIndex % 16 == 0)
+                {
+                    min = AZ::Vector3(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+                }
+                else
+                {
+                    min += AZ::Vector3(offsetDistribution(generator), offsetDistribution(generator), offsetDistribution(generator));
+                    min = min.GetClamp(AZ::Vector3(-0.95f), AZ::Vector3(0.85f));
+                }
+                entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(min, min + entry.m_boundingVolume.GetExtents());
+                batch.push_back(&entry);
+            }
+            m_octreeScene->InsertOrUpdateEntries(batch);
+        }
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
 }
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PayloadSlab.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AzNetworking
+{
+    // Number of blocks allocated on first use, enough for a handful of MTU sized payloads
+    static constexpr uint32_t InitialBlockCount = 64;
+
+    PayloadSlab::PayloadSlab(uint32_t maxBlockCount)
+        : m_maxBlockCount(maxBlockCount)
+    {
+        ;
+    }
+
+    PayloadSlab::Handle PayloadSlab::Store(const uint8_t* data, uint32_t size)
+    {
+        const uint32_t requiredBlocks = GetRequiredBlockCount(size);
+        if ((m_freeBlockCount < requiredBlocks) && !Grow(requiredBlocks))
+        {
+            return InvalidHandle;
+        }
+
+        const Handle firstBlock = m_freeHead;
+        Handle block = firstBlock;
+        uint32_t bytesRemaining = size;
+        for (uint32_t index = 0; index < requiredBlocks; ++index)
+        {
+            const uint32_t blockBytes = AZ::GetMin(bytesRemaining, BlockSize);
+            if (blockBytes > 0)
+            {
+                memcpy(m_blockData.data() + static_cast<size_t>(block) * BlockSize, data, blockBytes);
+            }
+            data += blockBytes;
+            bytesRemaining -= blockBytes;
+
+            if (index + 1 < requiredBlocks)
+            {
+                block = m_nextBlock[block];
+            }
+        }
+
+        // Detach the chain from the free list
+        m_freeHead = m_nextBlock[block];
+        m_nextBlock[block] = InvalidHandle;
+        m_freeBlockCount -= requiredBlocks;
+        return firstBlock;
+    }
+
+    void PayloadSlab::Load(Handle handle, uint32_t size, uint8_t* outData) const
+    {
+        Handle block = handle;
+        uint32_t bytesRemaining = size;
+        while ((bytesRemaining > 0) && (block != InvalidHandle))
+        {
+            const uint32_t blockBytes = AZ::GetMin(bytesRemaining, BlockSize);
+            memcpy(outData, GetBlockData(block), blockBytes);
+            outData += blockBytes;
+            bytesRemaining -= blockBytes;
+            block = m_nextBlock[block];
+        }
+        AZ_Assert(bytesRemaining == 0, "Payload is smaller than the requested size");
+    }
+
+    const uint8_t* PayloadSlab::GetBlockData(Handle block) const
+    {
+        AZ_Assert(block < m_nextBlock.size(), "Invalid payload block");
+        return m_blockData.data() + static_cast<size_t>(block) * BlockSize;
+    }
+
+    PayloadSlab::Handle PayloadSlab::GetNextBlock(Handle block) const
+    {
+        AZ_Assert(block < m_nextBlock.size(), "Invalid payload block");
+        return m_nextBlock[block];
+    }
+
+    void PayloadSlab::Free(Handle handle)
+    {
+        if (handle == InvalidHandle)
+        {
+            return;
+        }
+
+        // Walk to the tail of the chain and splice the whole chain onto the free list
+        Handle tail = handle;
+        uint32_t blockCount = 1;
+        while (m_nextBlock[tail] != InvalidHandle)
+        {
+            tail = m_nextBlock[tail];
+            ++blockCount;
+        }
+        m_nextBlock[tail] = m_freeHead;
+        m_freeHead = handle;
+        m_freeBlockCount += blockCount;
+    }
+
+    void PayloadSlab::Reset()
+    {
+        const uint32_t blockCount = GetBlockCount();
+        for (uint32_t block = 0; block < blockCount; ++block)
+        {
+            m_nextBlock[block] = (block + 1 < blockCount) ? block + 1 : InvalidHandle;
+        }
+        m_freeHead = (blockCount > 0) ? 0 : InvalidHandle;
+        m_freeBlockCount = blockCount;
+    }
+
+    uint32_t PayloadSlab::GetBlockCount() const
+    {
+        return static_cast<uint32_t>(m_nextBlock.size());
+    }
+
+    uint32_t PayloadSlab::GetFreeBlockCount() const
+    {
+        return m_freeBlockCount;
+    }
+
+    uint32_t PayloadSlab::GetRequiredBlockCount(uint32_t size)
+    {
+        // Empty payloads still occupy a block so they have a valid handle
+        return AZ::GetMax(1u, (size + BlockSize - 1) / BlockSize);
+    }
+
+    bool PayloadSlab::Grow(uint32_t requiredFreeBlocks)
+    {
+        const uint32_t blockCount = GetBlockCount();
+        const uint32_t minBlockCount = blockCount + (requiredFreeBlocks - m_freeBlockCount);
+        if (minBlockCount > m_maxBlockCount)
+        {
+            return false;
+        }
+
+        uint32_t newBlockCount = AZ::GetMax(blockCount * 2, InitialBlockCount);
+        newBlockCount = AZ::GetMin(AZ::GetMax(newBlockCount, minBlockCount), m_maxBlockCount);
+
+        m_blockData.resize_no_construct(static_cast<size_t>(newBlockCount) * BlockSize);
+        m_nextBlock.resize_no_construct(newBlockCount);
+
+        // New blocks are pushed onto the front of the free list
+        for (uint32_t block = blockCount; block < newBlockCount; ++block)
+        {
+            m_nextBlock[block] = (block + 1 < newBlockCount) ? block + 1 : m_freeHead;
+        }
+        m_freeHead = blockCount;
+        m_freeBlockCount += newBlockCount - blockCount;
+        return true;
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+
+namespace AzNetworking
+{
+    //! @class PayloadSlab
+    //! @brief Pool of fixed size blocks for storing variable sized byte payloads without per payload allocations.
+    //!
+    //! A payload is stored as a chain of blocks, freed blocks are returned to an intrusive free list and reused by
+    //! subsequent payloads. The pool only allocates when it runs out of free blocks, at which point it doubles in size,
+    //! so a connection that has reached its steady state working set stores and frees payloads without allocating.
+    class PayloadSlab
+    {
+    public:
+
+        using Handle = uint32_t;
+        static constexpr Handle InvalidHandle = 0xFFFFFFFF;
+        static constexpr uint32_t BlockSize = 256;
+
+        //! Constructor.
+        //! @param maxBlockCount the maximum number of blocks the slab may grow to
+        explicit PayloadSlab(uint32_t maxBlockCount = 0x10000);
+        ~PayloadSlab() = default;
+
+        //! Stores a copy of the provided payload.
+        //! @param data pointer to the payload to store
+        //! @param size size of the payload in bytes
+        //! @return handle to the stored payload, InvalidHandle if the slab is exhausted
+        Handle Store(const uint8_t* data, uint32_t size);
+
+        //! Copies a stored payload out of the slab.
+        //! @param handle   the handle returned by Store()
+        //! @param size     the size the payload was stored with
+        //! @param outData  the buffer to copy the payload into, must be at least size bytes
+        void Load(Handle handle, uint32_t size, uint8_t* outData) const;
+
+        //! Returns the data stored in a single block of a payload.
+        //! @param block the handle of the block, initially the handle returned by Store()
+        //! @return pointer to the BlockSize bytes of the block
+        const uint8_t* GetBlockData(Handle block) const;
+
+        //! Returns the next block in a payload chain.
+        //! @param block the handle of the current block
+        //! @return the handle of the next block, InvalidHandle at the end of the payload
+        Handle GetNextBlock(Handle block) const;
+
+        //! Releases a stored payload, returning its blocks to the free list.
+        //! @param handle the handle returned by Store()
+        void Free(Handle handle);
+
+        //! Releases all stored payloads, retaining the allocated blocks for reuse.
+        void Reset();
+
+        //! Returns the total number of blocks currently allocated.
+        //! @return the total number of blocks currently allocated
+        uint32_t GetBlockCount() const;
+
+        //! Returns the number of blocks currently available for reuse.
+        //! @return the number of blocks currently available for reuse
+        uint32_t GetFreeBlockCount() const;
+
+        //! Returns the number of blocks required to store a payload of the provided size.
+        //! @param size size of the payload in bytes
+        //! @return the number of blocks required to store the payload
+        static uint32_t GetRequiredBlockCount(uint32_t size);
+
+    private:
+
+        bool Grow(uint32_t requiredFreeBlocks);
+
+        AZStd::vector<uint8_t> m_blockData;
+        AZStd::vector<Handle> m_nextBlock;
+        Handle m_freeHead = InvalidHandle;
+        uint32_t m_freeBlockCount = 0;
+        uint32_t m_maxBlockCount;
+    };
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace AzNetworking
+{
+    //! Bitstream helpers shared by the bit packed network serializers.
+    //! Bits are written least significant bit first, so the encoded stream is independent of host endianness.
+    namespace BitPacking
+    {
+        //! Returns the number of bits required to represent every value in the range [0, valueRange].
+        //! @param valueRange the largest value that needs to be represented
+        //! @return the number of bits required, 0 if the range only contains a single value
+        uint32_t GetRequiredBitsForRange(uint64_t valueRange);
+
+        //! Returns the number of bytes required to hold the provided number of bits.
+        //! @param bitCount the number of bits
+        //! @return the number of bytes required to hold bitCount bits
+        uint32_t BitsToBytes(uint64_t bitCount);
+
+        //! Writes the low bits of a value into a buffer at the provided bit position.
+        //! @param buffer           the buffer to write to
+        //! @param bufferCapacity   the capacity of the buffer in bytes
+        //! @param inOutBitPosition the bit position to write at, advanced by bitCount on success
+        //! @param value            the value to write
+        //! @param bitCount         the number of low bits of value to write, at most 64
+        //! @return boolean true on success, false if the buffer was too small
+        bool WriteBits(uint8_t* buffer, uint32_t bufferCapacity, uint64_t& inOutBitPosition, uint64_t value, uint32_t bitCount);
+
+        //! Reads a value from a buffer at the provided bit position.
+        //! @param buffer           the buffer to read from
+        //! @param bufferCapacity   the capacity of the buffer in bytes
+        //! @param inOutBitPosition the bit position to read from, advanced by bitCount on success
+        //! @param outValue         the value read from the buffer
+        //! @param bitCount         the number of bits to read, at most 64
+        //! @return boolean true on success, false if the buffer did not contain enough data
+        bool ReadBits(const uint8_t* buffer, uint32_t bufferCapacity, uint64_t& inOutBitPosition, uint64_t& outValue, uint32_t bitCount);
+    }
+}
+
+#include <AzNetworking/Serialization/BitPacking.inl>
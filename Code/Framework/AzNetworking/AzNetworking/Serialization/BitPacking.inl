@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/MathUtils.h>
+
+namespace AzNetworking
+{
+    namespace BitPacking
+    {
+        inline uint32_t GetRequiredBitsForRange(uint64_t valueRange)
+        {
+            return (valueRange > 0) ? 64 - static_cast<uint32_t>(az_clz_u64(valueRange)) : 0;
+        }
+
+        inline uint32_t BitsToBytes(uint64_t bitCount)
+        {
+            return static_cast<uint32_t>((bitCount + 7) >> 3);
+        }
+
+        inline bool WriteBits(uint8_t* buffer, uint32_t bufferCapacity, uint64_t& inOutBitPosition, uint64_t value, uint32_t bitCount)
+        {
+            if (inOutBitPosition + bitCount > static_cast<uint64_t>(bufferCapacity) * 8)
+            {
+                return false;
+            }
+
+            uint64_t bitPosition = inOutBitPosition;
+            uint32_t remainingBits = bitCount;
+            while (remainingBits > 0)
+            {
+                const uint32_t bitOffset = static_cast<uint32_t>(bitPosition & 7);
+                const uint32_t writeCount = AZ::GetMin(8 - bitOffset, remainingBits);
+                const uint8_t mask = static_cast<uint8_t>(((1u << writeCount) - 1) << bitOffset);
+                uint8_t& target = buffer[bitPosition >> 3];
+                target = static_cast<uint8_t>((target & ~mask) | ((static_cast<uint8_t>(value) << bitOffset) & mask));
+                value >>= writeCount;
+                bitPosition += writeCount;
+                remainingBits -= writeCount;
+            }
+            inOutBitPosition = bitPosition;
+            return true;
+        }
+
+        inline bool ReadBits(const uint8_t* buffer, uint32_t bufferCapacity, uint64_t& inOutBitPosition, uint64_t& outValue, uint32_t bitCount)
+        {
+            if (inOutBitPosition + bitCount > static_cast<uint64_t>(bufferCapacity) * 8)
+            {
+                return false;
+            }
+
+            uint64_t result = 0;
+            uint64_t bitPosition = inOutBitPosition;
+            uint32_t readBits = 0;
+            while (readBits < bitCount)
+            {
+                const uint32_t bitOffset = static_cast<uint32_t>(bitPosition & 7);
+                const uint32_t readCount = AZ::GetMin(8 - bitOffset, bitCount - readBits);
+                const uint64_t bits = (buffer[bitPosition >> 3] >> bitOffset) & ((1u << readCount) - 1);
+                result |= bits << readBits;
+                bitPosition += readCount;
+                readBits += readCount;
+            }
+            inOutBitPosition = bitPosition;
+            outValue = result;
+            return true;
+        }
+    }
+}
@@ -21,6 +21,16 @@ namespace AzNetworking
         WriteToObject
     };
 
+    //! Controls how network serializers lay out values in their bytestream.
+    //! ByteAligned writes every value as a whole number of bytes.
+    //! BitPacked writes booleans as a single bit and bounded integers using only the bits needed for their range.
+    //! Both endpoints must agree on the packing used for a given buffer.
+    enum class SerializerPacking
+    {
+        ByteAligned,
+        BitPacked
+    };
+
     //! @class ISerializer
     //! @brief Interface class for all serializers to derive from.
     //!
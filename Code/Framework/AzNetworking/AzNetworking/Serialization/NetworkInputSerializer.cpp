@@ -7,6 +7,7 @@
  */
 
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/BitPacking.h>
 #include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzNetworking/Utilities/Endian.h>
 #include <AzNetworking/Utilities/NetworkIncludes.h>
@@ -14,10 +15,11 @@
 
 namespace AzNetworking
 {
-    NetworkInputSerializer::NetworkInputSerializer(uint8_t* buffer, uint32_t bufferCapacity)
+    NetworkInputSerializer::NetworkInputSerializer(uint8_t* buffer, uint32_t bufferCapacity, SerializerPacking packing)
         : m_bufferSize(0)
         , m_bufferCapacity(bufferCapacity)
         , m_buffer(buffer)
+        , m_packing(packing)
     {
         ;
     }
@@ -30,6 +32,10 @@ namespace AzNetworking
     bool NetworkInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
     {
         uint8_t serializeValue = (value) ? 1 : 0;
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            return SerializeBits(serializeValue, 1);
+        }
         return SerializeBytes((const uint8_t*)&serializeValue, sizeof(uint8_t));
     }
 
@@ -81,6 +87,10 @@ namespace AzNetworking
     bool NetworkInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
     {
         uint32_t hostOrder = *reinterpret_cast<uint32_t*>(&value);
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            return SerializeBits(hostOrder, 32);
+        }
         uint32_t networkOrder = ntohl(hostOrder);
         return SerializeBytes((const uint8_t*)&networkOrder, sizeof(float));
     }
@@ -88,6 +98,10 @@ namespace AzNetworking
     bool NetworkInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
     {
         uint64_t hostOrder = *reinterpret_cast<uint64_t*>(&value);
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            return SerializeBits(hostOrder, 64);
+        }
         uint64_t networkOrder = ntohll(hostOrder);
         return SerializeBytes((const uint8_t*)&networkOrder, sizeof(double));
     }
@@ -128,7 +142,11 @@ namespace AzNetworking
         m_serializerValid &= (inputValue >= minValue);
         m_serializerValid &= (inputValue <= maxValue);
         const uint64_t valueRange = static_cast<uint64_t>(maxValue - minValue);
-        if (valueRange <= AZStd::numeric_limits<uint8_t>::max())
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            return m_serializerValid && SerializeBits(static_cast<uint64_t>(inputValue - minValue), BitPacking::GetRequiredBitsForRange(valueRange));
+        }
+        else if (valueRange <= AZStd::numeric_limits<uint8_t>::max())
         {
             return SerializeBoundedValueHelper<uint8_t>(static_cast<uint8_t>(inputValue - minValue));
         }
@@ -172,6 +190,18 @@ namespace AzNetworking
 
     bool NetworkInputSerializer::SerializeBytes(const uint8_t* data, uint32_t count)
     {
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                if (!SerializeBits(data[index], 8))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         const uint32_t currSize = m_bufferSize;
         const uint32_t nextSize = m_bufferSize + count;
 
@@ -187,4 +217,17 @@ namespace AzNetworking
         m_bufferSize += count;
         return true;
     }
+
+    bool NetworkInputSerializer::SerializeBits(uint64_t value, uint32_t bitCount)
+    {
+        if (!m_serializerValid || !BitPacking::WriteBits(const_cast<uint8_t*>(m_buffer), m_bufferCapacity, m_bitPosition, value, bitCount))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        m_bufferSize = BitPacking::BitsToBytes(m_bitPosition);
+        return true;
+    }
 }
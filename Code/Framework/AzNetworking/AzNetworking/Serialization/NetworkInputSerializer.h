@@ -22,7 +22,12 @@ namespace AzNetworking
         //! Constructor.
         //! @param buffer         input buffer to write to
         //! @param bufferCapacity capacity of the buffer in bytes
-        NetworkInputSerializer(uint8_t* buffer, uint32_t bufferCapacity);
+        //! @param packing        layout of values within the bytestream, must match the packing of the reading serializer
+        NetworkInputSerializer(uint8_t* buffer, uint32_t bufferCapacity, SerializerPacking packing = SerializerPacking::ByteAligned);
+
+        //! Returns the packing used to lay out values in the bytestream.
+        //! @return the packing used to lay out values in the bytestream
+        SerializerPacking GetPacking() const;
 
         //! Copies the provided bytes into the serialization output buffer.
         //! @param data     pointer to the data buffer to copy
@@ -67,10 +72,13 @@ namespace AzNetworking
         bool SerializeBoundedValueHelper(SERIALIZE_TYPE serializeValue);
 
         bool SerializeBytes(const uint8_t* data, uint32_t count);
+        bool SerializeBits(uint64_t value, uint32_t bitCount);
 
         uint32_t       m_bufferSize = 0;
         const uint32_t m_bufferCapacity;
         const uint8_t* m_buffer;
+        uint64_t       m_bitPosition = 0;
+        const SerializerPacking m_packing;
     };
 }
 
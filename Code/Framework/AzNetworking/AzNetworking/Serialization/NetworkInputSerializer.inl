@@ -14,4 +14,9 @@ namespace AzNetworking
     {
         return SerializeBytes(data, dataSize);
     }
+
+    inline SerializerPacking NetworkInputSerializer::GetPacking() const
+    {
+        return m_packing;
+    }
 }
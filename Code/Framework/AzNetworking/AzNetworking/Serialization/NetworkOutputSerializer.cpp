@@ -7,16 +7,18 @@
  */
 
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/BitPacking.h>
 #include <AzNetworking/AzNetworking_Traits_Platform.h>
 #include <AzNetworking/Utilities/Endian.h>
 #include <AzNetworking/Utilities/NetworkIncludes.h>
 
 namespace AzNetworking
 {
-    NetworkOutputSerializer::NetworkOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity)
+    NetworkOutputSerializer::NetworkOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity, SerializerPacking packing)
         : m_bufferPosition(0)
         , m_bufferCapacity(bufferCapacity)
         , m_buffer(buffer)
+        , m_packing(packing)
     {
         ;
     }
@@ -28,6 +30,14 @@ namespace AzNetworking
 
     bool NetworkOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
     {
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            uint64_t bitValue = 0;
+            SerializeBits(bitValue, 1);
+            value = (bitValue > 0);
+            return m_serializerValid;
+        }
+
         uint8_t byteValue = 0;
         SerializeBytes((uint8_t*)&byteValue, sizeof(byteValue));
         value = (byteValue > 0);
@@ -82,8 +92,18 @@ namespace AzNetworking
     bool NetworkOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, [[maybe_unused]] float minValue, [[maybe_unused]] float maxValue)
     {
         uint32_t networkOrder = 0;
-        m_serializerValid &= SerializeBytes((uint8_t*)&networkOrder, sizeof(float));
-        networkOrder = ntohl(networkOrder);
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            // Bit packed streams are written least significant bit first, no byte swapping required
+            uint64_t bitValue = 0;
+            m_serializerValid &= SerializeBits(bitValue, 32);
+            networkOrder = static_cast<uint32_t>(bitValue);
+        }
+        else
+        {
+            m_serializerValid &= SerializeBytes((uint8_t*)&networkOrder, sizeof(float));
+            networkOrder = ntohl(networkOrder);
+        }
         value = m_serializerValid ? *reinterpret_cast<float*>(&networkOrder) : value;
         return m_serializerValid;
     }
@@ -91,8 +111,15 @@ namespace AzNetworking
     bool NetworkOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
     {
         uint64_t networkOrder = 0;
-        m_serializerValid &= SerializeBytes((uint8_t *)&networkOrder, sizeof(double));
-        networkOrder = ntohll(networkOrder);
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            m_serializerValid &= SerializeBits(networkOrder, 64);
+        }
+        else
+        {
+            m_serializerValid &= SerializeBytes((uint8_t *)&networkOrder, sizeof(double));
+            networkOrder = ntohll(networkOrder);
+        }
         value = m_serializerValid ? *reinterpret_cast<double*>(&networkOrder) : value;
         return m_serializerValid;
     }
@@ -131,7 +158,14 @@ namespace AzNetworking
     bool NetworkOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
     {
         const uint64_t valueRange = static_cast<uint64_t>(maxValue - minValue);
-        if (valueRange <= AZStd::numeric_limits<uint8_t>::max())
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            uint64_t result = 0;
+            m_serializerValid &= SerializeBits(result, BitPacking::GetRequiredBitsForRange(valueRange));
+            m_serializerValid &= (result <= valueRange);
+            outValue = m_serializerValid ? static_cast<ORIGINAL_TYPE>(static_cast<ORIGINAL_TYPE>(result) + minValue) : outValue;
+        }
+        else if (valueRange <= AZStd::numeric_limits<uint8_t>::max())
         {
             outValue = static_cast<ORIGINAL_TYPE>(SerializeBoundedValueHelper<uint8_t>(static_cast<uint8_t>(maxValue - minValue))) + minValue;
         }
@@ -182,6 +216,20 @@ namespace AzNetworking
 
     bool NetworkOutputSerializer::SerializeBytes(uint8_t* data, uint32_t count)
     {
+        if (m_packing == SerializerPacking::BitPacked)
+        {
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                uint64_t byteValue = 0;
+                if (!SerializeBits(byteValue, 8))
+                {
+                    return false;
+                }
+                data[index] = static_cast<uint8_t>(byteValue);
+            }
+            return true;
+        }
+
         const uint32_t currSize = m_bufferPosition;
         const uint32_t nextSize = m_bufferPosition + count;
 
@@ -197,4 +245,17 @@ namespace AzNetworking
         m_bufferPosition += count;
         return true;
     }
+
+    bool NetworkOutputSerializer::SerializeBits(uint64_t& outValue, uint32_t bitCount)
+    {
+        if (!m_serializerValid || !BitPacking::ReadBits(m_buffer, m_bufferCapacity, m_bitPosition, outValue, bitCount))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        m_bufferPosition = BitPacking::BitsToBytes(m_bitPosition);
+        return true;
+    }
 }
@@ -22,7 +22,12 @@ namespace AzNetworking
         //! Constructor.
         //! @param buffer         output buffer to read from
         //! @param bufferCapacity capacity of the buffer in bytes
-        NetworkOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity);
+        //! @param packing        layout of values within the bytestream, must match the packing of the writing serializer
+        NetworkOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity, SerializerPacking packing = SerializerPacking::ByteAligned);
+
+        //! Returns the packing used to lay out values in the bytestream.
+        //! @return the packing used to lay out values in the bytestream
+        SerializerPacking GetPacking() const;
 
         //! Returns the unread portion of the data stream.
         //! @return the unread portion of the data stream
@@ -73,10 +78,13 @@ namespace AzNetworking
         SERIALIZE_TYPE SerializeBoundedValueHelper(SERIALIZE_TYPE maxValue);
 
         bool SerializeBytes(uint8_t* data, uint32_t count);
+        bool SerializeBits(uint64_t& outValue, uint32_t bitCount);
 
         uint32_t       m_bufferPosition = 0;
         const uint32_t m_bufferCapacity;
         const uint8_t* m_buffer;
+        uint64_t       m_bitPosition = 0;
+        const SerializerPacking m_packing;
     };
 }
 
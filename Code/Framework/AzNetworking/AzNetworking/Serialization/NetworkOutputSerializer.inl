@@ -24,4 +24,9 @@ namespace AzNetworking
     {
         return m_bufferPosition;
     }
+
+    inline SerializerPacking NetworkOutputSerializer::GetPacking() const
+    {
+        return m_packing;
+    }
 }
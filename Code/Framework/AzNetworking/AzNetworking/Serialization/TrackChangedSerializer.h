@@ -24,7 +24,8 @@ namespace AzNetworking
         //! Constructor.
         //! @param buffer         output buffer to read from
         //! @param bufferCapacity capacity of the buffer in bytes
-        TrackChangedSerializer(const uint8_t* buffer, uint32_t bufferCapacity);
+        //! @param packing        layout of values within the bytestream
+        TrackChangedSerializer(const uint8_t* buffer, uint32_t bufferCapacity, SerializerPacking packing = SerializerPacking::ByteAligned);
 
         // ISerializer interfaces
         SerializerMode GetSerializerMode() const override;
@@ -11,8 +11,8 @@
 namespace AzNetworking
 {
     template <typename BASE_TYPE>
-    TrackChangedSerializer<BASE_TYPE>::TrackChangedSerializer(const uint8_t* buffer, uint32_t bufferCapacity)
-        : BASE_TYPE(buffer, bufferCapacity)
+    TrackChangedSerializer<BASE_TYPE>::TrackChangedSerializer(const uint8_t* buffer, uint32_t bufferCapacity, SerializerPacking packing)
+        : BASE_TYPE(buffer, bufferCapacity, packing)
         , m_hasChanged(false)
     {
         ;
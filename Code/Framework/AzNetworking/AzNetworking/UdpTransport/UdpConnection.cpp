@@ -162,8 +162,7 @@ namespace AzNetworking
         }
     }
 
-    void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] const IPacket& packet, 
-        uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
+    void UdpConnection::ProcessSent(PacketId packetId, uint32_t packetSize, [[maybe_unused]] ReliabilityType reliability)
     {
         const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
@@ -100,17 +100,19 @@ namespace AzNetworking
     protected:
 
         //! Prepare a reliable packet for transmission.
-        //! @param packetId identifier of the packet being sent
-        //! @param packet   reference to the packet being transmitted
+        //! @param packetId           identifier of the packet being sent
+        //! @param reliableSequenceId reliable sequence number of the packet being sent
+        //! @param packetType         type of the packet being sent
+        //! @param payload            pointer to the serialized packet payload, retained in case the packet needs to be resent
+        //! @param payloadSize        size of the serialized packet payload in bytes
         //! @return boolean true on success, false on failure
-        bool PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const uint8_t* payload, uint32_t payloadSize);
 
         //! Process a packet for sending.
         //! @param packetId   identifier of the packet being sent
-        //! @param packet     reference to the packet being transmitted
         //! @param packetSize packet size in bytes
         //! @param reliability whether or not to guarantee delivery
-        void ProcessSent(PacketId packetId, const IPacket& packet, uint32_t packetSize, ReliabilityType reliability);
+        void ProcessSent(PacketId packetId, uint32_t packetSize, ReliabilityType reliability);
 
         //! Process a timed out packet header.
         //! @param packetId    identifier of the packet that timed out
@@ -27,7 +27,12 @@ namespace AzNetworking
     {
         m_timeoutQueue.Reset();
         m_sequenceGenerator.Reset();
-        m_packetFragments.clear();
+        for (PacketFragments& slot : m_packetFragments)
+        {
+            slot.m_fragmentSequence = InvalidSequenceId;
+            slot.m_hasTimeout = false;
+        }
+        m_chunkSlab.Reset();
         m_latestReceivedFragmentSequence = InvalidSequenceId;
         m_deliveredFragments.Reset();
     }
@@ -39,16 +44,16 @@ namespace AzNetworking
 
     PacketDispatchResult UdpFragmentQueue::ProcessReceivedChunk(UdpConnection* connection, IConnectionListener& connectionListener, UdpPacketHeader& header, ISerializer& serializer)
     {
-        AZStd::unique_ptr<CorePackets::FragmentedPacket> packet = AZStd::make_unique<CorePackets::FragmentedPacket>();
+        CorePackets::FragmentedPacket packet;
 
-        if (!serializer.Serialize(*packet, "Packet"))
+        if (!serializer.Serialize(packet, "Packet"))
         {
             AZLOG(NET_FragmentQueue, "Fragment failed serialization");
             return PacketDispatchResult::Failure;
         }
 
         const bool isReliable = header.GetIsReliable();
-        const SequenceId fragmentSequence = packet->GetFragmentSequence();
+        const SequenceId fragmentSequence = packet.GetFragmentSequence();
 
         if (SequenceMoreRecent(fragmentSequence, m_latestReceivedFragmentSequence))
         {
@@ -73,65 +78,80 @@ namespace AzNetworking
             return PacketDispatchResult::Success;
         }
 
-        const uint32_t chunkCount = packet->GetChunkCount();
-        const uint32_t chunkIndex = packet->GetChunkIndex();
-
-        // If this is the first time we've heard about this sequence, resize the vector appropriately
-        const bool isNewPacketFragment = m_packetFragments.find(fragmentSequence) == m_packetFragments.end();
-        PacketFragments& packetFragments = m_packetFragments[fragmentSequence];
+        const uint32_t chunkCount = packet.GetChunkCount();
+        const uint32_t chunkIndex = packet.GetChunkIndex();
 
-        if (isNewPacketFragment)
+        if ((chunkCount > MaxChunksPerFragmentedPacket) || (chunkIndex >= chunkCount))
         {
-            packetFragments.resize(chunkCount);
+            AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u", chunkIndex, chunkCount);
+            return PacketDispatchResult::Failure;
         }
 
-        if ((chunkCount != packetFragments.size()) || (chunkIndex >= chunkCount))
+        // If this is the first time we've heard about this sequence, claim a reassembly slot for it
+        bool isNewPacketFragment = false;
+        PacketFragments& packetFragments = FindOrClaimSlot(fragmentSequence, chunkCount, isNewPacketFragment);
+
+        if (chunkCount != packetFragments.m_chunkCount)
         {
-            // Either we disagree on the number of chunks, or chunkIndex is bigger than the expected size, bail and disconnect
-            AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, reservedSize %u", chunkIndex, chunkCount, static_cast<uint32_t>(packetFragments.size()));
+            // We disagree on the number of chunks, bail and disconnect
+            AZLOG(NET_FragmentQueue, "Malformed chunk metadata in fragmented packet, chunkIndex %u, chunkCount %u, reservedSize %u", chunkIndex, chunkCount, packetFragments.m_chunkCount);
             return PacketDispatchResult::Failure;
         }
 
-        packetFragments[chunkIndex] = AZStd::move(packet);
-
-        uint32_t totalPacketSize = 0;
-        for (uint32_t index = 0; index < packetFragments.size(); ++index)
+        if (packetFragments.m_chunkHandles[chunkIndex] == PayloadSlab::InvalidHandle)
         {
-            if (packetFragments[index] == nullptr)
+            const ChunkBuffer& chunkBuffer = packet.GetChunkBuffer();
+            const uint32_t chunkSize = static_cast<uint32_t>(chunkBuffer.GetSize());
+            const PayloadSlab::Handle chunkHandle = m_chunkSlab.Store(chunkBuffer.GetBuffer(), chunkSize);
+            if (chunkHandle == PayloadSlab::InvalidHandle)
             {
-                if (!isReliable)
-                {
-                    m_timeoutQueue.RegisterItem(static_cast<uint64_t>(fragmentSequence), net_UdpFragmentTimeoutMs);
-                }
+                AZLOG_ERROR("Fragment queue payload storage exhausted, unable to retain chunk %u of fragmented packet %u", chunkIndex, static_cast<uint32_t>(fragmentSequence));
+                return PacketDispatchResult::Failure;
+            }
+            packetFragments.m_chunkHandles[chunkIndex] = chunkHandle;
+            packetFragments.m_chunkSizes[chunkIndex] = static_cast<uint16_t>(chunkSize);
+            ++packetFragments.m_receivedChunkCount;
+        }
 
-                // We haven't received all chunks required to complete this packet yet
-                return PacketDispatchResult::Success;
+        if (packetFragments.m_receivedChunkCount < packetFragments.m_chunkCount)
+        {
+            if (isNewPacketFragment && !isReliable)
+            {
+                packetFragments.m_timeoutId = m_timeoutQueue.RegisterItem(static_cast<uint64_t>(fragmentSequence), net_UdpFragmentTimeoutMs);
+                packetFragments.m_hasTimeout = true;
             }
 
-            totalPacketSize += static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
+            // We haven't received all chunks required to complete this packet yet
+            return PacketDispatchResult::Success;
         }
 
         // We now mark this sequence as delivered, so if by some chance all the individual chunks get redelivered again we don't double deliver the reconstructed packet
         m_deliveredFragments.SetBit(static_cast<uint32_t>(sequenceDelta), true);
 
+        uint32_t totalPacketSize = 0;
+        for (uint32_t index = 0; index < packetFragments.m_chunkCount; ++index)
+        {
+            totalPacketSize += packetFragments.m_chunkSizes[index];
+        }
+
         // All chunks have been received, reconstruct the original packet and deliver to the connection listener
         UdpPacketEncodingBuffer buffer;
         if (!buffer.Resize(totalPacketSize))
         {
             AZLOG_ERROR("Fragmented packet is too large to fit in UdpPacketEncodingBuffer");
+            ReleaseSlot(packetFragments);
             return PacketDispatchResult::Failure;
         }
 
         uint8_t* bufferPointer = buffer.GetBuffer();
-        for (uint32_t index = 0; index < packetFragments.size(); ++index)
+        for (uint32_t index = 0; index < packetFragments.m_chunkCount; ++index)
         {
-            const uint32_t chunkSize = static_cast<uint32_t>(packetFragments[index]->GetChunkBuffer().GetSize());
-            memcpy(bufferPointer, packetFragments[index]->GetChunkBuffer().GetBuffer(), chunkSize);
-            bufferPointer += chunkSize;
+            m_chunkSlab.Load(packetFragments.m_chunkHandles[index], packetFragments.m_chunkSizes[index], bufferPointer);
+            bufferPointer += packetFragments.m_chunkSizes[index];
         }
 
-        // We can erase all the chunks now, packet is completed
-        m_packetFragments.erase(fragmentSequence);
+        // We can release all the chunks now, packet is completed
+        ReleaseSlot(packetFragments);
 
         NetworkOutputSerializer networkSerializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
         {
@@ -164,11 +184,67 @@ namespace AzNetworking
         return handledPacket;
     }
 
+    UdpFragmentQueue::PacketFragments& UdpFragmentQueue::FindOrClaimSlot(SequenceId fragmentSequence, uint32_t chunkCount, bool& isNew)
+    {
+        PacketFragments* freeSlot = nullptr;
+        for (PacketFragments& slot : m_packetFragments)
+        {
+            if (slot.m_fragmentSequence == fragmentSequence)
+            {
+                isNew = false;
+                return slot;
+            }
+            if ((freeSlot == nullptr) && (slot.m_fragmentSequence == InvalidSequenceId))
+            {
+                freeSlot = &slot;
+            }
+        }
+
+        // Slots are only ever added, so once enough fragmented packets have been in flight at once there are no further allocations
+        if (freeSlot == nullptr)
+        {
+            freeSlot = &m_packetFragments.emplace_back();
+        }
+
+        isNew = true;
+        freeSlot->m_fragmentSequence = fragmentSequence;
+        freeSlot->m_hasTimeout = false;
+        freeSlot->m_chunkCount = chunkCount;
+        freeSlot->m_receivedChunkCount = 0;
+        freeSlot->m_chunkHandles.fill(PayloadSlab::InvalidHandle);
+        return *freeSlot;
+    }
+
+    void UdpFragmentQueue::ReleaseSlot(PacketFragments& slot)
+    {
+        for (uint32_t index = 0; index < slot.m_chunkCount; ++index)
+        {
+            m_chunkSlab.Free(slot.m_chunkHandles[index]);
+        }
+
+        if (slot.m_hasTimeout)
+        {
+            m_timeoutQueue.RemoveItem(slot.m_timeoutId);
+        }
+
+        slot.m_fragmentSequence = InvalidSequenceId;
+        slot.m_hasTimeout = false;
+    }
+
     TimeoutResult UdpFragmentQueue::HandleTimeout(TimeoutQueue::TimeoutItem& item)
     {
-        const SequenceId fragmentSequence = static_cast<SequenceId>(item.m_userData & 0xFF);
+        const SequenceId fragmentSequence = static_cast<SequenceId>(item.m_userData);
         AZLOG(NET_FragmentQueue, "Timing out unreliable fragmented packet %u", static_cast<uint32_t>(fragmentSequence));
-        m_packetFragments.erase(fragmentSequence);
+        for (PacketFragments& slot : m_packetFragments)
+        {
+            if (slot.m_fragmentSequence == fragmentSequence)
+            {
+                // The timeout item is deleted by returning TimeoutResult::Delete, so it must not be removed here
+                slot.m_hasTimeout = false;
+                ReleaseSlot(slot);
+                break;
+            }
+        }
         return TimeoutResult::Delete;
     }
 }
@@ -12,10 +12,12 @@
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
+#include <AzNetworking/DataStructures/PayloadSlab.h>
 #include <AzNetworking/DataStructures/RingBufferBitset.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
@@ -25,12 +27,18 @@ namespace AzNetworking
 
     //! @class UdpFragmentQueue
     //! @brief Class for reconstructing packet chunks into the original unsegmented packet.
+    //!
+    //! Received chunks are copied into a per connection PayloadSlab and tracked in reusable reassembly slots, so
+    //! reassembling fragmented packets does not allocate once the queue has reached its steady state working set.
     class UdpFragmentQueue
         : public ITimeoutHandler
     {
 
     public:
 
+        //! The maximum number of chunks a single fragmented packet may be split into.
+        static constexpr uint32_t MaxChunksPerFragmentedPacket = 64;
+
         //! Updates the UdpFragmentQueue timeout queue.
         void Update();
 
@@ -55,11 +63,33 @@ namespace AzNetworking
         //! @return ETimeoutResult for whether to re-register or discard the timeout params
         virtual TimeoutResult HandleTimeout(TimeoutQueue::TimeoutItem& item) override;
 
+        struct PacketFragments
+        {
+            SequenceId m_fragmentSequence = InvalidSequenceId;
+            TimeoutId m_timeoutId = TimeoutId{ 0 };
+            bool m_hasTimeout = false; //!< Only incomplete unreliable fragmented packets are timed out
+            uint32_t m_chunkCount = 0;
+            uint32_t m_receivedChunkCount = 0;
+            AZStd::array<PayloadSlab::Handle, MaxChunksPerFragmentedPacket> m_chunkHandles;
+            AZStd::array<uint16_t, MaxChunksPerFragmentedPacket> m_chunkSizes;
+        };
+
+        //! Returns the reassembly slot for the provided fragment sequence, claiming a free slot if none is in use.
+        //! @param fragmentSequence the fragment sequence to look up
+        //! @param chunkCount       the number of chunks to reserve if a new slot is claimed
+        //! @param isNew            set to true if a new slot was claimed
+        //! @return reference to the reassembly slot
+        PacketFragments& FindOrClaimSlot(SequenceId fragmentSequence, uint32_t chunkCount, bool& isNew);
+
+        //! Releases a reassembly slot and any chunk payloads it holds.
+        //! @param slot the slot to release
+        void ReleaseSlot(PacketFragments& slot);
+
         TimeoutQueue m_timeoutQueue;
         SequenceGenerator m_sequenceGenerator;
 
-        using PacketFragments = AZStd::vector<AZStd::unique_ptr<CorePackets::FragmentedPacket>>;
-        AZStd::unordered_map<SequenceId, PacketFragments> m_packetFragments;
+        AZStd::vector<PacketFragments> m_packetFragments;
+        PayloadSlab m_chunkSlab;
 
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
@@ -11,6 +11,8 @@
 #include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/DtlsSocket.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/UdpTransport/UdpPacketCapture.h>
+#include <AzNetworking/UdpTransport/UdpReplaySocket.h>
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Framework/ICompressor.h>
@@ -38,6 +40,10 @@ namespace AzNetworking
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
+    AZ_CVAR(AZ::CVarFixedString, net_UdpCaptureFile, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If set, all datagrams on each Udp interface are captured to <value>.<interface name>.azcap, must be set before the interface is created");
+    AZ_CVAR(AZ::CVarFixedString, net_UdpReplayFile, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If set, the interface named by net_UdpReplayInterface receives datagrams from this capture file instead of the network, must be set before the interface is created");
+    AZ_CVAR(AZ::CVarFixedString, net_UdpReplayInterface, "MultiplayerNetworkInterface", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The name of the Udp interface that replays net_UdpReplayFile");
+    AZ_CVAR(AZ::TimeMs, net_UdpReplayStepMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Capture time to advance a replaying interface by on each update, 0 advances by the real frame time, any other value replays deterministically as fast as possible");
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
     {
@@ -65,11 +71,48 @@ namespace AzNetworking
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         const AZ::Name compressorName = AZ::Name(compressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+
+        const AZ::CVarFixedString replayFile = static_cast<AZ::CVarFixedString>(net_UdpReplayFile);
+        const AZ::CVarFixedString replayInterface = static_cast<AZ::CVarFixedString>(net_UdpReplayInterface);
+        if (!replayFile.empty() && (m_name == AZ::Name(replayInterface)))
+        {
+            // Captures are recorded below the encryption layer, so they can only be replayed into an unencrypted interface
+            if (m_socket->IsEncrypted())
+            {
+                AZLOG_ERROR("Packet replay is not supported on encrypted interfaces, disable net_UdpUseEncryption to replay %s", replayFile.c_str());
+            }
+            else
+            {
+                AZStd::unique_ptr<UdpReplaySocket> replaySocket = AZStd::make_unique<UdpReplaySocket>();
+                if (replaySocket->LoadCapture(replayFile.c_str()))
+                {
+                    AZLOG_INFO("Interface %s is replaying packet capture %s", m_name.GetCStr(), replayFile.c_str());
+                    m_replaySocket = replaySocket.get();
+                    m_socket = AZStd::move(replaySocket);
+                }
+            }
+        }
+
+        const AZ::CVarFixedString captureFile = static_cast<AZ::CVarFixedString>(net_UdpCaptureFile);
+        if (!captureFile.empty() && (m_replaySocket == nullptr))
+        {
+            const AZStd::string capturePath = AZStd::string::format("%s.%s.azcap", captureFile.c_str(), m_name.GetCStr());
+            m_packetCapture = AZStd::make_unique<UdpPacketCaptureWriter>();
+            if (m_packetCapture->Open(capturePath.c_str()))
+            {
+                m_socket->SetPacketCapture(m_packetCapture.get());
+            }
+            else
+            {
+                m_packetCapture.reset();
+            }
+        }
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
     {
         m_readerThread.UnregisterSocket(m_socket.get());
+        m_socket->SetPacketCapture(nullptr);
     }
 
     AZ::Name UdpNetworkInterface::GetName() const
@@ -114,7 +157,7 @@ namespace AzNetworking
         m_allowIncomingConnections = true;
         if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
-            m_readerThread.RegisterSocket(m_socket.get());
+            RegisterSocket();
             return true;
         }
         else
@@ -129,7 +172,7 @@ namespace AzNetworking
         {
             if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::False, m_trustZone))
             {
-                m_readerThread.RegisterSocket(m_socket.get());
+                RegisterSocket();
             }
             else
             {
@@ -159,7 +202,7 @@ namespace AzNetworking
         return connectionId;
     }
 
-    void UdpNetworkInterface::Update([[maybe_unused]] AZ::TimeMs deltaTimeMs)
+    void UdpNetworkInterface::Update(AZ::TimeMs deltaTimeMs)
     {
         if (!m_socket->IsOpen())
         {
@@ -167,7 +210,9 @@ namespace AzNetworking
         }
 
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
-        const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
+        const UdpReaderThread::ReceivedPackets* packets = (m_replaySocket != nullptr)
+            ? GatherReplayPackets(deltaTimeMs)
+            : m_readerThread.GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
         {
             // Socket is not yet registered with the reader thread and is likely still pending, try again later
@@ -180,7 +225,8 @@ namespace AzNetworking
             const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
 
             // Don't exceed our timeslice, even if unprocessed data remains
-            if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
+            // Replayed packets are never discarded, as that would make replay results depend on machine performance
+            if ((m_replaySocket == nullptr) && ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs))
             {
                 AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
                 GetMetrics().m_discardedPackets += packets->size() - i;
@@ -349,6 +395,40 @@ namespace AzNetworking
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
 
+    void UdpNetworkInterface::RegisterSocket()
+    {
+        // Replay sockets are fed directly from Update(), registering them with the reader thread would only race the replay
+        if (m_replaySocket == nullptr)
+        {
+            m_readerThread.RegisterSocket(m_socket.get());
+        }
+    }
+
+    const UdpReaderThread::ReceivedPackets* UdpNetworkInterface::GatherReplayPackets(AZ::TimeMs deltaTimeMs)
+    {
+        if (m_replayUpdateCount == 0)
+        {
+            m_replayStartTimeMs = AZ::GetElapsedTimeMs();
+        }
+
+        const AZ::TimeMs replayStepMs = net_UdpReplayStepMs;
+        m_replayPackets.clear();
+        m_replaySocket->GatherPackets((replayStepMs > AZ::TimeMs{ 0 }) ? replayStepMs : deltaTimeMs, m_replayPackets);
+
+        if (!m_replayReported)
+        {
+            ++m_replayUpdateCount;
+            if (m_replaySocket->IsReplayComplete())
+            {
+                const AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - m_replayStartTimeMs;
+                AZLOG_INFO("Interface %s finished replaying %u packets (%u bytes) over %u updates in %d ms",
+                    m_name.GetCStr(), m_socket->GetRecvPackets(), m_socket->GetRecvBytes(), m_replayUpdateCount, aznumeric_cast<int32_t>(elapsedTimeMs));
+                m_replayReported = true;
+            }
+        }
+        return &m_replayPackets;
+    }
+
     bool UdpNetworkInterface::SendReliablePacket(ConnectionId connectionId, const IPacket& packet)
     {
         IConnection* connection = m_connectionSet.GetConnection(connectionId);
@@ -463,12 +543,23 @@ namespace AzNetworking
 
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
-        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
+        return SendPacketInternal(connection, packet.GetPacketType(), &packet, nullptr, reliableSequence);
+    }
+
+    PacketId UdpNetworkInterface::ResendPacket(UdpConnection& connection, const PendingPacket& pendingPacket)
+    {
+        return SendPacketInternal(connection, pendingPacket.m_packetType, nullptr, &pendingPacket, pendingPacket.m_reliableSequenceId);
+    }
+
+    PacketId UdpNetworkInterface::SendPacketInternal(UdpConnection& connection, PacketType packetType, const IPacket* packet, const PendingPacket* pendingPacket, SequenceId reliableSequence)
+    {
+        AZ_Assert((packet != nullptr) != (pendingPacket != nullptr), "Exactly one of a packet or a pending packet must be provided");
+        AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packetType), connection.GetRemoteAddress().GetString().c_str());
 
         // The ordering inside this function is incredibly important and fragile
         const IpAddress& address = connection.GetRemoteAddress();
         // We don't want to compress the initial InitiateConnectionPacket, ConnectionHandshakePackets or FragmentedPackets of those two
-        const bool shouldCompress = packet.GetPacketType() != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
+        const bool shouldCompress = packetType != aznumeric_cast<PacketType>(CorePackets::PacketType::InitiateConnectionPacket);
 
         if (address.GetAddress(ByteOrder::Host) == 0)
         {
@@ -477,36 +568,12 @@ namespace AzNetworking
 
         const ReliabilityType reliabilityType = (reliableSequence == InvalidSequenceId) ? ReliabilityType::Unreliable : ReliabilityType::Reliable;
 
-        // Check if we need to fragment this packet first
-        // We don't ack aggregate packets that get fragmented, so we want to get this chunk out of the way before
-        // we start throwing PacketId's and SequenceId's into our other tracking data structures below
-        UdpPacketHeader header(connection.GetPacketTracker(), packet.GetPacketType(), reliableSequence);
+        UdpPacketHeader header(connection.GetPacketTracker(), packetType, reliableSequence);
         const PacketId localPacketId = header.GetPacketId();
 
-        // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
-        // not set up
-        if (reliabilityType == ReliabilityType::Reliable)
-        {
-            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packet))
-            {
-                connection.Disconnect(DisconnectReason::ReliableQueueFull, TerminationEndpoint::Local);
-            }
-        }
-
-        // If we're still connecting, only transmit packets related to establishing connection and queue the rest for later
-        // This implicitly enforces that the only FragmentedPackets sent here are of ConnectionHandshakePacket
-        // Other large packets are simply queued before they are fragmented
-        if (connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType()))
-        {
-            // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
-            RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            AZLOG(
-                NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
-                (int)packet.GetPacketType());
-            return localPacketId;
-        }
-
+        // Serialize first, so the reliable queue can retain the serialized payload rather than a copy of the packet
         UdpPacketEncodingBuffer buffer;
+        uint32_t payloadOffset = 0;
         {
             buffer.Resize(buffer.GetCapacity());
 
@@ -525,7 +592,11 @@ namespace AzNetworking
                 return InvalidPacketId;
             }
 
-            if (!serializer.Serialize(const_cast<IPacket&>(packet), "Payload"))
+            payloadOffset = serializer.GetSize();
+            const bool payloadSerialized = (packet != nullptr)
+                ? serializer.Serialize(const_cast<IPacket&>(*packet), "Payload")
+                : connection.m_reliableQueue.WritePayload(*pendingPacket, networkSerializer);
+            if (!payloadSerialized)
             {
                 AZLOG_ERROR("PacketId %u failed payload serialization and will not be sent", aznumeric_cast<uint32_t>(localPacketId));
                 return InvalidPacketId;
@@ -536,13 +607,44 @@ namespace AzNetworking
         uint32_t packetSize = static_cast<uint32_t>(buffer.GetSize());
         uint8_t* packetData = buffer.GetBuffer();
 
+        // If it's a reliable packet, make sure our reliable queue knows about it now because we might need to drop it if our connection is
+        // not set up. Oversized packets are not retained, as each of their fragments is reliable in its own right
+        const bool requiresFragmentation = (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead);
+        const bool isBlockedByHandshake = connection.GetDtlsEndpoint().IsConnecting() && !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType);
+        if ((reliabilityType == ReliabilityType::Reliable) && (isBlockedByHandshake || !requiresFragmentation))
+        {
+            if (!connection.PrepareReliablePacketForSend(localPacketId, reliableSequence, packetType, packetData + payloadOffset, packetSize - payloadOffset))
+            {
+                connection.Disconnect(DisconnectReason::ReliableQueueFull, TerminationEndpoint::Local);
+            }
+        }
+
+        // If we're still connecting, only transmit packets related to establishing connection and queue the rest for later
+        // This implicitly enforces that the only FragmentedPackets sent here are of ConnectionHandshakePacket
+        // Other large packets are simply queued before they are fragmented
+        if (isBlockedByHandshake)
+        {
+            // IMPORTANT that we register with the timeout queue here, otherwise we don't have the timer to pop for reliable packets
+            RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
+            AZLOG(
+                NET_DebugDtls, "Connection is still in handshake negotiation, blocking packet send for packet type %d",
+                (int)packetType);
+            return localPacketId;
+        }
+
         // If the packet doesn't fit within our MTU (minus potential SSL encryption overhead), break it up
-        if (packetSize > connection.GetConnectionMtu() - net_SslInflationOverhead)
+        // We don't ack aggregate packets that get fragmented, only the individual fragments are tracked
+        if (requiresFragmentation)
         {
             // Each fragmented packet we send adds an extra fragmented packet header, need to deduct that from our chunk size, otherwise we infinitely loop
             // SSL encryption can also inflate our payload so we pre-emptively deduct an estimated tax
             const uint32_t chunkSize = connection.GetConnectionMtu() - net_FragmentedHeaderOverhead - net_SslInflationOverhead;
             const uint32_t numChunks = (packetSize + chunkSize - 1) / chunkSize; // We want to round up on the remainder
+            if (numChunks > UdpFragmentQueue::MaxChunksPerFragmentedPacket)
+            {
+                AZLOG_ERROR("PacketId %u requires %u fragments, exceeding the maximum of %u, and will not be sent", aznumeric_cast<uint32_t>(localPacketId), numChunks, UdpFragmentQueue::MaxChunksPerFragmentedPacket);
+                return InvalidPacketId;
+            }
             const uint8_t* chunkStart = packetData;
             const SequenceId fragmentedSequence = connection.m_fragmentQueue.GetNextFragmentedSequenceId();
             uint32_t bytesRemaining = packetSize;
@@ -609,13 +711,13 @@ namespace AzNetworking
             aznumeric_cast<uint32_t>(header.GetSequenceWindow())
         );
 
-        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
+        AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packetType));
         // If we're not connected then we're still handshaking and require packets to be unencrypted
-        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
+        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packetType);
         if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
-            connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
+            connection.ProcessSent(localPacketId, packetSize + UdpPacketHeaderSize, reliabilityType);
             GetMetrics().m_sendBytesUncompressed += buffer.GetSize() + UdpPacketHeaderSize + (shouldEncrypt ? DtlsPacketHeaderSize : 0);
             return localPacketId;
         }
@@ -22,6 +22,9 @@ namespace AzNetworking
 {
     class IConnectionListener;
     class ICompressor;
+    class UdpPacketCaptureWriter;
+    class UdpReplaySocket;
+    struct PendingPacket;
 
     static const uint32_t UdpPacketHeaderSize = 20 + 8; //!< 20 byte IPv4 header + 8 byte UDP header
     static const uint32_t DtlsPacketHeaderSize = 13; //!< DTLS1_RT_HEADER_LENGTH
@@ -132,6 +135,14 @@ namespace AzNetworking
         //! @return boolean true on success, false on failure
         bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
 
+        //! Registers the opened socket with the reader thread, unless it is a replay socket.
+        void RegisterSocket();
+
+        //! Advances packet replay and returns the packets received over the replayed time.
+        //! @param deltaTimeMs the real time elapsed since the last update, used if net_UdpReplayStepMs is 0
+        //! @return the set of replayed packets to process this update
+        const UdpReaderThread::ReceivedPackets* GatherReplayPackets(AZ::TimeMs deltaTimeMs);
+
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
         //! @param packet             serializable object to transmit
@@ -139,6 +150,21 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Resends a lost reliable packet using the payload retained by the connection's reliable queue.
+        //! @param connection    the UdpConnection instance to send the packet on
+        //! @param pendingPacket the lost packet to retransmit with its original reliable sequence number
+        //! @return packet id for the transmitted packet
+        PacketId ResendPacket(UdpConnection& connection, const PendingPacket& pendingPacket);
+
+        //! Shared implementation of SendPacket() and ResendPacket(), exactly one of packet or pendingPacket must be provided.
+        //! @param connection       the UdpConnection instance to send the packet on
+        //! @param packetType       the type of the packet being sent
+        //! @param packet           serializable object to transmit, or nullptr when resending
+        //! @param pendingPacket    the previously serialized packet to retransmit, or nullptr for a new packet
+        //! @param reliableSequence the reliable sequence number to use for this packet, InvalidSequenceId for unreliable packets
+        //! @return packet id for the transmitted packet
+        PacketId SendPacketInternal(UdpConnection& connection, PacketType packetType, const IPacket* packet, const PendingPacket* pendingPacket, SequenceId reliableSequence);
+
         //! Accepts an incoming udp connection.
         //! @param connectPacket the initial connectPacket
         void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
@@ -186,10 +212,18 @@ namespace AzNetworking
         UdpConnectionSet m_connectionSet;
         TimeoutQueue m_connectionTimeoutQueue;
         TimeoutQueue m_packetTimeoutQueue;
+        AZStd::unique_ptr<UdpPacketCaptureWriter> m_packetCapture;
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
         UdpReaderThread& m_readerThread;
 
+        // Packet replay state, only used when net_UdpReplayFile targets this interface
+        UdpReplaySocket* m_replaySocket = nullptr;
+        UdpReaderThread::ReceivedPackets m_replayPackets;
+        AZ::TimeMs m_replayStartTimeMs = AZ::TimeMs{ 0 };
+        uint32_t m_replayUpdateCount = 0;
+        bool m_replayReported = false;
+
         struct RemovedConnection
         {
             UdpConnection* m_connection;
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpPacketCapture.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/limits.h>
+
+namespace AzNetworking
+{
+    static constexpr uint32_t CaptureFileHeaderSize = sizeof(uint32_t) + sizeof(uint32_t);
+    static constexpr uint32_t CaptureRecordHeaderSize = sizeof(uint64_t) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint16_t);
+
+    // Buffered records are written out once this many bytes have accumulated
+    static constexpr uint32_t CaptureFlushThreshold = 64 * 1024;
+
+    UdpPacketCaptureWriter::~UdpPacketCaptureWriter()
+    {
+        Close();
+    }
+
+    bool UdpPacketCaptureWriter::Open(const char* filePath)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_file.IsOpen())
+        {
+            FlushLocked();
+            m_file.Close();
+        }
+
+        const int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+        if (!m_file.Open(filePath, openMode))
+        {
+            AZLOG_ERROR("Failed to open packet capture file %s", filePath);
+            return false;
+        }
+
+        uint8_t header[CaptureFileHeaderSize];
+        NetworkInputSerializer networkSerializer(header, CaptureFileHeaderSize);
+        ISerializer& serializer = networkSerializer;
+        uint32_t magic = UdpPacketCaptureMagic;
+        uint32_t version = UdpPacketCaptureVersion;
+        serializer.Serialize(magic, "Magic");
+        serializer.Serialize(version, "Version");
+
+        m_pendingData.clear();
+        m_pendingData.reserve(CaptureFlushThreshold + CaptureRecordHeaderSize + MaxUdpTransmissionUnit);
+        m_pendingData.insert(m_pendingData.end(), &header[0], &header[serializer.GetSize()]);
+        m_startTimeUs = AZStd::GetTimeNowMicroSecond();
+        m_recordedPackets = 0;
+        return true;
+    }
+
+    void UdpPacketCaptureWriter::Close()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_file.IsOpen())
+        {
+            FlushLocked();
+            m_file.Close();
+        }
+    }
+
+    bool UdpPacketCaptureWriter::IsOpen() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_file.IsOpen();
+    }
+
+    void UdpPacketCaptureWriter::Record(CaptureDirection direction, const IpAddress& address, const uint8_t* data, uint32_t size)
+    {
+        if (size > AZStd::numeric_limits<uint16_t>::max())
+        {
+            AZLOG_WARN("Packet of %u bytes is too large to capture, skipping", size);
+            return;
+        }
+
+        const AZStd::sys_time_t nowUs = AZStd::GetTimeNowMicroSecond();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (!m_file.IsOpen())
+        {
+            return;
+        }
+
+        uint8_t recordHeader[CaptureRecordHeaderSize];
+        NetworkInputSerializer networkSerializer(recordHeader, CaptureRecordHeaderSize);
+        ISerializer& serializer = networkSerializer;
+        uint64_t timeUs = static_cast<uint64_t>(AZStd::max<AZStd::sys_time_t>(nowUs - m_startTimeUs, 0));
+        uint8_t directionValue = static_cast<uint8_t>(direction);
+        uint32_t hostAddress = address.GetAddress(ByteOrder::Host);
+        uint16_t hostPort = address.GetPort(ByteOrder::Host);
+        uint16_t payloadSize = static_cast<uint16_t>(size);
+        serializer.Serialize(timeUs, "TimeUs");
+        serializer.Serialize(directionValue, "Direction");
+        serializer.Serialize(hostAddress, "Address");
+        serializer.Serialize(hostPort, "Port");
+        serializer.Serialize(payloadSize, "Size");
+
+        m_pendingData.insert(m_pendingData.end(), &recordHeader[0], &recordHeader[serializer.GetSize()]);
+        m_pendingData.insert(m_pendingData.end(), data, data + size);
+        ++m_recordedPackets;
+
+        if (m_pendingData.size() >= CaptureFlushThreshold)
+        {
+            FlushLocked();
+        }
+    }
+
+    uint32_t UdpPacketCaptureWriter::GetRecordedPackets() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_recordedPackets;
+    }
+
+    void UdpPacketCaptureWriter::FlushLocked()
+    {
+        if (!m_pendingData.empty())
+        {
+            m_file.Write(m_pendingData.data(), m_pendingData.size());
+            m_pendingData.clear();
+        }
+    }
+
+    bool UdpPacketCaptureReader::Open(const char* filePath)
+    {
+        Close();
+
+        const AZ::IO::SystemFile::SizeType fileSize = AZ::IO::SystemFile::Length(filePath);
+        if (fileSize < CaptureFileHeaderSize)
+        {
+            AZLOG_ERROR("Packet capture file %s is missing or truncated", filePath);
+            return false;
+        }
+
+        AZStd::vector<uint8_t> captureData;
+        captureData.resize_no_construct(fileSize);
+        if (AZ::IO::SystemFile::Read(filePath, captureData.data(), fileSize) != fileSize)
+        {
+            AZLOG_ERROR("Failed to read packet capture file %s", filePath);
+            return false;
+        }
+
+        return Open(AZStd::move(captureData));
+    }
+
+    bool UdpPacketCaptureReader::Open(AZStd::vector<uint8_t>&& captureData)
+    {
+        Close();
+
+        if (captureData.size() < CaptureFileHeaderSize)
+        {
+            return false;
+        }
+
+        NetworkOutputSerializer networkSerializer(captureData.data(), CaptureFileHeaderSize);
+        ISerializer& serializer = networkSerializer;
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        serializer.Serialize(magic, "Magic");
+        serializer.Serialize(version, "Version");
+        if ((magic != UdpPacketCaptureMagic) || (version != UdpPacketCaptureVersion))
+        {
+            AZLOG_ERROR("Unsupported packet capture, magic 0x%08X version %u", magic, version);
+            return false;
+        }
+
+        m_captureData = AZStd::move(captureData);
+        m_readPosition = CaptureFileHeaderSize;
+        return true;
+    }
+
+    void UdpPacketCaptureReader::Close()
+    {
+        m_captureData.clear();
+        m_readPosition = 0;
+    }
+
+    bool UdpPacketCaptureReader::IsOpen() const
+    {
+        return !m_captureData.empty();
+    }
+
+    bool UdpPacketCaptureReader::ReadNext(CapturedPacket& outPacket)
+    {
+        return ReadRecord(m_readPosition, outPacket);
+    }
+
+    bool UdpPacketCaptureReader::PeekNextTime(uint64_t& outTimeUs) const
+    {
+        uint32_t readPosition = m_readPosition;
+        CapturedPacket packet;
+        if (ReadRecord(readPosition, packet))
+        {
+            outTimeUs = packet.m_timeUs;
+            return true;
+        }
+        return false;
+    }
+
+    void UdpPacketCaptureReader::Rewind()
+    {
+        m_readPosition = IsOpen() ? CaptureFileHeaderSize : 0;
+    }
+
+    bool UdpPacketCaptureReader::ReadRecord(uint32_t& inOutPosition, CapturedPacket& outPacket) const
+    {
+        const uint32_t captureSize = static_cast<uint32_t>(m_captureData.size());
+        if (inOutPosition + CaptureRecordHeaderSize > captureSize)
+        {
+            return false;
+        }
+
+        NetworkOutputSerializer networkSerializer(m_captureData.data() + inOutPosition, CaptureRecordHeaderSize);
+        ISerializer& serializer = networkSerializer;
+        uint64_t timeUs = 0;
+        uint8_t directionValue = 0;
+        uint32_t hostAddress = 0;
+        uint16_t hostPort = 0;
+        uint16_t payloadSize = 0;
+        serializer.Serialize(timeUs, "TimeUs");
+        serializer.Serialize(directionValue, "Direction");
+        serializer.Serialize(hostAddress, "Address");
+        serializer.Serialize(hostPort, "Port");
+        serializer.Serialize(payloadSize, "Size");
+
+        const uint32_t payloadPosition = inOutPosition + CaptureRecordHeaderSize;
+        if (!serializer.IsValid() || (payloadPosition + payloadSize > captureSize))
+        {
+            AZLOG_WARN("Packet capture is truncated at offset %u", inOutPosition);
+            return false;
+        }
+
+        outPacket.m_timeUs = timeUs;
+        outPacket.m_direction = static_cast<CaptureDirection>(directionValue);
+        outPacket.m_address = IpAddress(ByteOrder::Host, hostAddress, hostPort);
+        outPacket.m_data = m_captureData.data() + payloadPosition;
+        outPacket.m_size = payloadSize;
+        inOutPosition = payloadPosition + payloadSize;
+        return true;
+    }
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/time.h>
+
+namespace AzNetworking
+{
+    //! Direction of a captured datagram relative to the capturing socket.
+    enum class CaptureDirection : uint8_t
+    {
+        Sent,
+        Received
+    };
+
+    //! A single captured datagram.
+    //! m_data points into the memory owned by the UdpPacketCaptureReader that produced it.
+    struct CapturedPacket
+    {
+        uint64_t m_timeUs = 0; //!< Microseconds since the capture was opened
+        CaptureDirection m_direction = CaptureDirection::Received;
+        IpAddress m_address;
+        const uint8_t* m_data = nullptr;
+        uint32_t m_size = 0;
+    };
+
+    //! Magic and version written at the start of every capture file.
+    static constexpr uint32_t UdpPacketCaptureMagic = 0x415A5043; // 'AZPC'
+    static constexpr uint32_t UdpPacketCaptureVersion = 1;
+
+    //! @class UdpPacketCaptureWriter
+    //! @brief Records timestamped datagrams sent and received on a UdpSocket to a compact binary file.
+    //!
+    //! Each record holds a timestamp, the direction, the remote endpoint and the raw datagram as seen by the socket.
+    //! All fields are written in network byte order so captures can be replayed on any platform.
+    //! Recording is thread safe, received datagrams are recorded from the UdpReaderThread.
+    class UdpPacketCaptureWriter final
+    {
+    public:
+
+        UdpPacketCaptureWriter() = default;
+        ~UdpPacketCaptureWriter();
+
+        //! Opens a capture file for writing, truncating any existing file.
+        //! @param filePath the path of the capture file to write
+        //! @return boolean true on success
+        bool Open(const char* filePath);
+
+        //! Flushes any buffered records and closes the capture file.
+        void Close();
+
+        //! Returns true if the capture file is open for writing.
+        //! @return boolean true if the capture file is open for writing
+        bool IsOpen() const;
+
+        //! Records a single datagram.
+        //! @param direction whether the datagram was sent or received
+        //! @param address   the remote endpoint of the datagram
+        //! @param data      pointer to the datagram payload
+        //! @param size      size of the datagram payload in bytes
+        void Record(CaptureDirection direction, const IpAddress& address, const uint8_t* data, uint32_t size);
+
+        //! Returns the number of datagrams recorded since the capture was opened.
+        //! @return the number of datagrams recorded since the capture was opened
+        uint32_t GetRecordedPackets() const;
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(UdpPacketCaptureWriter);
+
+        void FlushLocked();
+
+        mutable AZStd::mutex m_mutex;
+        AZ::IO::SystemFile m_file;
+        AZStd::vector<uint8_t> m_pendingData;
+        AZStd::sys_time_t m_startTimeUs = 0;
+        uint32_t m_recordedPackets = 0;
+    };
+
+    //! @class UdpPacketCaptureReader
+    //! @brief Reads datagrams back from a capture written by UdpPacketCaptureWriter.
+    //!
+    //! The entire capture is loaded into memory up front, returned packets reference that memory directly
+    //! so iterating a capture performs no per packet allocations or copies.
+    class UdpPacketCaptureReader final
+    {
+    public:
+
+        UdpPacketCaptureReader() = default;
+        ~UdpPacketCaptureReader() = default;
+
+        //! Loads a capture file.
+        //! @param filePath the path of the capture file to read
+        //! @return boolean true if the file was loaded and has a valid header
+        bool Open(const char* filePath);
+
+        //! Loads a capture from memory, the reader takes ownership of the provided data.
+        //! @param captureData the raw contents of a capture file
+        //! @return boolean true if the data has a valid header
+        bool Open(AZStd::vector<uint8_t>&& captureData);
+
+        //! Releases the loaded capture.
+        void Close();
+
+        //! Returns true if a capture is loaded.
+        //! @return boolean true if a capture is loaded
+        bool IsOpen() const;
+
+        //! Reads the next datagram from the capture.
+        //! @param outPacket on success, the next captured datagram
+        //! @return boolean true on success, false at the end of the capture or if the capture is truncated
+        bool ReadNext(CapturedPacket& outPacket);
+
+        //! Peeks the timestamp of the next datagram without consuming it.
+        //! @param outTimeUs on success, the timestamp of the next captured datagram
+        //! @return boolean true on success, false at the end of the capture or if the capture is truncated
+        bool PeekNextTime(uint64_t& outTimeUs) const;
+
+        //! Restarts reading from the first datagram in the capture.
+        void Rewind();
+
+    private:
+
+        AZ_DISABLE_COPY_MOVE(UdpPacketCaptureReader);
+
+        bool ReadRecord(uint32_t& inOutPosition, CapturedPacket& outPacket) const;
+
+        AZStd::vector<uint8_t> m_captureData;
+        uint32_t m_readPosition = 0;
+    };
+}
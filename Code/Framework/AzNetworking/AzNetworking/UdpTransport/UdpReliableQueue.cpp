@@ -11,7 +11,7 @@
 #include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
-#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 
@@ -31,24 +31,70 @@ namespace AzNetworking
 
     uint32_t UdpReliableQueue::GetQueueSize() const
     {
-        return static_cast<uint32_t>(m_packetWindow.size());
+        return m_pendingPacketCount;
     }
 
-    bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
+    bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const uint8_t* payload, uint32_t payloadSize)
     {
         AZLOG(NET_ReliableQueueDebug, "Inserting packetId %u with reliable sequenceId %u", static_cast<uint32_t>(packetId), static_cast<uint32_t>(reliableSequenceId));
-        if (m_packetWindow.size() > net_MaxReliablePacketsInWindow)
+        if (m_pendingPacketCount > net_MaxReliablePacketsInWindow)
         {
             return false;
         }
 
-        PendingPacketMap::const_iterator iter = m_packetWindow.find(packetId);
-        if (iter != m_packetWindow.end())
+        if (m_packetWindow.empty())
         {
-            AZ_Assert(false, "Attempted to reinsert an existing packetId into the reliable queue");
+            m_packetWindow.resize(InitialPacketWindowSize);
+        }
+
+        // Packet ids are allocated sequentially, so a collision means a pending packet is very old relative to this one
+        // Grow the window until the two separate, rather than dropping a packet that has not yet been acked
+        while (GetSlot(packetId).m_packetId != InvalidPacketId)
+        {
+            if (GetSlot(packetId).m_packetId == packetId)
+            {
+                AZ_Assert(false, "Attempted to reinsert an existing packetId into the reliable queue");
+                return false;
+            }
+
+            if (!GrowPacketWindow())
+            {
+                AZLOG_WARN("Reliable queue window exhausted while inserting packetId %u", static_cast<uint32_t>(packetId));
+                return false;
+            }
+        }
+
+        const PayloadSlab::Handle payloadHandle = m_payloadSlab.Store(payload, payloadSize);
+        if (payloadHandle == PayloadSlab::InvalidHandle)
+        {
+            AZLOG_WARN("Reliable queue payload storage exhausted while inserting packetId %u", static_cast<uint32_t>(packetId));
             return false;
         }
-        m_packetWindow[packetId] = { reliableSequenceId, packet.Clone() };
+
+        PendingPacket& slot = GetSlot(packetId);
+        slot.m_packetId = packetId;
+        slot.m_reliableSequenceId = reliableSequenceId;
+        slot.m_packetType = packetType;
+        slot.m_payloadSize = payloadSize;
+        slot.m_payloadHandle = payloadHandle;
+        ++m_pendingPacketCount;
+        return true;
+    }
+
+    bool UdpReliableQueue::WritePayload(const PendingPacket& pendingPacket, NetworkInputSerializer& serializer) const
+    {
+        PayloadSlab::Handle block = pendingPacket.m_payloadHandle;
+        uint32_t bytesRemaining = pendingPacket.m_payloadSize;
+        while (bytesRemaining > 0)
+        {
+            const uint32_t blockBytes = AZStd::min(bytesRemaining, PayloadSlab::BlockSize);
+            if (!serializer.CopyToBuffer(m_payloadSlab.GetBlockData(block), blockBytes))
+            {
+                return false;
+            }
+            bytesRemaining -= blockBytes;
+            block = m_payloadSlab.GetNextBlock(block);
+        }
         return true;
     }
 
@@ -92,10 +138,17 @@ namespace AzNetworking
         [[maybe_unused]] UdpConnection& connection, PacketId packetId)
     {
         AZLOG(NET_ReliableQueueDebug, "Acked packetId %u", static_cast<uint32_t>(packetId));
-        PendingPacketMap::const_iterator iter = m_packetWindow.find(packetId);
-        if (iter != m_packetWindow.end())
+        if (m_packetWindow.empty())
+        {
+            return;
+        }
+
+        PendingPacket& slot = GetSlot(packetId);
+        if (slot.m_packetId == packetId)
         {
-            m_packetWindow.erase(iter);
+            m_payloadSlab.Free(slot.m_payloadHandle);
+            slot = PendingPacket();
+            --m_pendingPacketCount;
         }
     }
 
@@ -103,40 +156,62 @@ namespace AzNetworking
     {
         AZLOG(NET_ReliableQueueDebug, "Lost packetId %u", static_cast<uint32_t>(packetId));
 
+        if (m_packetWindow.empty() || (GetSlot(packetId).m_packetId != packetId))
+        {
+            AZLOG_ERROR("Failed to find timed out packetId %u in reliable queue", static_cast<uint32_t>(packetId));
+            return false;
+        }
+
+        // Release the slot before resending, the resend registers a new packetId which may map to the same slot
+        // The payload blocks are only freed once the resend has copied them out
+        PendingPacket& slot = GetSlot(packetId);
+        const PendingPacket lostPacket = slot;
+        slot = PendingPacket();
+        --m_pendingPacketCount;
+
         bool result = false;
-        AZStd::unique_ptr<IPacket> lostPacket;
-        SequenceId lostReliableSequenceId = InvalidSequenceId;
+        AZLOG(NET_ReliableQueue, "Resending reliable packetId %u due to loss", static_cast<uint32_t>(lostPacket.m_reliableSequenceId));
 
-        PendingPacketMap::iterator iter = m_packetWindow.find(packetId);
-        if (iter != m_packetWindow.end())
+        // This punches down an abstraction layer purposefully to resend using the existing reliable SequenceId
+        // NOTE: This will call back into UdpReliableQueue::PrepareForSend!!
+        if (networkInterface.ResendPacket(connection, lostPacket) == InvalidPacketId)
         {
-            AZ_Assert(iter->second.m_packet != nullptr, "Timed out reliable packet was nullptr");
-            lostPacket = AZStd::move(iter->second.m_packet); // This transfers ownership out of the pending packet to this local scoped alloc
-            lostReliableSequenceId = iter->second.m_reliableSequenceId;
-            m_packetWindow.erase(iter);
+            // Packet failed to retransmit, meaning no retry attempt was made
+            // Since we've lost a reliable packet, the appropriate response is to terminate the connection
+            connection.Disconnect(DisconnectReason::ReliableTransportFailure, TerminationEndpoint::Local);
+            result = true;
         }
-        else
+        m_payloadSlab.Free(lostPacket.m_payloadHandle);
+
+        networkInterface.GetMetrics().m_resentPackets++;
+        return result;
+    }
+
+    PendingPacket& UdpReliableQueue::GetSlot(PacketId packetId)
+    {
+        const uint32_t slotMask = static_cast<uint32_t>(m_packetWindow.size()) - 1;
+        return m_packetWindow[static_cast<uint32_t>(packetId) & slotMask];
+    }
+
+    bool UdpReliableQueue::GrowPacketWindow()
+    {
+        const uint32_t windowSize = static_cast<uint32_t>(m_packetWindow.size());
+        if (windowSize >= MaxPacketWindowSize)
         {
-            AZLOG_ERROR("Failed to find timed out packetId %u in reliable queue", static_cast<uint32_t>(packetId));
+            return false;
         }
 
-        if (lostReliableSequenceId != InvalidSequenceId)
+        // Packets that occupy distinct slots continue to occupy distinct slots with a larger mask, so no collisions are possible here
+        PendingPacketWindow packetWindow(windowSize * 2);
+        const uint32_t slotMask = windowSize * 2 - 1;
+        for (const PendingPacket& pendingPacket : m_packetWindow)
         {
-            AZLOG(NET_ReliableQueue, "Resending reliable packetId %u due to loss", static_cast<uint32_t>(lostReliableSequenceId));
-
-            // This punches down an abstraction layer purposefully to resend using the existing reliable SequenceId
-            // NOTE: This will call back into UdpReliableQueue::PrepareForSend!!
-            if (networkInterface.SendPacket(connection, *lostPacket, lostReliableSequenceId) == InvalidPacketId)
+            if (pendingPacket.m_packetId != InvalidPacketId)
             {
-                // Packet failed to retransmit, meaning no retry attempt was made
-                // Since we've lost a reliable packet, the appropriate response is to terminate the connection
-                connection.Disconnect(DisconnectReason::ReliableTransportFailure, TerminationEndpoint::Local);
-                result = true;
+                packetWindow[static_cast<uint32_t>(pendingPacket.m_packetId) & slotMask] = pendingPacket;
             }
-
-            networkInterface.GetMetrics().m_resentPackets++;
         }
-
-        return result;
+        m_packetWindow.swap(packetWindow);
+        return true;
     }
 }
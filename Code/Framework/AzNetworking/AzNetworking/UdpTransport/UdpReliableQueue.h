@@ -12,23 +12,33 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzNetworking/DataStructures/PayloadSlab.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
+    class NetworkInputSerializer;
     class NetworkOutputSerializer;
     class UdpConnection;
     class UdpNetworkInterface;
     class UdpPacketHeader;
 
+    //! A reliable packet awaiting acknowledgement, the serialized payload is held in the owning queue's payload slab.
     struct PendingPacket
     {
-        SequenceId m_reliableSequenceId;
-        AZStd::unique_ptr<IPacket> m_packet;
+        PacketId m_packetId = InvalidPacketId;
+        SequenceId m_reliableSequenceId = InvalidSequenceId;
+        PacketType m_packetType = PacketType{ 0 };
+        uint32_t m_payloadSize = 0;
+        PayloadSlab::Handle m_payloadHandle = PayloadSlab::InvalidHandle;
     };
 
     //! @class UdpReliableQueue
     //! @brief provides a reliability queue on top of the unreliable UDP connection layer.
+    //!
+    //! Pending packets are stored in a power of two ring indexed by packet id, so inserting and acking a packet is O(1).
+    //! Rather than cloning the packet, the serialized payload is copied into a per-connection PayloadSlab, which lets resends
+    //! skip reserialization entirely and keeps the queue allocation free once the connection reaches its steady state.
     class UdpReliableQueue
     {
     public:
@@ -47,9 +57,17 @@ namespace AzNetworking
         //! Called when we're going to transmit a packet that we want to be reliable.
         //! @param packetId           packet id of the packet we're sending
         //! @param reliableSequenceId the reliable sequence identifier of the packet we're sending
-        //! @param packet             reference to the packet being transmitted
+        //! @param packetType         the type of the packet being transmitted
+        //! @param payload            the serialized packet payload, excluding packet flags and header
+        //! @param payloadSize        the size of the serialized packet payload in bytes
         //! @return boolean true on success, false on failure
-        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet);
+        bool PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, PacketType packetType, const uint8_t* payload, uint32_t payloadSize);
+
+        //! Writes the stored payload of a pending packet to a serializer.
+        //! @param pendingPacket the pending packet to write the payload of
+        //! @param serializer    the serializer to write the payload to
+        //! @return boolean true on success, false if the serializer ran out of space
+        bool WritePayload(const PendingPacket& pendingPacket, NetworkInputSerializer& serializer) const;
 
         //! Called when a reliable packet has been received.
         //! @param header the header for the received reliable packet
@@ -71,13 +89,24 @@ namespace AzNetworking
     private:
 
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
+        static constexpr uint32_t InitialPacketWindowSize = 64; // Initial number of pending packet slots, must be a power of 2
+        static constexpr uint32_t MaxPacketWindowSize = 65536; // Upper bound on pending packet slots, must be a power of 2
 
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
-        using PendingPacketMap = AZStd::unordered_map<PacketId, PendingPacket>;
+        using PendingPacketWindow = AZStd::vector<PendingPacket>;
+
+        //! Returns the slot for the provided packet id, which may hold a different packet id.
+        PendingPacket& GetSlot(PacketId packetId);
+
+        //! Doubles the size of the pending packet window, redistributing any pending packets.
+        //! @return boolean true on success, false if the window is already at its maximum size
+        bool GrowPacketWindow();
 
-        SequenceGenerator  m_reliableSequenceGenerator;
-        SequenceId         m_lastReceivedReliableSequenceId = InvalidSequenceId;
-        PacketAckContainer m_receivedSequenceHistory;
-        PendingPacketMap   m_packetWindow;
+        SequenceGenerator   m_reliableSequenceGenerator;
+        SequenceId          m_lastReceivedReliableSequenceId = InvalidSequenceId;
+        PacketAckContainer  m_receivedSequenceHistory;
+        PendingPacketWindow m_packetWindow;
+        uint32_t            m_pendingPacketCount = 0;
+        PayloadSlab         m_payloadSlab;
     };
 }
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpReplaySocket.h>
+
+namespace AzNetworking
+{
+    bool UdpReplaySocket::LoadCapture(const char* filePath)
+    {
+        m_hasPendingPacket = false;
+        m_replayStarted = false;
+        m_replayComplete = false;
+        m_replayTimeUs = 0;
+        return m_captureReader.Open(filePath);
+    }
+
+    bool UdpReplaySocket::Open([[maybe_unused]] uint16_t port, CanAcceptConnections canAccept, TrustZone trustZone)
+    {
+        // Bind an ephemeral port so the socket reports as open without colliding with a live server
+        return UdpSocket::Open(0, canAccept, trustZone);
+    }
+
+    int32_t UdpReplaySocket::Receive(IpAddress&, uint8_t*, uint32_t) const
+    {
+        return 0;
+    }
+
+    void UdpReplaySocket::GatherPackets(AZ::TimeMs deltaTimeMs, UdpReaderThread::ReceivedPackets& outPackets)
+    {
+        if (m_replayStarted)
+        {
+            m_replayTimeUs += static_cast<uint64_t>(AZStd::max(deltaTimeMs, AZ::TimeMs{ 0 })) * 1000;
+        }
+
+        while (!outPackets.full())
+        {
+            if (!m_hasPendingPacket)
+            {
+                m_hasPendingPacket = m_captureReader.ReadNext(m_pendingPacket);
+                if (!m_hasPendingPacket)
+                {
+                    m_replayComplete = true;
+                    return;
+                }
+
+                if (m_pendingPacket.m_direction != CaptureDirection::Received)
+                {
+                    // Responses are regenerated by the replaying endpoint
+                    m_hasPendingPacket = false;
+                    continue;
+                }
+
+                if (!m_replayStarted)
+                {
+                    // Skip any idle time before the first datagram arrived
+                    m_replayTimeUs = m_pendingPacket.m_timeUs;
+                    m_replayStarted = true;
+                }
+            }
+
+            if (m_pendingPacket.m_timeUs > m_replayTimeUs)
+            {
+                return;
+            }
+
+            outPackets.emplace_back(m_pendingPacket.m_address, m_pendingPacket.m_data, static_cast<int32_t>(m_pendingPacket.m_size));
+            m_recvPackets++;
+            m_recvBytes += m_pendingPacket.m_size;
+            m_hasPendingPacket = false;
+        }
+    }
+
+    bool UdpReplaySocket::IsReplayComplete() const
+    {
+        return m_replayComplete;
+    }
+
+    uint64_t UdpReplaySocket::GetReplayTimeUs() const
+    {
+        return m_replayTimeUs;
+    }
+
+    int32_t UdpReplaySocket::SendInternal(const IpAddress&, const uint8_t*, uint32_t size, bool, DtlsEndpoint&) const
+    {
+        // Replayed endpoints are not listening, pretend the send succeeded
+        return static_cast<int32_t>(size);
+    }
+}
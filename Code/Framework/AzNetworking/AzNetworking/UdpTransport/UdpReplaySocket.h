@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/UdpTransport/UdpPacketCapture.h>
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzCore/Time/ITime.h>
+
+namespace AzNetworking
+{
+    //! @class UdpReplaySocket
+    //! @brief UdpSocket that feeds received datagrams from a packet capture instead of the network.
+    //!
+    //! Replay sockets are not registered with the UdpReaderThread, the owning network interface pulls datagrams directly
+    //! via GatherPackets() so that replay is driven entirely by the caller's notion of elapsed time. Advancing by a fixed
+    //! step each update makes replay deterministic and independent of wall clock time, allowing captures to be replayed
+    //! as fast as the process can consume them. Anything sent through the socket is discarded.
+    class UdpReplaySocket final
+        : public UdpSocket
+    {
+    public:
+
+        UdpReplaySocket() = default;
+        ~UdpReplaySocket() override = default;
+
+        //! Loads the capture to replay, must be called before the socket is opened.
+        //! @param filePath the path of the capture file to replay
+        //! @return boolean true if the capture was loaded
+        bool LoadCapture(const char* filePath);
+
+        //! Opens the replay socket, the provided port is ignored and an ephemeral port is bound instead.
+        //! @param port      unused, replay sockets never receive from the network
+        //! @param canAccept if true, the socket will be opened in a way that allows accepting incoming connections
+        //! @param trustZone the level of trust we associate with this connection (internal or external)
+        //! @return boolean true on success
+        bool Open(uint16_t port, CanAcceptConnections canAccept, TrustZone trustZone) override;
+
+        //! Replay sockets never read from the network, received datagrams are provided by GatherPackets().
+        int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const override;
+
+        //! Advances the replay clock and gathers every captured datagram received up to the new replay time.
+        //! The replay clock starts at the timestamp of the first received datagram in the capture.
+        //! @param deltaTimeMs the amount of capture time to advance by
+        //! @param outPackets  the container to append replayed datagrams to, datagrams reference the loaded capture
+        void GatherPackets(AZ::TimeMs deltaTimeMs, UdpReaderThread::ReceivedPackets& outPackets);
+
+        //! Returns true once every datagram in the capture has been replayed.
+        //! @return boolean true once every datagram in the capture has been replayed
+        bool IsReplayComplete() const;
+
+        //! Returns the current replay time in microseconds relative to the start of the capture.
+        //! @return the current replay time in microseconds relative to the start of the capture
+        uint64_t GetReplayTimeUs() const;
+
+    protected:
+
+        int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const override;
+
+    private:
+
+        UdpPacketCaptureReader m_captureReader;
+        CapturedPacket m_pendingPacket;
+        uint64_t m_replayTimeUs = 0;
+        bool m_hasPendingPacket = false;
+        bool m_replayStarted = false;
+        bool m_replayComplete = false;
+    };
+}
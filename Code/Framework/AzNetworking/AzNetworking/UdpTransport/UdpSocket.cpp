@@ -8,6 +8,7 @@
 
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/UdpTransport/UdpPacketCapture.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Utilities/Endian.h>
 #include <AzNetworking/Utilities/NetworkIncludes.h>
@@ -123,6 +124,11 @@ namespace AzNetworking
             return 0;
         }
 
+        if (m_packetCapture != nullptr)
+        {
+            m_packetCapture->Record(CaptureDirection::Sent, address, data, size);
+        }
+
 #ifdef ENABLE_LATENCY_DEBUG
         if (connectionQuality.m_lossPercentage > 0)
         {
@@ -221,11 +227,21 @@ namespace AzNetworking
             return 0;
         }
 
+        if (m_packetCapture != nullptr)
+        {
+            m_packetCapture->Record(CaptureDirection::Received, outAddress, outData, static_cast<uint32_t>(receivedBytes));
+        }
+
         m_recvPackets++;
         m_recvBytes += receivedBytes;
         return receivedBytes;
     }
 
+    void UdpSocket::SetPacketCapture(UdpPacketCaptureWriter* packetCapture)
+    {
+        m_packetCapture = packetCapture;
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
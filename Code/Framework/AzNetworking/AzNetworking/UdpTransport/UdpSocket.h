@@ -29,6 +29,7 @@ namespace AzNetworking
 {
     // Forwards
     struct ConnectionQuality;
+    class UdpPacketCaptureWriter;
 
     //! @class UdpSocket
     //! @brief wrapper class for managing UDP sockets.
@@ -91,7 +92,12 @@ namespace AzNetworking
         //! @param outData    on success, address to write the received data to
         //! @param size      maximum size the output buffer supports for receiving
         //! @return number of bytes received, <= 0 on error
-        int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
+        virtual int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
+
+        //! Sets a packet capture to record all datagrams sent and received on this socket, nullptr disables capture.
+        //! Sent datagrams are recorded before any encryption or simulated connection quality is applied.
+        //! @param packetCapture the capture to record datagrams to, must outlive the socket or be cleared before destruction
+        void SetPacketCapture(UdpPacketCaptureWriter* packetCapture);
 
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
@@ -128,13 +134,15 @@ namespace AzNetworking
 
         virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
 
+        mutable uint32_t m_recvPackets = 0;
+        mutable uint32_t m_recvBytes = 0;
+        UdpPacketCaptureWriter* m_packetCapture = nullptr;
+
     private:
 
         SocketFd m_socketFd = InvalidSocketFd;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
-        mutable uint32_t m_recvPackets = 0;
-        mutable uint32_t m_recvBytes = 0;
 
 #ifdef ENABLE_LATENCY_DEBUG
         struct DeferredData
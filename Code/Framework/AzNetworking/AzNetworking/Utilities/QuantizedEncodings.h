@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! Encodings are stateless policies that control how a value is written to a serializer.
+    //! Unlike QuantizedValues they do not change the stored type, so they can be applied to existing network properties.
+    //! Quantized encodings are most effective when paired with SerializerPacking::BitPacked, since byte aligned streams round every value up to a whole number of bytes.
+
+    //! Serializes the value as-is.
+    struct DefaultEncoding
+    {
+        template <typename TYPE>
+        static bool Serialize(ISerializer& serializer, TYPE& value, const char* name);
+    };
+
+    //! Serializes a float uniformly quantized into the range [MIN_VALUE, MAX_VALUE] using BITS bits.
+    template <uint32_t BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    struct QuantizedFloatEncoding
+    {
+        static_assert(BITS > 0 && BITS <= 32, "QuantizedFloatEncoding supports between 1 and 32 bits");
+        static_assert(MIN_VALUE < MAX_VALUE, "QuantizedFloatEncoding requires a non-empty range");
+        static bool Serialize(ISerializer& serializer, float& value, const char* name);
+    };
+
+    //! Serializes a Vector3 with each element uniformly quantized into the range [MIN_VALUE, MAX_VALUE] using BITS bits.
+    template <uint32_t BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    struct QuantizedVector3Encoding
+    {
+        static_assert(BITS > 0 && BITS <= 32, "QuantizedVector3Encoding supports between 1 and 32 bits");
+        static_assert(MIN_VALUE < MAX_VALUE, "QuantizedVector3Encoding requires a non-empty range");
+        static bool Serialize(ISerializer& serializer, AZ::Vector3& value, const char* name);
+    };
+
+    //! Serializes a normalized quaternion using the smallest three encoding.
+    //! The index of the largest magnitude component is sent in 2 bits, the remaining three components lie within [-1/sqrt(2), 1/sqrt(2)] and are sent using BITS bits each.
+    //! The largest component is reconstructed on read, its sign is flipped to positive on write since q and -q represent the same rotation.
+    //! A zero quaternion is sent as identity.
+    template <uint32_t BITS>
+    struct SmallestThreeQuaternionEncoding
+    {
+        static_assert(BITS > 0 && BITS <= 32, "SmallestThreeQuaternionEncoding supports between 1 and 32 bits");
+        static bool Serialize(ISerializer& serializer, AZ::Quaternion& value, const char* name);
+    };
+
+    //! Quantizes a float into an unsigned integral value in the range [0, (1 << bits) - 1].
+    //! @param value    the value to quantize, clamped to [minValue, maxValue]
+    //! @param minValue the minimum representable value
+    //! @param maxValue the maximum representable value
+    //! @param bits     the number of bits to quantize to
+    //! @return the quantized value
+    uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t bits);
+
+    //! Reconstructs a float from a quantized integral value.
+    //! @param quantized the quantized value
+    //! @param minValue  the minimum representable value
+    //! @param maxValue  the maximum representable value
+    //! @param bits      the number of bits the value was quantized to
+    //! @return the reconstructed value
+    float DequantizeFloat(uint32_t quantized, float minValue, float maxValue, uint32_t bits);
+}
+
+#include <AzNetworking/Utilities/QuantizedEncodings.inl>
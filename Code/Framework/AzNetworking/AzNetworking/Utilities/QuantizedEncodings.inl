@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+
+namespace AzNetworking
+{
+    inline uint32_t QuantizeFloat(float value, float minValue, float maxValue, uint32_t bits)
+    {
+        const uint32_t maxQuantized = static_cast<uint32_t>((uint64_t(1) << bits) - 1);
+        // Computed in double precision, single precision can round past maxQuantized for large bit counts
+        const double normalized = static_cast<double>(AZ::GetClamp(value, minValue, maxValue) - minValue) / static_cast<double>(maxValue - minValue);
+        return static_cast<uint32_t>(normalized * static_cast<double>(maxQuantized) + 0.5);
+    }
+
+    inline float DequantizeFloat(uint32_t quantized, float minValue, float maxValue, uint32_t bits)
+    {
+        const uint32_t maxQuantized = static_cast<uint32_t>((uint64_t(1) << bits) - 1);
+        const float normalized = static_cast<float>(AZ::GetMin(quantized, maxQuantized)) / static_cast<float>(maxQuantized);
+        return minValue + normalized * (maxValue - minValue);
+    }
+
+    template <typename TYPE>
+    inline bool DefaultEncoding::Serialize(ISerializer& serializer, TYPE& value, const char* name)
+    {
+        return serializer.Serialize(value, name);
+    }
+
+    template <uint32_t BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline bool QuantizedFloatEncoding<BITS, MIN_VALUE, MAX_VALUE>::Serialize(ISerializer& serializer, float& value, const char* name)
+    {
+        constexpr uint32_t MaxQuantized = static_cast<uint32_t>((uint64_t(1) << BITS) - 1);
+        constexpr float MinValue = static_cast<float>(MIN_VALUE);
+        constexpr float MaxValue = static_cast<float>(MAX_VALUE);
+
+        uint32_t quantized = QuantizeFloat(value, MinValue, MaxValue, BITS);
+        if (serializer.Serialize(quantized, name, 0u, MaxQuantized))
+        {
+            value = DequantizeFloat(quantized, MinValue, MaxValue, BITS);
+        }
+        return serializer.IsValid();
+    }
+
+    template <uint32_t BITS, int32_t MIN_VALUE, int32_t MAX_VALUE>
+    inline bool QuantizedVector3Encoding<BITS, MIN_VALUE, MAX_VALUE>::Serialize(ISerializer& serializer, AZ::Vector3& value, const char* name)
+    {
+        using ElementEncoding = QuantizedFloatEncoding<BITS, MIN_VALUE, MAX_VALUE>;
+        if (serializer.BeginObject(name, "Vector3"))
+        {
+            float x = value.GetX();
+            float y = value.GetY();
+            float z = value.GetZ();
+            ElementEncoding::Serialize(serializer, x, "xValue");
+            ElementEncoding::Serialize(serializer, y, "yValue");
+            ElementEncoding::Serialize(serializer, z, "zValue");
+            value.Set(x, y, z);
+            serializer.EndObject(name, "Vector3");
+        }
+        return serializer.IsValid();
+    }
+
+    template <uint32_t BITS>
+    inline bool SmallestThreeQuaternionEncoding<BITS>::Serialize(ISerializer& serializer, AZ::Quaternion& value, const char* name)
+    {
+        constexpr uint32_t MaxQuantized = static_cast<uint32_t>((uint64_t(1) << BITS) - 1);
+        constexpr float ComponentBound = 0.70710678f; // 1 / sqrt(2), the largest magnitude the three smallest components can have
+
+        // A zero quaternion can't be normalized, send it as identity rather than NaNs
+        const AZ::Quaternion rotation = value.IsZero() ? AZ::Quaternion::CreateIdentity() : value.GetNormalized();
+
+        float components[4];
+        rotation.StoreToFloat4(components);
+
+        uint8_t largestIndex = 0;
+        for (uint8_t index = 1; index < 4; ++index)
+        {
+            if (AZ::GetAbs(components[index]) > AZ::GetAbs(components[largestIndex]))
+            {
+                largestIndex = index;
+            }
+        }
+        const float sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+
+        uint32_t quantized[3];
+        for (uint8_t index = 0, smallIndex = 0; index < 4; ++index)
+        {
+            if (index != largestIndex)
+            {
+                quantized[smallIndex++] = QuantizeFloat(components[index] * sign, -ComponentBound, ComponentBound, BITS);
+            }
+        }
+
+        if (serializer.BeginObject(name, "Quaternion"))
+        {
+            serializer.Serialize(largestIndex, "LargestIndex", uint8_t(0), uint8_t(3));
+            serializer.Serialize(quantized[0], "aValue", 0u, MaxQuantized);
+            serializer.Serialize(quantized[1], "bValue", 0u, MaxQuantized);
+            serializer.Serialize(quantized[2], "cValue", 0u, MaxQuantized);
+            serializer.EndObject(name, "Quaternion");
+        }
+
+        if (serializer.IsValid())
+        {
+            float sumSquares = 0.0f;
+            for (uint8_t index = 0, smallIndex = 0; index < 4; ++index)
+            {
+                if (index != largestIndex)
+                {
+                    components[index] = DequantizeFloat(quantized[smallIndex++], -ComponentBound, ComponentBound, BITS);
+                    sumSquares += components[index] * components[index];
+                }
+            }
+            components[largestIndex] = AZ::Sqrt(AZ::GetMax(0.0f, 1.0f - sumSquares));
+            value = AZ::Quaternion::CreateFromFloat4(components).GetNormalized();
+        }
+        return serializer.IsValid();
+    }
+}
@@ -34,6 +34,8 @@ set(FILES
     DataStructures/FixedSizeVectorBitset.h
     DataStructures/FixedSizeVectorBitset.inl
     DataStructures/IBitset.h
+    DataStructures/PayloadSlab.cpp
+    DataStructures/PayloadSlab.h
     DataStructures/RingBufferBitset.h
     DataStructures/RingBufferBitset.inl
     DataStructures/TimeoutQueue.cpp
@@ -49,6 +51,8 @@ set(FILES
     PacketLayer/IPacketHeader.h
     Serialization/AbstractValue.h
     Serialization/AzContainerSerializers.h
+    Serialization/BitPacking.h
+    Serialization/BitPacking.inl
     Serialization/DeltaSerializer.cpp
     Serialization/DeltaSerializer.h
     Serialization/DeltaSerializer.inl
@@ -105,6 +109,8 @@ set(FILES
     UdpTransport/UdpFragmentQueue.h
     UdpTransport/UdpNetworkInterface.cpp
     UdpTransport/UdpNetworkInterface.h
+    UdpTransport/UdpPacketCapture.cpp
+    UdpTransport/UdpPacketCapture.h
     UdpTransport/UdpPacketHeader.cpp
     UdpTransport/UdpPacketHeader.h
     UdpTransport/UdpPacketHeader.inl
@@ -118,6 +124,8 @@ set(FILES
     UdpTransport/UdpReaderThread.h
     UdpTransport/UdpReliableQueue.cpp
     UdpTransport/UdpReliableQueue.h
+    UdpTransport/UdpReplaySocket.cpp
+    UdpTransport/UdpReplaySocket.h
     UdpTransport/UdpSocket.cpp
     UdpTransport/UdpSocket.h
     UdpTransport/UdpSocket.inl
@@ -133,6 +141,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/QuantizedEncodings.h
+    Utilities/QuantizedEncodings.inl
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/DataStructures/PayloadSlab.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    static void FillPattern(uint8_t* data, uint32_t size, uint8_t seed)
+    {
+        for (uint32_t index = 0; index < size; ++index)
+        {
+            data[index] = static_cast<uint8_t>(seed + index * 7);
+        }
+    }
+
+    TEST(PayloadSlabTests, TestStoreAndLoad)
+    {
+        PayloadSlab slab;
+
+        const uint32_t sizes[] = { 1, PayloadSlab::BlockSize - 1, PayloadSlab::BlockSize, PayloadSlab::BlockSize + 1, 4000 };
+        PayloadSlab::Handle handles[AZ_ARRAY_SIZE(sizes)];
+        uint8_t payload[4000];
+        uint8_t loaded[4000];
+
+        for (uint32_t index = 0; index < AZ_ARRAY_SIZE(sizes); ++index)
+        {
+            FillPattern(payload, sizes[index], static_cast<uint8_t>(index));
+            handles[index] = slab.Store(payload, sizes[index]);
+            EXPECT_NE(handles[index], PayloadSlab::InvalidHandle);
+        }
+
+        for (uint32_t index = 0; index < AZ_ARRAY_SIZE(sizes); ++index)
+        {
+            FillPattern(payload, sizes[index], static_cast<uint8_t>(index));
+            slab.Load(handles[index], sizes[index], loaded);
+            EXPECT_EQ(memcmp(payload, loaded, sizes[index]), 0);
+        }
+    }
+
+    TEST(PayloadSlabTests, TestFreedBlocksAreReused)
+    {
+        PayloadSlab slab;
+
+        uint8_t payload[1000];
+        FillPattern(payload, sizeof(payload), 0);
+
+        PayloadSlab::Handle handle = slab.Store(payload, sizeof(payload));
+        slab.Free(handle);
+        const uint32_t blockCount = slab.GetBlockCount();
+        EXPECT_EQ(slab.GetFreeBlockCount(), blockCount);
+
+        for (uint32_t iteration = 0; iteration < 1000; ++iteration)
+        {
+            handle = slab.Store(payload, sizeof(payload));
+            EXPECT_NE(handle, PayloadSlab::InvalidHandle);
+            slab.Free(handle);
+        }
+        EXPECT_EQ(slab.GetBlockCount(), blockCount);
+        EXPECT_EQ(slab.GetFreeBlockCount(), blockCount);
+    }
+
+    TEST(PayloadSlabTests, TestExhaustion)
+    {
+        PayloadSlab slab(4);
+
+        uint8_t payload[PayloadSlab::BlockSize * 3];
+        FillPattern(payload, sizeof(payload), 0);
+
+        const PayloadSlab::Handle handle = slab.Store(payload, sizeof(payload));
+        EXPECT_NE(handle, PayloadSlab::InvalidHandle);
+        EXPECT_EQ(slab.Store(payload, PayloadSlab::BlockSize * 2), PayloadSlab::InvalidHandle);
+        EXPECT_NE(slab.Store(payload, PayloadSlab::BlockSize), PayloadSlab::InvalidHandle);
+
+        slab.Free(handle);
+        EXPECT_NE(slab.Store(payload, PayloadSlab::BlockSize * 2), PayloadSlab::InvalidHandle);
+    }
+
+    TEST(PayloadSlabTests, TestReset)
+    {
+        PayloadSlab slab;
+
+        uint8_t payload[PayloadSlab::BlockSize * 2];
+        FillPattern(payload, sizeof(payload), 0);
+        slab.Store(payload, sizeof(payload));
+        slab.Store(payload, sizeof(payload));
+
+        slab.Reset();
+        EXPECT_EQ(slab.GetFreeBlockCount(), slab.GetBlockCount());
+    }
+}
@@ -7,8 +7,66 @@
  */
 
 #include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    TEST(NetworkInputSerializer, BitPackedRoundTrip)
+    {
+        uint8_t buffer[64];
+        NetworkInputSerializer inSerializer(buffer, sizeof(buffer), SerializerPacking::BitPacked);
+
+        bool inBool = true;
+        uint8_t inSmall = 5;
+        int32_t inSigned = -17;
+        uint64_t inLarge = 0x0123456789ABCDEFull;
+        float inFloat = 3.5f;
+        double inDouble = -2.25;
+        EXPECT_TRUE(inSerializer.Serialize(inBool, "Bool"));
+        EXPECT_TRUE(inSerializer.Serialize(inSmall, "Small", uint8_t(0), uint8_t(7)));
+        EXPECT_TRUE(inSerializer.Serialize(inSigned, "Signed", -100, 100));
+        EXPECT_TRUE(inSerializer.Serialize(inLarge, "Large"));
+        EXPECT_TRUE(inSerializer.Serialize(inFloat, "Float"));
+        EXPECT_TRUE(inSerializer.Serialize(inDouble, "Double"));
+
+        // 1 + 3 + 8 + 64 + 32 + 64 bits
+        EXPECT_EQ(inSerializer.GetSize(), 22);
+
+        NetworkOutputSerializer outSerializer(buffer, inSerializer.GetSize(), SerializerPacking::BitPacked);
+        bool outBool = false;
+        uint8_t outSmall = 0;
+        int32_t outSigned = 0;
+        uint64_t outLarge = 0;
+        float outFloat = 0.0f;
+        double outDouble = 0.0;
+        EXPECT_TRUE(outSerializer.Serialize(outBool, "Bool"));
+        EXPECT_TRUE(outSerializer.Serialize(outSmall, "Small", uint8_t(0), uint8_t(7)));
+        EXPECT_TRUE(outSerializer.Serialize(outSigned, "Signed", -100, 100));
+        EXPECT_TRUE(outSerializer.Serialize(outLarge, "Large"));
+        EXPECT_TRUE(outSerializer.Serialize(outFloat, "Float"));
+        EXPECT_TRUE(outSerializer.Serialize(outDouble, "Double"));
+
+        EXPECT_EQ(inBool, outBool);
+        EXPECT_EQ(inSmall, outSmall);
+        EXPECT_EQ(inSigned, outSigned);
+        EXPECT_EQ(inLarge, outLarge);
+        EXPECT_EQ(inFloat, outFloat);
+        EXPECT_EQ(inDouble, outDouble);
+        EXPECT_EQ(outSerializer.GetReadSize(), inSerializer.GetSize());
+    }
+
+    TEST(NetworkInputSerializer, BitPackedOverflowInvalidates)
+    {
+        uint8_t buffer[1];
+        NetworkInputSerializer serializer(buffer, sizeof(buffer), SerializerPacking::BitPacked);
+
+        uint8_t value = 3;
+        EXPECT_TRUE(serializer.Serialize(value, "First", uint8_t(0), uint8_t(7)));
+        EXPECT_TRUE(serializer.Serialize(value, "Second", uint8_t(0), uint8_t(7)));
+        EXPECT_FALSE(serializer.Serialize(value, "Third", uint8_t(0), uint8_t(7)));
+        EXPECT_FALSE(serializer.IsValid());
+    }
 }
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpPacketCapture.h>
+#include <AzNetworking/UdpTransport/UdpReplaySocket.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzTest/Utils.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    class UdpPacketCaptureTests
+        : public AllocatorsFixture
+    {
+    public:
+
+        void WriteTestCapture(const char* capturePath)
+        {
+            UdpPacketCaptureWriter writer;
+            ASSERT_TRUE(writer.Open(capturePath));
+            EXPECT_TRUE(writer.IsOpen());
+
+            for (uint8_t index = 0; index < TestPacketCount; ++index)
+            {
+                uint8_t payload[TestPacketCount + 1];
+                for (uint8_t byte = 0; byte <= index; ++byte)
+                {
+                    payload[byte] = static_cast<uint8_t>(index + byte);
+                }
+                const CaptureDirection direction = (index % 2 == 0) ? CaptureDirection::Received : CaptureDirection::Sent;
+                writer.Record(direction, IpAddress(127, 0, 0, 1, 30000 + index), payload, index + 1);
+            }
+            EXPECT_EQ(writer.GetRecordedPackets(), TestPacketCount);
+            writer.Close();
+            EXPECT_FALSE(writer.IsOpen());
+        }
+
+        static constexpr uint8_t TestPacketCount = 8;
+    };
+
+    TEST_F(UdpPacketCaptureTests, CaptureRoundTrip)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string capturePath = tempDirectory.Resolve("roundtrip.azcap");
+        WriteTestCapture(capturePath.c_str());
+
+        UdpPacketCaptureReader reader;
+        ASSERT_TRUE(reader.Open(capturePath.c_str()));
+
+        for (int32_t pass = 0; pass < 2; ++pass)
+        {
+            uint64_t previousTimeUs = 0;
+            CapturedPacket packet;
+            for (uint8_t index = 0; index < TestPacketCount; ++index)
+            {
+                ASSERT_TRUE(reader.ReadNext(packet));
+                EXPECT_GE(packet.m_timeUs, previousTimeUs);
+                EXPECT_EQ(packet.m_direction, (index % 2 == 0) ? CaptureDirection::Received : CaptureDirection::Sent);
+                EXPECT_EQ(packet.m_address, IpAddress(127, 0, 0, 1, 30000 + index));
+                ASSERT_EQ(packet.m_size, index + 1u);
+                for (uint8_t byte = 0; byte <= index; ++byte)
+                {
+                    EXPECT_EQ(packet.m_data[byte], static_cast<uint8_t>(index + byte));
+                }
+                previousTimeUs = packet.m_timeUs;
+            }
+            EXPECT_FALSE(reader.ReadNext(packet));
+            reader.Rewind();
+        }
+    }
+
+    TEST_F(UdpPacketCaptureTests, TruncatedCaptureStopsReading)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string capturePath = tempDirectory.Resolve("truncated.azcap");
+        WriteTestCapture(capturePath.c_str());
+
+        UdpPacketCaptureReader reader;
+        ASSERT_TRUE(reader.Open(capturePath.c_str()));
+        uint32_t validPackets = 0;
+        CapturedPacket packet;
+        while (reader.ReadNext(packet))
+        {
+            ++validPackets;
+        }
+
+        // Drop the last byte of the final payload
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(capturePath);
+        ASSERT_TRUE(readResult.IsSuccess());
+        AZStd::vector<uint8_t> captureData = readResult.TakeValue();
+        captureData.pop_back();
+
+        ASSERT_TRUE(reader.Open(AZStd::move(captureData)));
+        uint32_t truncatedPackets = 0;
+        while (reader.ReadNext(packet))
+        {
+            ++truncatedPackets;
+        }
+        EXPECT_EQ(validPackets, TestPacketCount);
+        EXPECT_EQ(truncatedPackets, TestPacketCount - 1u);
+
+        AZStd::vector<uint8_t> invalidData = { 0, 1, 2, 3, 4, 5, 6, 7 };
+        EXPECT_FALSE(reader.Open(AZStd::move(invalidData)));
+    }
+
+    TEST_F(UdpPacketCaptureTests, ReplaySocketGathersReceivedPackets)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string capturePath = tempDirectory.Resolve("replay.azcap");
+        WriteTestCapture(capturePath.c_str());
+
+        UdpReplaySocket replaySocket;
+        ASSERT_TRUE(replaySocket.LoadCapture(capturePath.c_str()));
+        EXPECT_FALSE(replaySocket.IsReplayComplete());
+
+        // The capture spans far less than a second of capture time
+        UdpReaderThread::ReceivedPackets packets;
+        replaySocket.GatherPackets(AZ::TimeMs{ 1000 }, packets);
+        replaySocket.GatherPackets(AZ::TimeMs{ 1000 }, packets);
+        EXPECT_TRUE(replaySocket.IsReplayComplete());
+
+        // Only received packets are replayed
+        ASSERT_EQ(packets.size(), TestPacketCount / 2);
+        for (uint32_t index = 0; index < packets.size(); ++index)
+        {
+            EXPECT_EQ(packets[index].m_address, IpAddress(127, 0, 0, 1, static_cast<uint16_t>(30000 + index * 2)));
+            EXPECT_EQ(packets[index].m_receivedBytes, static_cast<int32_t>(index * 2 + 1));
+        }
+        EXPECT_EQ(replaySocket.GetRecvPackets(), TestPacketCount / 2);
+    }
+}
@@ -6,9 +6,11 @@
  *
  */
 
+#include <AzNetworking/UdpTransport/UdpConnection.h>
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpReliableQueue.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -244,6 +246,79 @@ namespace UnitTest
         EXPECT_EQ(ackState, PacketAckState::Nacked); // Testing that PacketId is not flagged as acked
     }
 
+    TEST_F(UdpTransportTests, ReliableQueueGrowsPacketWindow)
+    {
+        TestUdpServer testServer;
+        UdpNetworkInterface& networkInterface = static_cast<UdpNetworkInterface&>(*testServer.m_serverNetworkInterface);
+        UdpConnection connection(ConnectionId{ 1 }, IpAddress(127, 0, 0, 1, 12345), networkInterface, ConnectionRole::Connector);
+
+        // More pending packets than the initial ring size, with payloads spanning several slab blocks
+        constexpr uint32_t PendingPacketCount = 300;
+        const uint8_t payload[600] = {};
+
+        UdpReliableQueue reliableQueue;
+        for (uint32_t i = 0; i < PendingPacketCount; ++i)
+        {
+            const uint32_t payloadSize = 1 + (i * 13) % sizeof(payload);
+            EXPECT_TRUE(reliableQueue.PrepareForSend(PacketId{ i }, reliableQueue.GetNextSequenceId(), PacketType{ 0 }, payload, payloadSize));
+        }
+        EXPECT_EQ(reliableQueue.GetQueueSize(), PendingPacketCount);
+
+        // Every packet is still found in its new slot after the ring grew, acks only release the packet they refer to
+        for (uint32_t i = 0; i < PendingPacketCount; i += 2)
+        {
+            reliableQueue.OnPacketAcked(networkInterface, connection, PacketId{ i });
+        }
+        EXPECT_EQ(reliableQueue.GetQueueSize(), PendingPacketCount / 2);
+
+        for (uint32_t i = 1; i < PendingPacketCount; i += 2)
+        {
+            reliableQueue.OnPacketAcked(networkInterface, connection, PacketId{ i });
+        }
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 0u);
+
+        // Duplicate acks are ignored
+        reliableQueue.OnPacketAcked(networkInterface, connection, PacketId{ 0 });
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 0u);
+    }
+
+    TEST_F(UdpTransportTests, ReliableQueueSlotCollisionOnPacketIdWrap)
+    {
+        TestUdpServer testServer;
+        UdpNetworkInterface& networkInterface = static_cast<UdpNetworkInterface&>(*testServer.m_serverNetworkInterface);
+        UdpConnection connection(ConnectionId{ 1 }, IpAddress(127, 0, 0, 1, 12345), networkInterface, ConnectionRole::Connector);
+
+        // Packet ids on either side of the wrap which map to the same slot of the initial 64 slot ring
+        const PacketId beforeWrap = PacketId{ 0xFFFFFFC0 };
+        const PacketId afterWrap = PacketId{ 0 };
+        const uint8_t payload[16] = {};
+
+        UdpReliableQueue reliableQueue;
+        EXPECT_TRUE(reliableQueue.PrepareForSend(beforeWrap, reliableQueue.GetNextSequenceId(), PacketType{ 0 }, payload, sizeof(payload)));
+        EXPECT_TRUE(reliableQueue.PrepareForSend(afterWrap, reliableQueue.GetNextSequenceId(), PacketType{ 0 }, payload, sizeof(payload)));
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 2u);
+
+        // Acks of other packet ids sharing a slot with a pending packet must leave it pending
+        reliableQueue.OnPacketAcked(networkInterface, connection, PacketId{ 0xFFFFFF40 });
+        reliableQueue.OnPacketAcked(networkInterface, connection, PacketId{ 128 });
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 2u);
+        EXPECT_FALSE(reliableQueue.OnPacketLost(networkInterface, connection, PacketId{ 64 }));
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 2u);
+
+        reliableQueue.OnPacketAcked(networkInterface, connection, afterWrap);
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 1u);
+        reliableQueue.OnPacketAcked(networkInterface, connection, beforeWrap);
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 0u);
+
+        // The released slots are reused by later packet ids
+        EXPECT_TRUE(reliableQueue.PrepareForSend(PacketId{ 64 }, reliableQueue.GetNextSequenceId(), PacketType{ 0 }, payload, sizeof(payload)));
+        EXPECT_TRUE(reliableQueue.PrepareForSend(PacketId{ 128 }, reliableQueue.GetNextSequenceId(), PacketType{ 0 }, payload, sizeof(payload)));
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 2u);
+        reliableQueue.OnPacketAcked(networkInterface, connection, PacketId{ 64 });
+        reliableQueue.OnPacketAcked(networkInterface, connection, PacketId{ 128 });
+        EXPECT_EQ(reliableQueue.GetQueueSize(), 0u);
+    }
+
     TEST_F(UdpTransportTests, TestSingleClient)
     {
         TestUdpServer testServer;
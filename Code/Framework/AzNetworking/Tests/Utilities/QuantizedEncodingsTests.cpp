@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedEncodings.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    template <typename ENCODING, typename TYPE>
+    TYPE RoundTripEncoded(const TYPE& value, uint32_t& outSize)
+    {
+        uint8_t buffer[64];
+        TYPE inValue = value;
+        NetworkInputSerializer inSerializer(buffer, sizeof(buffer), SerializerPacking::BitPacked);
+        EXPECT_TRUE(ENCODING::Serialize(inSerializer, inValue, "Value"));
+        outSize = inSerializer.GetSize();
+
+        TYPE outValue = TYPE();
+        NetworkOutputSerializer outSerializer(buffer, inSerializer.GetSize(), SerializerPacking::BitPacked);
+        EXPECT_TRUE(ENCODING::Serialize(outSerializer, outValue, "Value"));
+        return outValue;
+    }
+
+    TEST(QuantizedEncodings, QuantizedFloat)
+    {
+        uint32_t size = 0;
+        const float result = RoundTripEncoded<QuantizedFloatEncoding<12, -10, 10>>(3.3f, size);
+        EXPECT_NEAR(result, 3.3f, 20.0f / 4095.0f);
+        EXPECT_EQ(size, 2);
+
+        // Values outside the range are clamped
+        EXPECT_FLOAT_EQ((RoundTripEncoded<QuantizedFloatEncoding<12, -10, 10>>(50.0f, size)), 10.0f);
+    }
+
+    TEST(QuantizedEncodings, QuantizedVector3)
+    {
+        uint32_t size = 0;
+        const AZ::Vector3 value(-512.25f, 0.0f, 1000.5f);
+        const AZ::Vector3 result = RoundTripEncoded<QuantizedVector3Encoding<20, -1024, 1024>>(value, size);
+        EXPECT_TRUE(result.IsClose(value, 2048.0f / float((1 << 20) - 1)));
+        EXPECT_EQ(size, 8);
+    }
+
+    TEST(QuantizedEncodings, SmallestThreeQuaternion)
+    {
+        const AZ::Quaternion rotations[] =
+        {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationX(1.0f),
+            AZ::Quaternion::CreateRotationY(-2.5f),
+            AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, 3.0f).GetNormalized(), 4.0f),
+            -AZ::Quaternion::CreateRotationZ(0.5f)
+        };
+
+        for (const AZ::Quaternion& rotation : rotations)
+        {
+            uint32_t size = 0;
+            const AZ::Quaternion result = RoundTripEncoded<SmallestThreeQuaternionEncoding<15>>(rotation, size);
+            // q and -q are the same rotation
+            EXPECT_GT(AZ::GetAbs(result.Dot(rotation)), 0.9999f);
+            EXPECT_EQ(size, 6);
+        }
+    }
+
+    TEST(QuantizedEncodings, SmallestThreeQuaternionZero)
+    {
+        uint32_t size = 0;
+        const AZ::Quaternion result = RoundTripEncoded<SmallestThreeQuaternionEncoding<15>>(AZ::Quaternion::CreateZero(), size);
+        EXPECT_TRUE(result.IsFinite());
+        EXPECT_TRUE(result.IsClose(AZ::Quaternion::CreateIdentity()));
+    }
+
+    TEST(QuantizedEncodings, DefaultEncodingMatchesSerializer)
+    {
+        uint32_t size = 0;
+        const AZ::Quaternion rotation = AZ::Quaternion::CreateRotationX(1.0f);
+        const AZ::Quaternion result = RoundTripEncoded<DefaultEncoding>(rotation, size);
+        EXPECT_TRUE(result.IsClose(rotation));
+        EXPECT_EQ(size, 16);
+    }
+}
@@ -7,6 +7,8 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Random.h>
@@ -16,6 +18,7 @@
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/ToolsComponents/TransformComponent.h>
@@ -1063,4 +1066,304 @@ R"DELIMITER(<ObjectStream version="1">
             }
         }
     }
+
+    // Tests for AzFramework::TransformComponent with batched hierarchy propagation enabled.
+    class TransformComponentBatchedHierarchy
+        : public TransformComponentApplication
+        , public TransformNotificationBus::MultiHandler
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentApplication::SetUp();
+
+            // The game entity context normally owns the hierarchy system, fall back to a local one if it is not running.
+            m_hierarchySystem = AZ::Interface<ITransformHierarchySystem>::Get();
+            if (!m_hierarchySystem)
+            {
+                m_localHierarchySystem = AZStd::make_unique<TransformHierarchySystem>();
+                m_localHierarchySystem->Connect();
+                m_hierarchySystem = m_localHierarchySystem.get();
+            }
+            m_wasBatchingEnabled = m_hierarchySystem->IsBatchingEnabled();
+            m_hierarchySystem->SetBatchingEnabled(true);
+        }
+
+        void TearDown() override
+        {
+            TransformNotificationBus::MultiHandler::BusDisconnect();
+            for (Entity* entity : m_entities)
+            {
+                entity->Deactivate();
+                delete entity;
+            }
+            m_entities.clear();
+
+            m_hierarchySystem->SetBatchingEnabled(m_wasBatchingEnabled);
+            if (m_localHierarchySystem)
+            {
+                m_localHierarchySystem->Disconnect();
+                m_localHierarchySystem.reset();
+            }
+
+            TransformComponentApplication::TearDown();
+        }
+
+        void OnTransformChanged(const Transform& /*local*/, const Transform& world) override
+        {
+            const EntityId entityId = *TransformNotificationBus::GetCurrentBusId();
+            m_transformChangedCounts[entityId]++;
+            m_notifiedWorldTMs[entityId] = world;
+            if (m_onTransformChanged)
+            {
+                m_onTransformChanged(entityId);
+            }
+        }
+
+        EntityId CreateEntity(const char* name, EntityId parentId, const AZ::Vector3& localTranslation)
+        {
+            Entity* entity = aznew Entity(name);
+            entity->Init();
+            entity->CreateComponent<TransformComponent>();
+            entity->Activate();
+            m_entities.push_back(entity);
+
+            const EntityId entityId = entity->GetId();
+            TransformBus::Event(entityId, &TransformBus::Events::SetLocalTranslation, localTranslation);
+            if (parentId.IsValid())
+            {
+                TransformBus::Event(entityId, &TransformBus::Events::SetParentRelative, parentId);
+            }
+            return entityId;
+        }
+
+        AZ::Vector3 GetWorldTranslation(EntityId entityId)
+        {
+            AZ::Vector3 worldTranslation = AZ::Vector3::CreateZero();
+            TransformBus::EventResult(worldTranslation, entityId, &TransformBus::Events::GetWorldTranslation);
+            return worldTranslation;
+        }
+
+        ITransformHierarchySystem* m_hierarchySystem = nullptr;
+        AZStd::unique_ptr<TransformHierarchySystem> m_localHierarchySystem;
+        bool m_wasBatchingEnabled = false;
+        AZStd::vector<Entity*> m_entities;
+        AZStd::unordered_map<EntityId, int> m_transformChangedCounts;
+        AZStd::unordered_map<EntityId, Transform> m_notifiedWorldTMs;
+        AZStd::function<void(EntityId)> m_onTransformChanged;
+    };
+
+    TEST_F(TransformComponentBatchedHierarchy, ParentMoved_DescendantsReadBeforeProcessing_ReturnLastPropagatedWorldTransforms)
+    {
+        const EntityId parentId = CreateEntity("Parent", EntityId(), AZ::Vector3(1.0f, 0.0f, 0.0f));
+        const EntityId childId = CreateEntity("Child", parentId, AZ::Vector3(0.0f, 2.0f, 0.0f));
+        const EntityId grandChildId = CreateEntity("GrandChild", childId, AZ::Vector3(0.0f, 0.0f, 3.0f));
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        TransformBus::Event(parentId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(10.0f, 0.0f, 0.0f));
+
+        // Reads don't modify the transforms, the descendants keep their world transforms until the pass.
+        EXPECT_THAT(GetWorldTranslation(grandChildId), IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+        EXPECT_THAT(GetWorldTranslation(childId), IsClose(AZ::Vector3(1.0f, 2.0f, 0.0f)));
+
+        m_hierarchySystem->ProcessTransformUpdates();
+        EXPECT_THAT(GetWorldTranslation(grandChildId), IsClose(AZ::Vector3(10.0f, 2.0f, 3.0f)));
+        EXPECT_THAT(GetWorldTranslation(childId), IsClose(AZ::Vector3(10.0f, 2.0f, 0.0f)));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, QueuedChildMoved_SetWorldTranslation_UsesUpToDateParent)
+    {
+        const EntityId parentId = CreateEntity("Parent", EntityId(), AZ::Vector3(1.0f, 0.0f, 0.0f));
+        const EntityId childId = CreateEntity("Child", parentId, AZ::Vector3(0.0f, 2.0f, 0.0f));
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        TransformBus::Event(parentId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(10.0f, 0.0f, 0.0f));
+        TransformBus::Event(childId, &TransformBus::Events::SetWorldZ, 5.0f);
+
+        AZ::Vector3 localTranslation = AZ::Vector3::CreateZero();
+        TransformBus::EventResult(localTranslation, childId, &TransformBus::Events::GetLocalTranslation);
+        EXPECT_THAT(localTranslation, IsClose(AZ::Vector3(0.0f, 2.0f, 5.0f)));
+
+        m_hierarchySystem->ProcessTransformUpdates();
+        EXPECT_THAT(GetWorldTranslation(childId), IsClose(AZ::Vector3(10.0f, 2.0f, 5.0f)));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, HandlerMovesNotifyingParent_Descendants_FollowNewParentTransform)
+    {
+        const EntityId rootId = CreateEntity("Root", EntityId(), AZ::Vector3::CreateZero());
+        const EntityId parentId = CreateEntity("Parent", rootId, AZ::Vector3(1.0f, 0.0f, 0.0f));
+        const EntityId childId = CreateEntity("Child", parentId, AZ::Vector3(0.0f, 2.0f, 0.0f));
+        const EntityId grandChildId = CreateEntity("GrandChild", childId, AZ::Vector3(0.0f, 0.0f, 3.0f));
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        TransformNotificationBus::MultiHandler::BusConnect(parentId);
+        TransformNotificationBus::MultiHandler::BusConnect(childId);
+        TransformNotificationBus::MultiHandler::BusConnect(grandChildId);
+
+        // Acts like a constraint, pinning the parent as soon as it is notified of its new world transform.
+        bool constrained = false;
+        m_onTransformChanged = [parentId, &constrained](EntityId entityId)
+        {
+            if (entityId == parentId && !constrained)
+            {
+                constrained = true;
+                TransformBus::Event(
+                    parentId, &TransformBus::Events::SetWorldTM, Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 100.0f)));
+            }
+        };
+
+        TransformBus::Event(rootId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(10.0f, 0.0f, 0.0f));
+        m_hierarchySystem->ProcessTransformUpdates();
+        m_onTransformChanged = nullptr;
+
+        EXPECT_TRUE(constrained);
+        EXPECT_THAT(GetWorldTranslation(childId), IsClose(AZ::Vector3(0.0f, 2.0f, 100.0f)));
+        EXPECT_THAT(GetWorldTranslation(grandChildId), IsClose(AZ::Vector3(0.0f, 2.0f, 103.0f)));
+        EXPECT_THAT(m_notifiedWorldTMs[childId].GetTranslation(), IsClose(AZ::Vector3(0.0f, 2.0f, 100.0f)));
+        EXPECT_THAT(m_notifiedWorldTMs[grandChildId].GetTranslation(), IsClose(AZ::Vector3(0.0f, 2.0f, 103.0f)));
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, ParentMovedTwice_ChildNotification_IsDeferredAndCoalesced)
+    {
+        const EntityId parentId = CreateEntity("Parent", EntityId(), AZ::Vector3::CreateZero());
+        const EntityId childId = CreateEntity("Child", parentId, AZ::Vector3(0.0f, 1.0f, 0.0f));
+        m_hierarchySystem->ProcessTransformUpdates();
+        TransformNotificationBus::MultiHandler::BusConnect(parentId);
+        TransformNotificationBus::MultiHandler::BusConnect(childId);
+
+        TransformBus::Event(parentId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(1.0f, 0.0f, 0.0f));
+        TransformBus::Event(parentId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(2.0f, 0.0f, 0.0f));
+
+        // The moved entity notifies immediately, only the propagation to its children is batched.
+        EXPECT_EQ(m_transformChangedCounts[parentId], 2);
+        EXPECT_EQ(m_transformChangedCounts[childId], 0);
+
+        m_hierarchySystem->ProcessTransformUpdates();
+        EXPECT_EQ(m_transformChangedCounts[childId], 1);
+        EXPECT_THAT(GetWorldTranslation(childId), IsClose(AZ::Vector3(2.0f, 1.0f, 0.0f)));
+
+        m_hierarchySystem->ProcessTransformUpdates();
+        EXPECT_EQ(m_transformChangedCounts[childId], 1);
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, ParentDeactivatedWhileChildQueued_ChildKeepsUpToDateWorldTransform)
+    {
+        const EntityId parentId = CreateEntity("Parent", EntityId(), AZ::Vector3::CreateZero());
+        const EntityId childId = CreateEntity("Child", parentId, AZ::Vector3(0.0f, 0.0f, 5.0f));
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        TransformBus::Event(parentId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(0.0f, 4.0f, 0.0f));
+        m_entities.front()->Deactivate();
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        EXPECT_THAT(GetWorldTranslation(childId), IsClose(AZ::Vector3(0.0f, 4.0f, 5.0f)));
+        m_entities.front()->Activate();
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, ManyRootsMoved_ProcessTransformUpdates_UpdatesAllDescendants)
+    {
+        constexpr int rootCount = 16;
+        constexpr int childrenPerRoot = 8;
+
+        AZStd::vector<EntityId> rootIds;
+        AZStd::vector<EntityId> childIds;
+        for (int rootIndex = 0; rootIndex < rootCount; ++rootIndex)
+        {
+            const EntityId rootId = CreateEntity("Root", EntityId(), AZ::Vector3::CreateZero());
+            rootIds.push_back(rootId);
+            for (int childIndex = 0; childIndex < childrenPerRoot; ++childIndex)
+            {
+                childIds.push_back(CreateEntity("Child", rootId, AZ::Vector3(0.0f, aznumeric_cast<float>(childIndex), 0.0f)));
+            }
+        }
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        for (int rootIndex = 0; rootIndex < rootCount; ++rootIndex)
+        {
+            TransformBus::Event(
+                rootIds[rootIndex], &TransformBus::Events::SetWorldTranslation,
+                AZ::Vector3(aznumeric_cast<float>(rootIndex), 0.0f, 0.0f));
+        }
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        for (int rootIndex = 0; rootIndex < rootCount; ++rootIndex)
+        {
+            for (int childIndex = 0; childIndex < childrenPerRoot; ++childIndex)
+            {
+                const EntityId childId = childIds[rootIndex * childrenPerRoot + childIndex];
+                EXPECT_THAT(
+                    GetWorldTranslation(childId),
+                    IsClose(AZ::Vector3(aznumeric_cast<float>(rootIndex), aznumeric_cast<float>(childIndex), 0.0f)));
+            }
+        }
+    }
+
+    TEST_F(TransformComponentBatchedHierarchy, LargeBatch_ProcessTransformUpdates_RecomputesSubtreesOnJobs)
+    {
+        // The application normally runs the job manager, fall back to a local one so the batch can't take the serial path.
+        AZStd::unique_ptr<JobManager> localJobManager;
+        AZStd::unique_ptr<JobContext> localJobContext;
+        if (!JobContext::GetGlobalContext())
+        {
+            JobManagerDesc jobDesc;
+            jobDesc.m_workerThreads.resize(4);
+            localJobManager = AZStd::make_unique<JobManager>(jobDesc);
+            localJobContext = AZStd::make_unique<JobContext>(*localJobManager);
+            JobContext::SetGlobalContext(localJobContext.get());
+        }
+
+        constexpr int rootCount = 8;
+        constexpr int childrenPerRoot = 64;
+        constexpr int grandChildrenPerChild = 10;
+        static_assert(
+            rootCount * childrenPerRoot * (grandChildrenPerChild + 1) >= TransformHierarchySystem::ParallelBatchMinTransforms,
+            "The batch must be large enough to be recomputed on jobs");
+
+        AZStd::vector<EntityId> rootIds;
+        AZStd::vector<EntityId> grandChildIds;
+        for (int rootIndex = 0; rootIndex < rootCount; ++rootIndex)
+        {
+            const EntityId rootId = CreateEntity("Root", EntityId(), AZ::Vector3::CreateZero());
+            rootIds.push_back(rootId);
+            for (int childIndex = 0; childIndex < childrenPerRoot; ++childIndex)
+            {
+                const EntityId childId = CreateEntity("Child", rootId, AZ::Vector3(0.0f, aznumeric_cast<float>(childIndex), 0.0f));
+                for (int grandChildIndex = 0; grandChildIndex < grandChildrenPerChild; ++grandChildIndex)
+                {
+                    grandChildIds.push_back(
+                        CreateEntity("GrandChild", childId, AZ::Vector3(0.0f, 0.0f, aznumeric_cast<float>(grandChildIndex))));
+                }
+            }
+        }
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        for (int rootIndex = 0; rootIndex < rootCount; ++rootIndex)
+        {
+            TransformBus::Event(
+                rootIds[rootIndex], &TransformBus::Events::SetWorldTranslation,
+                AZ::Vector3(aznumeric_cast<float>(rootIndex), 0.0f, 0.0f));
+        }
+        m_hierarchySystem->ProcessTransformUpdates();
+
+        for (int rootIndex = 0; rootIndex < rootCount; ++rootIndex)
+        {
+            for (int childIndex = 0; childIndex < childrenPerRoot; ++childIndex)
+            {
+                for (int grandChildIndex = 0; grandChildIndex < grandChildrenPerChild; ++grandChildIndex)
+                {
+                    const EntityId grandChildId =
+                        grandChildIds[(rootIndex * childrenPerRoot + childIndex) * grandChildrenPerChild + grandChildIndex];
+                    EXPECT_THAT(
+                        GetWorldTranslation(grandChildId),
+                        IsClose(AZ::Vector3(
+                            aznumeric_cast<float>(rootIndex), aznumeric_cast<float>(childIndex), aznumeric_cast<float>(grandChildIndex))));
+                }
+            }
+        }
+
+        if (localJobContext)
+        {
+            JobContext::SetGlobalContext(nullptr);
+        }
+    }
 } // namespace UnitTest
@@ -11,6 +11,7 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/Material/MaterialChangeNotificationBus.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/Feature/Material/MaterialAssignment.h>
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
@@ -18,6 +19,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -27,6 +29,7 @@ namespace AZ
         class RayTracingFeatureProcessor;
 
         class MeshDataInstance
+            : private RPI::MaterialChangeNotificationBus::MultiHandler
         {
             friend class MeshFeatureProcessor;
             friend class MeshLoader;
@@ -72,6 +75,9 @@ namespace AZ
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
 
+            // MaterialChangeNotificationBus::MultiHandler overrides...
+            void OnMaterialCompiled() override;
+
             using DrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
 
             AZStd::fixed_vector<DrawPacketList, RPI::ModelLodAsset::LodCountMax> m_drawPacketListsByLod;
@@ -99,6 +105,10 @@ namespace AZ
             bool m_excludeFromReflectionCubeMaps = false;
             bool m_visible = true;
             bool m_hasForwardPassIblSpecularMaterial = false;
+
+            //! Set when one of the materials used by the draw packets compiled new changes, so only those meshes check their
+            //! draw packets in Simulate. Materials can be compiled from other threads, hence the atomic.
+            AZStd::atomic_bool m_drawPacketsNeedUpdate{ true };
         };
 
         //! This feature processor handles static and dynamic non-skinned meshes.
@@ -95,25 +95,32 @@ namespace AZ
                             continue;   // model not loaded yet
                         }
 
-                        if (!meshDataIter->m_visible)
+                        if (meshDataIter->m_visible)
                         {
-                            continue;
+                            if (meshDataIter->m_objectSrgNeedsUpdate)
+                            {
+                                meshDataIter->UpdateObjectSrg();
+                            }
+
+                            // Material properties can impact which actual shader is used, which impacts the SRG in the draw packet,
+                            // so the draw packets are checked for material ID changes, but only after one of their materials compiled.
+                            // The flag is cleared before the update so a material compiled during the update is checked next frame.
+                            if (m_forceRebuildDrawPackets || meshDataIter->m_drawPacketsNeedUpdate)
+                            {
+                                meshDataIter->m_drawPacketsNeedUpdate = false;
+                                meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
+                            }
+
+                            if (meshDataIter->m_cullableNeedsRebuild)
+                            {
+                                meshDataIter->BuildCullable();
+                            }
                         }
 
-                        if (meshDataIter->m_objectSrgNeedsUpdate)
+                        // The cullable is only queued here, the CullingScene adds all the queued cullables as one batch before culling
+                        if (meshDataIter->m_cullBoundsNeedsUpdate)
                         {
-                            meshDataIter->UpdateObjectSrg();
-                        }
-
-                        // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
-                        // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
-                        // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
-                        // to check every one.
-                        meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
-
-                        if (meshDataIter->m_cullableNeedsRebuild)
-                        {
-                            meshDataIter->BuildCullable();
+                            meshDataIter->UpdateCullBounds(m_transformService);
                         }
                     }
                 };
@@ -124,15 +131,6 @@ namespace AZ
             jobCompletion.StartAndWaitForCompletion();
 
             m_forceRebuildDrawPackets = false;
-
-            // CullingSystem::RegisterOrUpdateCullable() is not threadsafe, so need to do those updates in a single thread
-            for (MeshDataInstance& meshDataInstance : m_meshData)
-            {
-                if (meshDataInstance.m_model && meshDataInstance.m_cullBoundsNeedsUpdate)
-                {
-                    meshDataInstance.UpdateCullBounds(m_transformService);
-                }
-            }
         }
 
         void MeshFeatureProcessor::OnBeginPrepareRender()
@@ -559,6 +557,8 @@ namespace AZ
 
         void MeshDataInstance::DeInit()
         {
+            RPI::MaterialChangeNotificationBus::MultiHandler::BusDisconnect();
+
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
 
             // remove from ray tracing
@@ -603,6 +603,7 @@ namespace AZ
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
             m_objectSrgNeedsUpdate = true;
+            m_drawPacketsNeedUpdate = true;
         }
 
         void MeshDataInstance::BuildDrawPacketList(size_t modelLodIndex)
@@ -663,6 +664,9 @@ namespace AZ
                     }
                 }
 
+                // get notified when the material compiles new changes, so the draw packet is updated with them
+                RPI::MaterialChangeNotificationBus::MultiHandler::BusConnect(material.get());
+
                 // setup the mesh draw packet
                 RPI::MeshDrawPacket drawPacket(modelLod, meshIndex, material, m_shaderResourceGroup, materialAssignment.m_matModUvOverrides);
 
@@ -997,6 +1001,11 @@ namespace AZ
             }
         }
 
+        void MeshDataInstance::OnMaterialCompiled()
+        {
+            m_drawPacketsNeedUpdate = true;
+        }
+
         void MeshDataInstance::BuildCullable()
         {
             AZ_PROFILE_FUNCTION(AzRender);
@@ -1095,7 +1104,7 @@ namespace AZ
             m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume = localAabb.GetTransformedAabb(localToWorld);
             m_cullable.m_cullData.m_visibilityEntry.m_userData = &m_cullable;
             m_cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
-            m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
+            m_scene->GetCullingScene()->QueueRegisterOrUpdateCullable(m_cullable);
 
             m_cullBoundsNeedsUpdate = false;
         }
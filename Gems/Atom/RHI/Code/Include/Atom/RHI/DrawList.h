@@ -44,6 +44,7 @@ namespace AZ
         /// Uniformly partitions the draw list and returns the sub-list denoted by the provided index.
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount);
 
+        /// Sorts the draw list in the order of the sort type. Long draw lists are sorted with a radix sort.
         void SortDrawList(DrawList& drawList, DrawListSortType sortType);
     }
 }
@@ -10,6 +10,9 @@
 #include <Atom/RHI/DrawPacket.h>
 #include <Atom/RHI/DrawList.h>
 #include <Atom/RHI/ThreadLocalContext.h>
+#include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+
+#include <AzCore/std/functional.h>
 
 namespace AZ
 {
@@ -24,13 +27,16 @@ namespace AZ
          * filtered into the table of draw lists. This is thread-safe and low contention. 
          *
          * Call FinalizeLists to transition to the consume phase. This performs sorting and coalescing
-         * of draw lists.
+         * of draw lists. Draw list tags are independent, so large draw lists can be finalized in parallel.
          *
          * Finally, in the consume phase, the context is immutable and lists are accessible via GetList.
          */
         class DrawListContext final
         {
         public:
+            /// Sorts the merged draw list of a tag, see FinalizeLists.
+            using SortFunction = AZStd::function<void(DrawList& drawList, DrawListTag drawListTag)>;
+
             DrawListContext() = default;
 
             /// Copies and moves are disabled to enforce thread safety.
@@ -51,17 +57,15 @@ namespace AZ
             /// no-op if the tag is not present in the internal draw list mask.
             void AddDrawItem(DrawListTag drawListTag, DrawItemProperties drawItemProperties);
 
-            /// Coalesces the draw lists in preparation for access via GetList. This should
-            /// be called from a single thread as a sync point between the append / consume phases.
-            void FinalizeLists();
+            /// Coalesces the draw lists in preparation for access via GetList, and sorts each non-empty merged list with
+            /// the sort function if one is provided. This should be called from a single thread as a sync point
+            /// between the append / consume phases. With the parallel job policy, the draw lists with many items
+            /// are merged and sorted in their own jobs.
+            void FinalizeLists(JobPolicy jobPolicy = JobPolicy::Serial, const SortFunction& sortFunction = {});
 
             /// Returns the draw list associated with the provided tag.
             DrawListView GetList(DrawListTag drawListTag) const;
 
-            /// Returns the collection of merged draw lists. This is only so that the View can sort the
-            /// merged draw lists and isn't intended for use outside that case.
-            DrawListsByTag& GetMergedDrawListsByTag();
-
         private:
             ThreadLocalContext<DrawListsByTag> m_threadListsByTag;
             DrawListsByTag m_mergedListsByTag;
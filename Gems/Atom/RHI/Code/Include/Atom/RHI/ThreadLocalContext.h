@@ -64,6 +64,12 @@ namespace AZ
             void ForEach(AZStd::function<void(Storage&)> visitor);
             void ForEach(AZStd::function<void(const Storage&)> visitor) const;
 
+            /**
+             * Takes a shared lock on the container and passes all thread storages to the visitor at once. This
+             * allows processing the storages together, for example from multiple jobs, while the lock is held.
+             */
+            void ForAll(AZStd::function<void(const AZStd::vector<AZStd::unique_ptr<Storage>>&)> visitor);
+
             /**
              * Clears all thread storage from the container.
              */
@@ -182,6 +188,13 @@ namespace AZ
             }
         }
 
+        template <typename Storage>
+        void ThreadLocalContext<Storage>::ForAll(AZStd::function<void(const AZStd::vector<AZStd::unique_ptr<Storage>>&)> visitor)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            visitor(m_storageList);
+        }
+
         template <typename Storage>
         void ThreadLocalContext<Storage>::Clear()
         {
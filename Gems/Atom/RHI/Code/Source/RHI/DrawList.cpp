@@ -7,12 +7,135 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Shorter draw lists are sorted with a comparison sort, which doesn't need the scratch memory of the radix sort.
+            constexpr size_t RadixSortItemCountMin = 1024;
+
+            // The draw items are sorted on a 96 bit key made of the sort key and the depth, in the order of the sort type.
+            constexpr size_t RadixSortDigitCount = 12;
+
+            struct RadixSortEntry
+            {
+                uint64_t m_highKey; //!< Most significant 64 bits of the key.
+                uint32_t m_lowKey; //!< Least significant 32 bits of the key.
+                uint32_t m_index; //!< Index of the draw item in the unsorted draw list.
+            };
+
+            // Maps the sort key to an unsigned integer with the same ordering.
+            uint64_t GetRadixSortKey(DrawItemSortKey sortKey)
+            {
+                return static_cast<uint64_t>(sortKey) ^ (uint64_t(1) << 63);
+            }
+
+            // Maps the depth to an unsigned integer with the same ordering.
+            uint32_t GetRadixSortDepth(float depth)
+            {
+                // -0.0 and 0.0 compare equal, so they must have the same key
+                if (depth == 0.0f)
+                {
+                    return 0x80000000u;
+                }
+
+                uint32_t bits;
+                memcpy(&bits, &depth, sizeof(bits));
+                return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            }
+
+            RadixSortEntry GetRadixSortEntry(const DrawItemProperties& drawItem, DrawListSortType sortType, uint32_t index)
+            {
+                const uint64_t sortKey = GetRadixSortKey(drawItem.m_sortKey);
+                uint32_t depth = GetRadixSortDepth(drawItem.m_depth);
+
+                switch (sortType)
+                {
+                case DrawListSortType::KeyThenReverseDepth:
+                    depth = ~depth;
+                    [[fallthrough]];
+                case DrawListSortType::KeyThenDepth:
+                    return RadixSortEntry{ sortKey, depth, index };
+
+                case DrawListSortType::ReverseDepthThenKey:
+                    depth = ~depth;
+                    [[fallthrough]];
+                case DrawListSortType::DepthThenKey:
+                default:
+                    return RadixSortEntry{ (uint64_t(depth) << 32) | (sortKey >> 32), static_cast<uint32_t>(sortKey), index };
+                }
+            }
+
+            uint32_t GetRadixSortDigit(const RadixSortEntry& entry, size_t digitIndex)
+            {
+                return digitIndex < 4 ?
+                    (entry.m_lowKey >> (digitIndex * 8)) & 0xff :
+                    static_cast<uint32_t>(entry.m_highKey >> ((digitIndex - 4) * 8)) & 0xff;
+            }
+
+            // Least significant digit radix sort, which is stable and linear in the number of draw items.
+            void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+            {
+                const size_t itemCount = drawList.size();
+
+                AZStd::vector<RadixSortEntry> entries;
+                entries.reserve(itemCount);
+                for (size_t i = 0; i < itemCount; ++i)
+                {
+                    entries.push_back(GetRadixSortEntry(drawList[i], sortType, static_cast<uint32_t>(i)));
+                }
+
+                // The histograms of all the digits are built in one pass
+                AZStd::array<AZStd::array<uint32_t, 256>, RadixSortDigitCount> histograms = {};
+                for (const RadixSortEntry& entry : entries)
+                {
+                    for (size_t digitIndex = 0; digitIndex < RadixSortDigitCount; ++digitIndex)
+                    {
+                        ++histograms[digitIndex][GetRadixSortDigit(entry, digitIndex)];
+                    }
+                }
+
+                AZStd::vector<RadixSortEntry> sortedEntries(itemCount);
+                for (size_t digitIndex = 0; digitIndex < RadixSortDigitCount; ++digitIndex)
+                {
+                    AZStd::array<uint32_t, 256>& histogram = histograms[digitIndex];
+
+                    // Skip the digits shared by all the draw items, like the high bits of small sort keys
+                    if (histogram[GetRadixSortDigit(entries[0], digitIndex)] == itemCount)
+                    {
+                        continue;
+                    }
+
+                    uint32_t offset = 0;
+                    for (uint32_t& count : histogram)
+                    {
+                        const uint32_t digitCount = count;
+                        count = offset;
+                        offset += digitCount;
+                    }
+
+                    for (const RadixSortEntry& entry : entries)
+                    {
+                        sortedEntries[histogram[GetRadixSortDigit(entry, digitIndex)]++] = entry;
+                    }
+                    entries.swap(sortedEntries);
+                }
+
+                DrawList sortedList;
+                sortedList.reserve(itemCount);
+                for (const RadixSortEntry& entry : entries)
+                {
+                    sortedList.push_back(drawList[entry.m_index]);
+                }
+                drawList.swap(sortedList);
+            }
+        }
+
         DrawListView GetDrawListPartition(DrawListView drawList, size_t partitionIndex, size_t partitionCount)
         {
             if (drawList.empty())
@@ -28,6 +151,12 @@ namespace AZ
 
         void SortDrawList(DrawList& drawList, DrawListSortType sortType)
         {
+            if (drawList.size() >= RadixSortItemCountMin)
+            {
+                RadixSortDrawList(drawList, sortType);
+                return;
+            }
+
             switch (sortType)
             {
             case DrawListSortType::KeyThenDepth:
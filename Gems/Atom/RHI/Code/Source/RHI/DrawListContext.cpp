@@ -7,12 +7,21 @@
  */
 #include <Atom/RHI/DrawListContext.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        namespace
+        {
+            // Draw lists with fewer items are finalized on the calling thread, a job costs more than merging and sorting them.
+            constexpr size_t ParallelFinalizeItemCountMin = 4096;
+        }
+
         bool DrawListContext::IsInitialized() const
         {
             return m_drawListMask.any();
@@ -84,29 +93,84 @@ namespace AZ
             }
         }
 
-        void DrawListContext::FinalizeLists()
+        void DrawListContext::FinalizeLists(JobPolicy jobPolicy, const SortFunction& sortFunction)
         {
-            for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
+            // The lock on the thread lists is held until all the jobs are done
+            m_threadListsByTag.ForAll([&](const AZStd::vector<AZStd::unique_ptr<DrawListsByTag>>& threadListsByTag)
             {
-                if (m_drawListMask[i])
+                const auto finalizeList = [this, &threadListsByTag, &sortFunction](size_t tagIndex, size_t itemCount)
                 {
-                    m_mergedListsByTag[i].clear();
+                    DrawList& resultList = m_mergedListsByTag[tagIndex];
+                    resultList.clear();
+                    resultList.reserve(itemCount);
+
+                    for (const AZStd::unique_ptr<DrawListsByTag>& drawListsByTag : threadListsByTag)
+                    {
+                        DrawList& sourceList = (*drawListsByTag)[tagIndex];
+                        resultList.insert(resultList.end(), sourceList.begin(), sourceList.end());
+                        sourceList.clear();
+                    }
+
+                    if (sortFunction && !resultList.empty())
+                    {
+                        sortFunction(resultList, DrawListTag(tagIndex));
+                    }
+                };
+
+                AZStd::array<size_t, Limits::Pipeline::DrawListTagCountMax> itemCounts = {};
+                for (const AZStd::unique_ptr<DrawListsByTag>& drawListsByTag : threadListsByTag)
+                {
+                    for (size_t i = 0; i < drawListsByTag->size(); ++i)
+                    {
+                        itemCounts[i] += (*drawListsByTag)[i].size();
+                    }
                 }
-            }
 
-            m_threadListsByTag.ForEach([this](DrawListsByTag& drawListsByTag)
-            {
-                for (size_t i = 0; i < drawListsByTag.size(); ++i)
+                DrawListMask parallelListMask;
+                if (jobPolicy == JobPolicy::Parallel && AZ::JobContext::GetGlobalContext())
                 {
-                    if (m_drawListMask[i])
+                    for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
                     {
-                        auto& sourceList = drawListsByTag[i];
-                        auto& resultList = m_mergedListsByTag[i];
+                        parallelListMask[i] = m_drawListMask[i] && itemCounts[i] >= ParallelFinalizeItemCountMin;
+                    }
+                }
 
-                        resultList.insert(resultList.end(), sourceList.begin(), sourceList.end());
-                        sourceList.clear();
+                AZStd::unique_ptr<AZ::JobCompletion> jobCompletion;
+                if (parallelListMask.any())
+                {
+                    jobCompletion = AZStd::make_unique<AZ::JobCompletion>();
+                    for (size_t tagIndex = 0; tagIndex < m_mergedListsByTag.size(); ++tagIndex)
+                    {
+                        if (!parallelListMask[tagIndex])
+                        {
+                            continue;
+                        }
+
+                        const size_t itemCount = itemCounts[tagIndex];
+                        const auto finalizeListLambda = [&finalizeList, tagIndex, itemCount]()
+                        {
+                            finalizeList(tagIndex, itemCount);
+                        };
+
+                        AZ::Job* finalizeListJob = AZ::CreateJobFunction(finalizeListLambda, true, nullptr); // auto-deletes
+                        finalizeListJob->SetDependent(jobCompletion.get());
+                        finalizeListJob->Start();
                     }
                 }
+
+                // The small draw lists are finalized while the jobs run
+                for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
+                {
+                    if (m_drawListMask[i] && !parallelListMask[i])
+                    {
+                        finalizeList(i, itemCounts[i]);
+                    }
+                }
+
+                if (jobCompletion)
+                {
+                    jobCompletion->StartAndWaitForCompletion();
+                }
             });
         }
 
@@ -121,10 +185,5 @@ namespace AZ
                 return {};
             }
         }
-
-        DrawListsByTag& DrawListContext::GetMergedDrawListsByTag()
-        {
-            return m_mergedListsByTag;
-        }
     }
 }
@@ -14,7 +14,13 @@
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/PipelineState.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/sort.h>
 
 #include <Tests/Factory.h>
@@ -418,6 +424,326 @@ namespace UnitTest
 
         delete drawPacket;
     }
+
+    // Builds draw items with few distinct keys and depths so that sorting has to keep ties in order.
+    // The draw item pointers are never dereferenced, they encode the original order instead.
+    static RHI::DrawList BuildSyntheticDrawList(SimpleLcgRandom& random, size_t itemCount)
+    {
+        RHI::DrawList drawList;
+        drawList.reserve(itemCount);
+        for (size_t i = 0; i < itemCount; ++i)
+        {
+            RHI::DrawItemProperties drawItemProperties(reinterpret_cast<const RHI::DrawItem*>(i + 1));
+            drawItemProperties.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 64) - 32;
+            drawItemProperties.m_depth = static_cast<float>(static_cast<int32_t>(random.GetRandom() % 32) - 16) * 0.5f;
+            if (drawItemProperties.m_depth == 0.0f && (i & 1))
+            {
+                drawItemProperties.m_depth = -0.0f;
+            }
+            drawList.push_back(drawItemProperties);
+        }
+        return drawList;
+    }
+
+    TEST_F(DrawPacketTest, SortDrawListLargeMatchesStableComparisonSort)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        const RHI::DrawList unsortedList = BuildSyntheticDrawList(random, 5000);
+
+        auto compareKeyThenDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth < b.m_depth;
+        };
+        auto compareKeyThenReverseDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth > b.m_depth;
+        };
+        auto compareDepthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_depth != b.m_depth ? a.m_depth < b.m_depth : a.m_sortKey < b.m_sortKey;
+        };
+        auto compareReverseDepthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_depth != b.m_depth ? a.m_depth > b.m_depth : a.m_sortKey < b.m_sortKey;
+        };
+
+        auto testSortType = [&unsortedList](RHI::DrawListSortType sortType, auto compare)
+        {
+            RHI::DrawList expectedList = unsortedList;
+            AZStd::stable_sort(expectedList.begin(), expectedList.end(), compare);
+
+            RHI::DrawList drawList = unsortedList;
+            RHI::SortDrawList(drawList, sortType);
+
+            ASSERT_EQ(drawList.size(), expectedList.size());
+            for (size_t i = 0; i < drawList.size(); ++i)
+            {
+                EXPECT_EQ(drawList[i].m_item, expectedList[i].m_item);
+            }
+        };
+
+        testSortType(RHI::DrawListSortType::KeyThenDepth, compareKeyThenDepth);
+        testSortType(RHI::DrawListSortType::KeyThenReverseDepth, compareKeyThenReverseDepth);
+        testSortType(RHI::DrawListSortType::DepthThenKey, compareDepthThenKey);
+        testSortType(RHI::DrawListSortType::ReverseDepthThenKey, compareReverseDepthThenKey);
+    }
+
+    TEST_F(DrawPacketTest, DrawListContextFinalizeWithSortFunction)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        const RHI::DrawList drawItems = BuildSyntheticDrawList(random, 6000);
+        const size_t tagCount = 3;
+
+        RHI::DrawListContext drawListContext;
+        drawListContext.Init(RHI::DrawListMask{}.set());
+        for (size_t i = 0; i < drawItems.size(); ++i)
+        {
+            drawListContext.AddDrawItem(RHI::DrawListTag(i % tagCount), drawItems[i]);
+        }
+
+        size_t sortedListCount = 0;
+        drawListContext.FinalizeLists(RHI::JobPolicy::Serial, [&sortedListCount](RHI::DrawList& drawList, RHI::DrawListTag)
+        {
+            RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+            ++sortedListCount;
+        });
+
+        // Only the draw lists with items are sorted.
+        EXPECT_EQ(sortedListCount, tagCount);
+
+        for (size_t tagIndex = 0; tagIndex < tagCount; ++tagIndex)
+        {
+            RHI::DrawListView drawList = drawListContext.GetList(RHI::DrawListTag(tagIndex));
+            EXPECT_EQ(drawList.size(), drawItems.size() / tagCount);
+
+            for (size_t i = 1; i < drawList.size(); ++i)
+            {
+                EXPECT_TRUE(drawList[i - 1].m_sortKey < drawList[i].m_sortKey ||
+                    (drawList[i - 1].m_sortKey == drawList[i].m_sortKey && drawList[i - 1].m_depth <= drawList[i].m_depth));
+            }
+        }
+
+        drawListContext.Shutdown();
+    }
+
+    class DrawListContextParallelTest
+        : public DrawPacketTest
+    {
+    public:
+        void SetUp() override
+        {
+            DrawPacketTest::SetUp();
+
+            JobManagerDesc jobDesc;
+            JobManagerThreadDesc threadDesc;
+            for (size_t threadIndex = 0; threadIndex < 4; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew JobManager(jobDesc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext);
+        }
+
+        void TearDown() override
+        {
+            JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            DrawPacketTest::TearDown();
+        }
+
+    protected:
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+    };
+
+    TEST_F(DrawListContextParallelTest, DrawListContextFinalizeParallel_MatchesAddedItems)
+    {
+        // Two draw lists are above the 4096 items finalized in their own jobs, the last one is finalized on this thread.
+        const AZStd::array<size_t, 3> itemCounts = { 6000, 5000, 200 };
+        const size_t chunkCount = 8;
+
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        const RHI::DrawList drawItems = BuildSyntheticDrawList(random, itemCounts[0] + itemCounts[1] + itemCounts[2]);
+        auto getTagIndex = [&itemCounts](size_t itemIndex) -> size_t
+        {
+            return itemIndex < itemCounts[0] ? 0 : (itemIndex < itemCounts[0] + itemCounts[1] ? 1 : 2);
+        };
+
+        RHI::DrawListContext drawListContext;
+        drawListContext.Init(RHI::DrawListMask{}.set());
+
+        // The draw items are added from the worker threads, so each tag is merged from several thread lists.
+        AZ::JobCompletion jobCompletion;
+        const size_t chunkSize = (drawItems.size() + chunkCount - 1) / chunkCount;
+        for (size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+        {
+            const auto addDrawItemsLambda = [&, chunkIndex]()
+            {
+                const size_t endIndex = AZStd::min(drawItems.size(), (chunkIndex + 1) * chunkSize);
+                for (size_t i = chunkIndex * chunkSize; i < endIndex; ++i)
+                {
+                    drawListContext.AddDrawItem(RHI::DrawListTag(getTagIndex(i)), drawItems[i]);
+                }
+            };
+
+            AZ::Job* addDrawItemsJob = AZ::CreateJobFunction(addDrawItemsLambda, true, nullptr);
+            addDrawItemsJob->SetDependent(&jobCompletion);
+            addDrawItemsJob->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        AZStd::atomic<size_t> sortedListCount{ 0 };
+        drawListContext.FinalizeLists(RHI::JobPolicy::Parallel, [&sortedListCount](RHI::DrawList& drawList, RHI::DrawListTag)
+        {
+            RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+            ++sortedListCount;
+        });
+
+        EXPECT_EQ(sortedListCount.load(), itemCounts.size());
+
+        auto compareItem = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+        {
+            return a.m_item < b.m_item;
+        };
+
+        size_t firstItemIndex = 0;
+        for (size_t tagIndex = 0; tagIndex < itemCounts.size(); ++tagIndex)
+        {
+            RHI::DrawListView drawList = drawListContext.GetList(RHI::DrawListTag(tagIndex));
+            ASSERT_EQ(drawList.size(), itemCounts[tagIndex]);
+
+            for (size_t i = 1; i < drawList.size(); ++i)
+            {
+                EXPECT_TRUE(drawList[i - 1].m_sortKey < drawList[i].m_sortKey ||
+                    (drawList[i - 1].m_sortKey == drawList[i].m_sortKey && drawList[i - 1].m_depth <= drawList[i].m_depth));
+            }
+
+            // The order of the threads' lists isn't deterministic, so only the set of draw items is compared.
+            RHI::DrawList expectedItems(drawItems.begin() + firstItemIndex, drawItems.begin() + firstItemIndex + itemCounts[tagIndex]);
+            RHI::DrawList finalizedItems(drawList.begin(), drawList.end());
+            AZStd::sort(expectedItems.begin(), expectedItems.end(), compareItem);
+            AZStd::sort(finalizedItems.begin(), finalizedItems.end(), compareItem);
+            for (size_t i = 0; i < finalizedItems.size(); ++i)
+            {
+                EXPECT_EQ(finalizedItems[i].m_item, expectedItems[i].m_item);
+            }
+
+            firstItemIndex += itemCounts[tagIndex];
+        }
+
+        // The thread lists are emptied, so finalizing again yields empty draw lists.
+        drawListContext.FinalizeLists(RHI::JobPolicy::Parallel);
+        for (size_t tagIndex = 0; tagIndex < itemCounts.size(); ++tagIndex)
+        {
+            EXPECT_TRUE(drawListContext.GetList(RHI::DrawListTag(tagIndex)).empty());
+        }
+
+        drawListContext.Shutdown();
+    }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+
+    class DrawListContextBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc jobDesc;
+            JobManagerThreadDesc threadDesc;
+            for (uint32_t threadIndex = 0; threadIndex < AZStd::max(AZStd::thread::hardware_concurrency(), 2u) - 1; ++threadIndex)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew JobManager(jobDesc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+            JobContext::SetGlobalContext(m_jobContext);
+
+            // Synthetic draw items spread over a few tags, the draw item pointers are never dereferenced.
+            SimpleLcgRandom random(1234);
+            const size_t itemCount = aznumeric_cast<size_t>(state.range(0));
+            m_drawItems.reserve(itemCount);
+            for (size_t i = 0; i < itemCount; ++i)
+            {
+                RHI::DrawItemProperties drawItemProperties(reinterpret_cast<const RHI::DrawItem*>(i + 1), random.GetRandom());
+                drawItemProperties.m_depth = random.GetRandomFloat() * 1000.0f;
+                m_drawItems.push_back(drawItemProperties);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_drawItems = {};
+
+            JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void FinalizeLists(::benchmark::State& state, RHI::JobPolicy jobPolicy)
+        {
+            const size_t tagCount = 8;
+
+            RHI::DrawListContext drawListContext;
+            drawListContext.Init(RHI::DrawListMask{}.set());
+            for ([[maybe_unused]] auto _ : state)
+            {
+                state.PauseTiming();
+                for (size_t i = 0; i < m_drawItems.size(); ++i)
+                {
+                    drawListContext.AddDrawItem(RHI::DrawListTag(i % tagCount), m_drawItems[i]);
+                }
+                state.ResumeTiming();
+
+                drawListContext.FinalizeLists(jobPolicy, [](RHI::DrawList& drawList, RHI::DrawListTag)
+                {
+                    RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+                });
+            }
+            drawListContext.Shutdown();
+
+            state.SetItemsProcessed(state.iterations() * m_drawItems.size());
+        }
+
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+        RHI::DrawList m_drawItems;
+    };
+
+    BENCHMARK_DEFINE_F(DrawListContextBenchmarkFixture, FinalizeLists_Serial)(benchmark::State& state)
+    {
+        FinalizeLists(state, RHI::JobPolicy::Serial);
+    }
+    BENCHMARK_REGISTER_F(DrawListContextBenchmarkFixture, FinalizeLists_Serial)
+        ->RangeMultiplier(4)
+        ->Range(1 << 16, 1 << 22)
+        ->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(DrawListContextBenchmarkFixture, FinalizeLists_Parallel)(benchmark::State& state)
+    {
+        FinalizeLists(state, RHI::JobPolicy::Parallel);
+    }
+    BENCHMARK_REGISTER_F(DrawListContextBenchmarkFixture, FinalizeLists_Parallel)
+        ->RangeMultiplier(4)
+        ->Range(1 << 16, 1 << 22)
+        ->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -13,6 +13,7 @@
 #include <AzCore/base.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -115,6 +116,9 @@ namespace AZ
             //! something that shouldn't be rendered, regardless of its actual position relative to the camera
             bool m_isHidden = false;
 
+            //! Flag indicating if the object is waiting in the CullingScene's queue, see CullingScene::QueueRegisterOrUpdateCullable()
+            bool m_isQueuedForUpdate = false;
+
             void SetDebugName([[maybe_unused]] const AZ::Name& debugName)
             {
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -263,7 +267,14 @@ namespace AZ
             //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
             void RegisterOrUpdateCullable(Cullable& cullable);
 
-            //! Removes a Cullable from the underlying visibility system(s).
+            //! Queues a Cullable to be added to or updated in the underlying visibility system(s).
+            //! Unlike RegisterOrUpdateCullable() this is threadsafe, so feature processors can call it from their parallel update jobs.
+            //! The queued cullables are added to the visibility system(s) as one batch when the next BeginCulling() starts,
+            //! a cullable queued several times before that is only updated once.
+            //! A cullable must not be queued from multiple threads at the same time, and nothing can be queued between Begin/EndCulling().
+            void QueueRegisterOrUpdateCullable(Cullable& cullable);
+
+            //! Removes a Cullable from the underlying visibility system(s), and from the queue if it was queued.
             //! Must be called once for each cullable object on de-initialization.
             //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
             void UnregisterCullable(Cullable& cullable);
@@ -282,11 +293,24 @@ namespace AZ
         protected:
             size_t CountObjectsInScene();
 
+            //! Adds all the queued cullables to the visibility scene as one batch.
+            void FlushQueuedCullables();
+
+            //! Cullables are queued in one of several lists picked by thread, so parallel jobs rarely wait on each other's lock.
+            struct QueuedCullableList
+            {
+                AZStd::mutex m_mutex;
+                AZStd::vector<Cullable*> m_cullables;
+            };
+            static const size_t QueuedCullableListCount = 16;
+
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+            AZStd::array<QueuedCullableList, QueuedCullableListCount> m_queuedCullableLists;
+            AZStd::vector<AzFramework::VisibilityEntry*> m_queuedVisibilityEntries; //!< Batch passed to the visibility scene, kept to reuse its memory
         };
         
 
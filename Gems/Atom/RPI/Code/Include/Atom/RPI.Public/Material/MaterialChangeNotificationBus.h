@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/EBus.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Material;
+
+        //! Connect to this EBus to get notifications whenever a material instance applies new changes.
+        //! The bus address is the Material instance, so only users of that particular instance are notified.
+        //!
+        //! This is signaled by every successful Material::Compile(), including the ones done when the material reinitializes
+        //! itself in response to a material, shader or shader variant reload. Anything caching data derived from the material's
+        //! outputs, like draw packets, can use it to know when to check for updates instead of polling the material every frame.
+        class MaterialChangeNotifications
+            : public EBusTraits
+        {
+
+        public:
+            //////////////////////////////////////////////////////////////////////////
+            // EBusTraits overrides
+            static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+            typedef const Material* BusIdType;
+            typedef AZStd::recursive_mutex MutexType;
+            //////////////////////////////////////////////////////////////////////////
+
+            virtual ~MaterialChangeNotifications() {}
+
+            //! Called when the material has compiled its latest property changes, see Material::GetCurrentChangeId().
+            //! This can be called from any thread that compiles the material.
+            virtual void OnMaterialCompiled() {}
+        };
+
+        typedef EBus<MaterialChangeNotifications> MaterialChangeNotificationBus;
+
+    } // namespace RPI
+} //namespace AZ
@@ -50,6 +50,15 @@ namespace AZ
 
             Data::Instance<Material> GetMaterial();
 
+            //! Finds or creates the DrawSrg for draw items using the given shader variant and mesh streams.
+            //! Its contents only depend on these, so every matching draw item shares the same compiled instance.
+            //! Returns null if the shader has no DrawSrg or the instance could not be created.
+            static Data::Instance<ShaderResourceGroup> FindOrCreateSharedDrawSrg(
+                Shader& shader,
+                const ShaderVariant& variant,
+                const ShaderOptionGroup& shaderOptions,
+                const UvStreamTangentBitmask& uvStreamTangentBitmask);
+
         private:
             bool DoUpdate(const Scene& parentScene);
 
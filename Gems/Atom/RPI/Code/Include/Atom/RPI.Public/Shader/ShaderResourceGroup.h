@@ -22,6 +22,8 @@
 #include <AtomCore/Instance/InstanceId.h>
 #include <AtomCore/Instance/InstanceData.h>
 
+#include <AzCore/std/functional.h>
+
 namespace AZ
 {
     namespace RHI
@@ -66,6 +68,15 @@ namespace AZ
             static Data::Instance<ShaderResourceGroup> Create(
                 const Data::Asset<ShaderAsset>& shaderAsset, const SupervariantIndex& supervariantIndex, const AZ::Name& srgName);
 
+            using InitializeFunction = AZStd::function<void(ShaderResourceGroup&)>;
+
+            /// Finds the shader resource group instance with the given InstanceId, or instantiates it using its paired asset.
+            /// This allows sharing one instance between users which agree on its contents, see MeshDrawPacket's draw SRGs.
+            /// A newly created instance is passed to initializeFunction before it can be found by any other caller.
+            static Data::Instance<ShaderResourceGroup> FindOrCreate(
+                const Data::InstanceId& instanceId, const Data::Asset<ShaderAsset>& shaderAsset, const SupervariantIndex& supervariantIndex, const AZ::Name& srgName,
+                const InitializeFunction& initializeFunction = {});
+
             /// Queues a request that the underlying hardware shader resource group be compiled.
             void Compile();
 
@@ -287,6 +298,7 @@ namespace AZ
                 AZ_TYPE_INFO(SrgInitParams, "{FDBDDB75-3DE6-4383-8D19-C0092246A411}");
                 SupervariantIndex m_supervariantIndex;
                 AZ::Name m_srgName;
+                const InitializeFunction* m_initializeFunction = nullptr;
             };
 
             //! Usually subclasses of AZ::Data::InstanceData leverage the AssetId of the given asset as a means to define
@@ -96,8 +96,9 @@ namespace AZ
             AZ::Transform GetCameraTransform() const;
 
             //! Finalize draw lists in this view. This function should only be called when all
-            //! draw packets for current frame are added. 
-            void FinalizeDrawLists();
+            //! draw packets for current frame are added. With the parallel job policy, large draw
+            //! lists are merged and sorted in their own jobs.
+            void FinalizeDrawLists(RHI::JobPolicy jobPolicy = RHI::JobPolicy::Serial);
 
             bool HasDrawListTag(RHI::DrawListTag drawListTag);
 
@@ -135,9 +136,6 @@ namespace AZ
             View(const AZ::Name& name, UsageFlags usage);
 
 
-            //! Sorts the finalized draw lists in this view
-            void SortFinalizedDrawLists();
-
             //! Sorts a drawList using the sort function from a pass with the corresponding drawListTag
             void SortDrawList(RHI::DrawList& drawList, RHI::DrawListTag tag);
 
@@ -19,7 +19,9 @@
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Debug/Timer.h>
@@ -250,6 +252,22 @@ namespace AZ
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
+        void CullingScene::QueueRegisterOrUpdateCullable(Cullable& cullable)
+        {
+            m_cullDataConcurrencyCheck.soft_lock_shared();
+            if (!cullable.m_isQueuedForUpdate)
+            {
+                cullable.m_isQueuedForUpdate = true;
+
+                // Spread the threads over the lists, the thread id itself is often an aligned address
+                const size_t threadHash = AZStd::hash<AZStd::thread_id>()(AZStd::this_thread::get_id()) * 0x9E3779B97F4A7C15ull;
+                QueuedCullableList& queuedList = m_queuedCullableLists[(threadHash >> 32) % QueuedCullableListCount];
+                AZStd::lock_guard<AZStd::mutex> lock(queuedList.m_mutex);
+                queuedList.m_cullables.push_back(&cullable);
+            }
+            m_cullDataConcurrencyCheck.soft_unlock_shared();
+        }
+
         void CullingScene::UnregisterCullable(Cullable& cullable)
         {
             // Multiple threads can call RegisterOrUpdateCullable at the same time
@@ -258,10 +276,48 @@ namespace AZ
             // results depending on a race condition if you happen to update before or after
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
+            if (cullable.m_isQueuedForUpdate)
+            {
+                // Rare, the cullable was moved and removed within the same frame
+                for (QueuedCullableList& queuedList : m_queuedCullableLists)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(queuedList.m_mutex);
+                    auto cullableIt = AZStd::find(queuedList.m_cullables.begin(), queuedList.m_cullables.end(), &cullable);
+                    if (cullableIt != queuedList.m_cullables.end())
+                    {
+                        *cullableIt = queuedList.m_cullables.back();
+                        queuedList.m_cullables.pop_back();
+                        break;
+                    }
+                }
+                cullable.m_isQueuedForUpdate = false;
+            }
             m_visScene->RemoveEntry(cullable.m_cullData.m_visibilityEntry);
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
+        void CullingScene::FlushQueuedCullables()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            m_queuedVisibilityEntries.clear();
+            for (QueuedCullableList& queuedList : m_queuedCullableLists)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(queuedList.m_mutex);
+                for (Cullable* cullable : queuedList.m_cullables)
+                {
+                    cullable->m_isQueuedForUpdate = false;
+                    m_queuedVisibilityEntries.push_back(&cullable->m_cullData.m_visibilityEntry);
+                }
+                queuedList.m_cullables.clear();
+            }
+
+            if (!m_queuedVisibilityEntries.empty())
+            {
+                m_visScene->InsertOrUpdateEntries(m_queuedVisibilityEntries);
+            }
+        }
+
         uint32_t CullingScene::GetNumCullables() const
         {
             return m_visScene->GetEntryCount();
@@ -726,6 +782,7 @@ namespace AZ
         void CullingScene::BeginCulling(const AZStd::vector<ViewPtr>& views)
         {
             AZ_ATOM_PROFILE_FUNCTION("RPI", "CullingScene: BeginCulling");
+            FlushQueuedCullables();
             m_cullDataConcurrencyCheck.soft_lock();
 
             m_debugCtx.ResetCullStats();
@@ -8,6 +8,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialChangeNotificationBus.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
@@ -350,6 +351,8 @@ namespace AZ
 
                 m_compiledChangeId = m_currentChangeId;
 
+                MaterialChangeNotificationBus::Event(this, &MaterialChangeNotifications::OnMaterialCompiled);
+
                 return true;
             }
 
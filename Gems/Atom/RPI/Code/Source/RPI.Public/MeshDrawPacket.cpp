@@ -14,6 +14,7 @@
 #include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
 #include <Atom/RHI/RHISystemInterface.h>
+#include <AtomCore/Instance/InstanceDatabase.h>
 #include <AzCore/Console/Console.h>
 
 namespace AZ
@@ -28,6 +29,22 @@ namespace AZ
             "(For Testing) Forces usage of root shader variant in the mesh draw packet level, ignoring any other shader variants that may exist."
         );
 
+        // Everything the contents of a shared DrawSrg depend on, hashed into its InstanceId.
+        // Members are laid out without padding so that equal keys always hash to the same id.
+        struct SharedDrawSrgKey
+        {
+            // Stored as raw bytes, the alignment of Uuid would otherwise pad the struct
+            uint8_t m_shaderAssetGuid[sizeof(Uuid)] = {};
+            uint32_t m_shaderAssetSubId = 0;
+            uint32_t m_supervariantIndex = 0;
+            HashValue64 m_drawSrgLayoutHash = HashValue64{ 0 };
+            uint32_t m_uvStreamTangentBitmask = 0;
+            uint32_t m_useFallbackValue = 0;
+            ShaderVariantKey m_fallbackValue;
+        };
+        static_assert(sizeof(SharedDrawSrgKey) == sizeof(SharedDrawSrgKey::m_shaderAssetGuid) + 2 * sizeof(uint32_t) + sizeof(HashValue64) + 2 * sizeof(uint32_t) + sizeof(ShaderVariantKey),
+            "SharedDrawSrgKey must not contain padding");
+
         MeshDrawPacket::MeshDrawPacket(
             ModelLod& modelLod,
             size_t modelLodMeshIndex,
@@ -48,6 +65,60 @@ namespace AZ
             }
         }
 
+        Data::Instance<ShaderResourceGroup> MeshDrawPacket::FindOrCreateSharedDrawSrg(
+            Shader& shader,
+            const ShaderVariant& variant,
+            const ShaderOptionGroup& shaderOptions,
+            const UvStreamTangentBitmask& uvStreamTangentBitmask)
+        {
+            const RHI::Ptr<RHI::ShaderResourceGroupLayout>& drawSrgLayout = shader.GetAsset()->GetDrawSrgLayout(shader.GetSupervariantIndex());
+            if (!drawSrgLayout)
+            {
+                return nullptr;
+            }
+
+            SharedDrawSrgKey drawSrgKey;
+            const Uuid& shaderAssetGuid = shader.GetAsset().GetId().m_guid;
+            AZStd::copy(shaderAssetGuid.begin(), shaderAssetGuid.end(), drawSrgKey.m_shaderAssetGuid);
+            drawSrgKey.m_shaderAssetSubId = shader.GetAsset().GetId().m_subId;
+            drawSrgKey.m_supervariantIndex = shader.GetSupervariantIndex().GetIndex();
+            drawSrgKey.m_drawSrgLayoutHash = drawSrgLayout->GetHash();
+            drawSrgKey.m_uvStreamTangentBitmask = uvStreamTangentBitmask.GetFullTangentBitmask();
+            drawSrgKey.m_useFallbackValue = !variant.IsFullyBaked() && drawSrgLayout->HasShaderVariantKeyFallbackEntry();
+            if (drawSrgKey.m_useFallbackValue)
+            {
+                drawSrgKey.m_fallbackValue = shaderOptions.GetShaderVariantKeyFallbackValue();
+            }
+            const Data::InstanceId drawSrgId = Data::InstanceId::CreateData(&drawSrgKey, sizeof(drawSrgKey));
+
+            Data::Instance<ShaderResourceGroup> drawSrg = Data::InstanceDatabase<ShaderResourceGroup>::Instance().Find(drawSrgId);
+            if (drawSrg)
+            {
+                return drawSrg;
+            }
+
+            // Draw packets are updated from multiple jobs, the DrawSrg is initialized before any of them can find it
+            return ShaderResourceGroup::FindOrCreate(drawSrgId, shader.GetAsset(), shader.GetSupervariantIndex(), drawSrgLayout->GetName(),
+                [&drawSrgKey](ShaderResourceGroup& newDrawSrg)
+                {
+                    if (drawSrgKey.m_useFallbackValue)
+                    {
+                        newDrawSrg.SetShaderVariantKeyFallbackValue(drawSrgKey.m_fallbackValue);
+                    }
+
+                    // Pass UvStreamTangentBitmask to the shader if the draw SRG has it.
+                    AZ::Name shaderUvStreamTangentBitmask = AZ::Name(UvStreamTangentBitmask::SrgName);
+                    auto index = newDrawSrg.FindShaderInputConstantIndex(shaderUvStreamTangentBitmask);
+
+                    if (index.IsValid())
+                    {
+                        newDrawSrg.SetConstant(index, drawSrgKey.m_uvStreamTangentBitmask);
+                    }
+
+                    newDrawSrg.Compile();
+                });
+        }
+
         Data::Instance<Material> MeshDrawPacket::GetMaterial()
         {
             return m_material;
@@ -249,30 +320,16 @@ namespace AZ
                     return false;
                 }
 
-                auto drawSrgLayout = shader->GetAsset()->GetDrawSrgLayout(shader->GetSupervariantIndex());
+                // If the DrawSrg exists we must create and bind it, otherwise the CommandList will fail validation for SRG being null.
                 Data::Instance<ShaderResourceGroup> drawSrg;
-                if (drawSrgLayout)
+                if (shader->GetAsset()->GetDrawSrgLayout(shader->GetSupervariantIndex()))
                 {
-                    // If the DrawSrg exists we must create and bind it, otherwise the CommandList will fail validation for SRG being null
-                    drawSrg = RPI::ShaderResourceGroup::Create(shader->GetAsset(), shader->GetSupervariantIndex(), drawSrgLayout->GetName());
-
-                    if (!variant.IsFullyBaked() && drawSrgLayout->HasShaderVariantKeyFallbackEntry())
+                    drawSrg = FindOrCreateSharedDrawSrg(*shader, variant, shaderOptions, uvStreamTangentBitmask);
+                    if (!drawSrg)
                     {
-                        drawSrg->SetShaderVariantKeyFallbackValue(shaderOptions.GetShaderVariantKeyFallbackValue());
-                    }
-
-                    // Pass UvStreamTangentBitmask to the shader if the draw SRG has it.
-                    {
-                        AZ::Name shaderUvStreamTangentBitmask = AZ::Name(UvStreamTangentBitmask::SrgName);
-                        auto index = drawSrg->FindShaderInputConstantIndex(shaderUvStreamTangentBitmask);
-
-                        if (index.IsValid())
-                        {
-                            drawSrg->SetConstant(index, uvStreamTangentBitmask.GetFullTangentBitmask());
-                        }
+                        AZ_Error("MeshDrawPacket", false, "Shader '%s'. Failed to create the draw ShaderResourceGroup", shaderItem.GetShaderAsset()->GetName().GetCStr());
+                        return false;
                     }
-
-                    drawSrg->Compile();
                 }
 
                 parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
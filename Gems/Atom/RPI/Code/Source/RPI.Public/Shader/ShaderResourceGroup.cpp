@@ -58,6 +58,15 @@ namespace AZ
                 Data::InstanceId::CreateRandom(), shaderAsset, &anyInitParams);
         }
 
+        Data::Instance<ShaderResourceGroup> ShaderResourceGroup::FindOrCreate(
+            const Data::InstanceId& instanceId, const Data::Asset<ShaderAsset>& shaderAsset, const SupervariantIndex& supervariantIndex, const AZ::Name& srgName,
+            const InitializeFunction& initializeFunction)
+        {
+            SrgInitParams initParams{ supervariantIndex, srgName, initializeFunction ? &initializeFunction : nullptr };
+            auto anyInitParams = AZStd::any(initParams);
+            return Data::InstanceDatabase<ShaderResourceGroup>::Instance().FindOrCreate(instanceId, shaderAsset, &anyInitParams);
+        }
+
         Data::Instance<ShaderResourceGroup> ShaderResourceGroup::CreateInternal(ShaderAsset& shaderAsset, const AZStd::any* anySrgInitParams)
         {
             AZ_Assert(anySrgInitParams, "Invalid SrgInitParams");
@@ -70,6 +79,12 @@ namespace AZ
                 return nullptr;
             }
 
+            // The instance database only publishes the instance once this returns, so other callers never see it uninitialized
+            if (srgInitParams.m_initializeFunction)
+            {
+                (*srgInitParams.m_initializeFunction)(*srg);
+            }
+
             return srg;
         }
 
@@ -237,30 +237,28 @@ namespace AZ
             return m_drawListContext.GetList(drawListTag);
         }
 
-        void View::FinalizeDrawLists()
+        void View::FinalizeDrawLists(RHI::JobPolicy jobPolicy)
         {
             AZ_PROFILE_FUNCTION(RPI);
-            m_drawListContext.FinalizeLists();
-            SortFinalizedDrawLists();
-        }
-
-        void View::SortFinalizedDrawLists()
-        {
-            RHI::DrawListsByTag& drawListsByTag = m_drawListContext.GetMergedDrawListsByTag();
 
-            for (size_t idx = 0; idx < drawListsByTag.size(); ++idx)
+            // Each draw list is sorted as soon as it's merged, so the draw lists of different tags can be finalized in parallel
+            m_drawListContext.FinalizeLists(jobPolicy, [this](RHI::DrawList& drawList, RHI::DrawListTag tag)
             {
-                if (drawListsByTag[idx].size() > 1)
+                if (drawList.size() > 1)
                 {
-                    SortDrawList(drawListsByTag[idx], RHI::DrawListTag(idx));
+                    SortDrawList(drawList, tag);
                 }
-            }
+            });
         }
 
         void View::SortDrawList(RHI::DrawList& drawList, RHI::DrawListTag tag)
         {
-            const Pass* passWithDrawListTag = (*m_passesByDrawList)[tag];
-            passWithDrawListTag->SortDrawList(drawList);
+            // find() instead of operator[] since this can be called from multiple jobs
+            const auto passIt = m_passesByDrawList->find(tag);
+            if (passIt != m_passesByDrawList->end())
+            {
+                passIt->second->SortDrawList(drawList);
+            }
         }
 
         void View::ConnectWorldToViewMatrixChangedHandler(View::MatrixChangedEvent::Handler& handler)
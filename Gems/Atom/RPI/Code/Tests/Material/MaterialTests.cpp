@@ -14,6 +14,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialChangeNotificationBus.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Material/MaterialAssetCreator.h>
@@ -364,6 +365,50 @@ namespace UnitTest
         EXPECT_FALSE(material->GetRHIShaderResourceGroup());
     }
 
+    class MaterialCompiledCounter
+        : public MaterialChangeNotificationBus::Handler
+    {
+    public:
+        ~MaterialCompiledCounter()
+        {
+            MaterialChangeNotificationBus::Handler::BusDisconnect();
+        }
+
+        void OnMaterialCompiled() override
+        {
+            ++m_compiledCount;
+        }
+
+        uint32_t m_compiledCount = 0;
+    };
+
+    TEST_F(MaterialTests, TestMaterialCompiledNotification)
+    {
+        Data::Instance<Material> material = Material::Create(m_testMaterialAsset);
+        Data::Instance<Material> otherMaterial = Material::Create(m_testMaterialAsset);
+
+        MaterialCompiledCounter counter;
+        counter.BusConnect(material.get());
+
+        // Nothing to compile, no notification
+        EXPECT_FALSE(material->Compile());
+        EXPECT_EQ(counter.m_compiledCount, 0);
+
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+        EXPECT_TRUE(otherMaterial->SetPropertyValue<float>(otherMaterial->FindPropertyIndex(Name{ "MyFloat" }), 2.5f));
+        EXPECT_EQ(counter.m_compiledCount, 0);
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+
+        // Only the handlers of the compiled instance are notified
+        EXPECT_TRUE(otherMaterial->Compile());
+        EXPECT_EQ(counter.m_compiledCount, 0);
+
+        EXPECT_TRUE(material->Compile());
+        EXPECT_EQ(counter.m_compiledCount, 1);
+        EXPECT_FALSE(material->NeedsCompile());
+    }
+
     Ptr<ShaderOptionGroupLayout> CreateTestOptionsLayout()
     {
         AZStd::vector<RPI::ShaderOptionValuePair> enumOptionValues;
@@ -10,8 +10,11 @@
 #include <Common/RPITestFixture.h>
 #include <Common/ShaderAssetTestUtils.h>
 
+#include <Atom/RPI.Public/MeshDrawPacket.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 
+#include <AtomCore/Instance/InstanceDatabase.h>
+
 namespace UnitTest
 {
     using namespace AZ;
@@ -73,6 +76,99 @@ namespace UnitTest
         EXPECT_NE(srgInstance3, srgInstance4);
     }
 
+    TEST_F(ShaderResourceGroupGeneralTests, TestFindOrCreate)
+    {
+        const Data::InstanceId sharedId = Data::InstanceId::CreateName("SharedTestSrg");
+        Data::Instance<ShaderResourceGroup> srgInstance1 = ShaderResourceGroup::FindOrCreate(sharedId, m_testShaderAsset, AZ::RPI::DefaultSupervariantIndex, m_testSrgLayout->GetName());
+        Data::Instance<ShaderResourceGroup> srgInstance2 = ShaderResourceGroup::FindOrCreate(sharedId, m_testShaderAsset, AZ::RPI::DefaultSupervariantIndex, m_testSrgLayout->GetName());
+        Data::Instance<ShaderResourceGroup> srgInstance3 = ShaderResourceGroup::FindOrCreate(
+            Data::InstanceId::CreateName("OtherTestSrg"), m_testShaderAsset, AZ::RPI::DefaultSupervariantIndex, m_testSrgLayout->GetName());
+
+        EXPECT_TRUE(srgInstance1);
+        EXPECT_TRUE(srgInstance3);
+
+        // Instances created via FindOrCreate with the same id should be the same object
+
+        EXPECT_EQ(srgInstance1, srgInstance2);
+        EXPECT_NE(srgInstance1, srgInstance3);
+
+        // The instance is released with its last reference
+
+        srgInstance1 = nullptr;
+        srgInstance2 = nullptr;
+        EXPECT_FALSE(Data::InstanceDatabase<ShaderResourceGroup>::Instance().Find(sharedId));
+    }
+
+    TEST_F(ShaderResourceGroupGeneralTests, TestFindOrCreateInitializesOnce)
+    {
+        const Data::InstanceId sharedId = Data::InstanceId::CreateName("InitializedTestSrg");
+        uint32_t initializeCount = 0;
+        auto initialize = [&initializeCount](ShaderResourceGroup& srg)
+        {
+            ++initializeCount;
+            srg.SetConstant(srg.FindShaderInputConstantIndex(Name{ "MyFloatA" }), 1.0f);
+        };
+
+        Data::Instance<ShaderResourceGroup> srgInstance1 = ShaderResourceGroup::FindOrCreate(sharedId, m_testShaderAsset, AZ::RPI::DefaultSupervariantIndex, m_testSrgLayout->GetName(), initialize);
+        Data::Instance<ShaderResourceGroup> srgInstance2 = ShaderResourceGroup::FindOrCreate(sharedId, m_testShaderAsset, AZ::RPI::DefaultSupervariantIndex, m_testSrgLayout->GetName(), initialize);
+
+        ASSERT_TRUE(srgInstance1);
+        EXPECT_EQ(srgInstance1, srgInstance2);
+
+        // Only the caller creating the instance initializes it
+
+        EXPECT_EQ(1, initializeCount);
+        EXPECT_EQ(1.0f, srgInstance2->GetConstant<float>(srgInstance2->FindShaderInputConstantIndex(Name{ "MyFloatA" })));
+    }
+
+    TEST_F(ShaderResourceGroupGeneralTests, TestMeshDrawPacketSharesDrawSrg)
+    {
+        RHI::Ptr<RHI::ShaderResourceGroupLayout> drawSrgLayout = RHI::ShaderResourceGroupLayout::Create();
+        drawSrgLayout->SetName(Name("TestDrawSrg"));
+        drawSrgLayout->SetBindingSlot(SrgBindingSlot::Draw);
+        drawSrgLayout->AddShaderInput(RHI::ShaderInputConstantDescriptor{ Name{ UvStreamTangentBitmask::SrgName }, 0, 4, 0 });
+        drawSrgLayout->Finalize();
+
+        Data::Instance<Shader> shader = Shader::FindOrCreate(CreateTestShaderAsset(Uuid::CreateRandom(), drawSrgLayout));
+        ASSERT_TRUE(shader);
+        const ShaderOptionGroup shaderOptions = shader->CreateShaderOptionGroup();
+
+        UvStreamTangentBitmask oneUvStream;
+        oneUvStream.ApplyTangent(0);
+        UvStreamTangentBitmask twoUvStreams = oneUvStream;
+        twoUvStreams.ApplyTangent(UvStreamTangentBitmask::UnassignedTangent);
+
+        Data::Instance<ShaderResourceGroup> drawSrg1 = MeshDrawPacket::FindOrCreateSharedDrawSrg(*shader, shader->GetRootVariant(), shaderOptions, oneUvStream);
+        Data::Instance<ShaderResourceGroup> drawSrg2 = MeshDrawPacket::FindOrCreateSharedDrawSrg(*shader, shader->GetRootVariant(), shaderOptions, oneUvStream);
+        Data::Instance<ShaderResourceGroup> drawSrg3 = MeshDrawPacket::FindOrCreateSharedDrawSrg(*shader, shader->GetRootVariant(), shaderOptions, twoUvStreams);
+
+        ASSERT_TRUE(drawSrg1);
+        ASSERT_TRUE(drawSrg3);
+
+        // Draw items using the same shader variant and mesh streams share one DrawSrg
+
+        EXPECT_EQ(drawSrg1, drawSrg2);
+        EXPECT_NE(drawSrg1, drawSrg3);
+
+        // Each shared DrawSrg is initialized with the streams it was created for
+
+        const RHI::ShaderInputConstantIndex bitmaskIndex = drawSrg1->FindShaderInputConstantIndex(Name{ UvStreamTangentBitmask::SrgName });
+        EXPECT_EQ(oneUvStream.GetFullTangentBitmask(), drawSrg1->GetConstant<uint32_t>(bitmaskIndex));
+        EXPECT_EQ(twoUvStreams.GetFullTangentBitmask(), drawSrg3->GetConstant<uint32_t>(bitmaskIndex));
+
+        // A shader without a DrawSrg gets none
+
+        RHI::Ptr<RHI::ShaderResourceGroupLayout> objectSrgLayout = RHI::ShaderResourceGroupLayout::Create();
+        objectSrgLayout->SetName(Name("TestObjectSrg"));
+        objectSrgLayout->SetBindingSlot(SrgBindingSlot::Object);
+        objectSrgLayout->AddShaderInput(RHI::ShaderInputConstantDescriptor{ Name{ "MyFloatA" }, 0, 4, 0 });
+        objectSrgLayout->Finalize();
+        Data::Instance<Shader> shaderWithoutDrawSrg = Shader::FindOrCreate(CreateTestShaderAsset(Uuid::CreateRandom(), objectSrgLayout));
+        ASSERT_TRUE(shaderWithoutDrawSrg);
+        EXPECT_FALSE(MeshDrawPacket::FindOrCreateSharedDrawSrg(
+            *shaderWithoutDrawSrg, shaderWithoutDrawSrg->GetRootVariant(), shaderWithoutDrawSrg->CreateShaderOptionGroup(), oneUvStream));
+    }
+
     TEST_F(ShaderResourceGroupGeneralTests, TestResourcePool)
     {
         Data::Instance<ShaderResourceGroup> srgA_instance1 = ShaderResourceGroup::Create(m_testShaderAsset, AZ::RPI::DefaultSupervariantIndex, m_testSrgLayout->GetName());
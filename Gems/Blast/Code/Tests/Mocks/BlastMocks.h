@@ -325,6 +325,7 @@ namespace Blast
         MOCK_METHOD0(DetachedFromActor, void());
         MOCK_METHOD2(RayCast, AzPhysics::SceneQueryHit(const AzPhysics::RayCastRequest&, const AZ::Transform&));
         MOCK_METHOD1(RayCastLocal, AzPhysics::SceneQueryHit(const AzPhysics::RayCastRequest&));
+        MOCK_METHOD2(Overlap, bool(const AzPhysics::OverlapRequest&, const AZ::Transform&));
         MOCK_CONST_METHOD1(GetAabb, AZ::Aabb(const AZ::Transform&));
         MOCK_CONST_METHOD0(GetAabbLocal, AZ::Aabb());
         MOCK_METHOD3(GetGeometry, void(AZStd::vector<AZ::Vector3>&, AZStd::vector<AZ::u32>&, AZ::Aabb*));
@@ -169,6 +169,9 @@ namespace Physics
         void RegisterSceneActiveSimulatedBodiesHandler(
             [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
             [[maybe_unused]] AzPhysics::SceneEvents::OnSceneActiveSimulatedBodiesEvent::Handler& handler) override {}
+        void RegisterSceneTransformsUpdatedHandler(
+            [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
+            [[maybe_unused]] AzPhysics::SceneEvents::OnSceneTransformsUpdatedEvent::Handler& handler) override {}
         void RegisterSceneCollisionEventHandler(
             [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
             [[maybe_unused]] AzPhysics::SceneEvents::OnSceneCollisionsEvent::Handler& handler) override {}
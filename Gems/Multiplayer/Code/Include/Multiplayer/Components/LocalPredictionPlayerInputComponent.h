@@ -77,6 +77,9 @@ namespace Multiplayer
         // Implicitly sorted player input history, back() is the input that corresponds to the latest client input Id
         NetworkInputHistory m_inputHistory;
 
+        // Inputs being replayed after a correction, retained to avoid allocating on every correction
+        AZStd::vector<NetworkInput*> m_replayInputs;
+
         // Anti-cheat accumulator for clients who purposely mess with their clock rate
         NetworkInputArray m_lastInputReceived;
 
@@ -11,10 +11,13 @@
 #include <AzCore/Component/Component.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/FixedSizeBitsetView.h>
+#include <AzNetworking/Utilities/QuantizedEncodings.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkTime/RewindableHistoryStore.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
 
 //! Macro to declare bindings for a multiplayer component inheriting from MultiplayerComponent
 #define AZ_MULTIPLAYER_COMPONENT(ComponentClass, Guid, Base) \
@@ -126,7 +129,29 @@ namespace Multiplayer
         }
     }
 
-    template <typename TYPE>
+    template <typename ENCODING, typename TYPE>
+    inline void SerializeNetworkPropertyValue(AzNetworking::ISerializer& serializer, TYPE& value, const char* name)
+    {
+        ENCODING::Serialize(serializer, value, name);
+    }
+
+    template <typename ENCODING, typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void SerializeNetworkPropertyValue(AzNetworking::ISerializer& serializer, RewindableObject<BASE_TYPE, REWIND_SIZE>& value, const char* name)
+    {
+        value.template SerializeEncoded<ENCODING>(serializer, name);
+    }
+
+    template <typename ENCODING, typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void SerializeNetworkPropertyValue(AzNetworking::ISerializer& serializer, RewindableStoreObject<BASE_TYPE, REWIND_SIZE>& value, const char* name)
+    {
+        value.template SerializeEncoded<ENCODING>(serializer, name);
+    }
+
+    //! Serializes a single network property if its dirty bit is set.
+    //! ENCODING controls how the value is written, see AzNetworking/Utilities/QuantizedEncodings.h
+    //! Properties opt in through the Encoding attribute in their AutoComponent xml. A quantized encoding is lossy and changes
+    //! the wire format of the property whether or not the payload is bit packed.
+    template <typename ENCODING = AzNetworking::DefaultEncoding, typename TYPE>
     inline void SerializeNetworkPropertyHelper
     (
         AzNetworking::ISerializer& serializer,
@@ -144,7 +169,7 @@ namespace Multiplayer
             const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
             const uint32_t prevUpdateSize = serializer.GetSize();
             serializer.ClearTrackedChangesFlag();
-            serializer.Serialize(value, name);
+            SerializeNetworkPropertyValue<ENCODING>(serializer, value, name);
             if (modifyRecord && !serializer.GetTrackedChangesFlag())
             {
                 // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
@@ -62,6 +62,11 @@ namespace Multiplayer
         //! @return the name of the requested rpc
         const char* GetComponentRpcName(NetComponentId netComponentId, RpcIndex rpcIndex) const;
 
+        //! Returns the NetComponentId registered for the provided component name.
+        //! @param  componentName the name of the component to look up
+        //! @return the NetComponentId of the component, InvalidNetComponentId if no component with that name is registered
+        NetComponentId FindNetComponentId(const AZ::Name& componentName) const;
+
         //! Retrieves the stored component data for a given NetComponentId.
         //! @param  netComponentId the NetComponentId to return component data for
         //! @return reference to the requested component data, an empty container will be returned if the NetComponentId does not exist
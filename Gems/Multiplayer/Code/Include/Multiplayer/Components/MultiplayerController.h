@@ -84,6 +84,11 @@ namespace Multiplayer
         //! Returns the input priority ordering for determining the order of ProcessInput or CreateInput functions.
         virtual InputPriorityOrder GetInputOrder() const = 0;
 
+        //! Returns true if this controller must be run again when replaying inputs after a correction.
+        //! Generated controllers return true unless their AutoComponent xml sets IsPredicted="false", which is only safe for
+        //! controllers whose ProcessInput doesn't read inputs or write predictable state, including those of other components.
+        virtual bool IsPredicted() const = 0;
+
         //! Base execution for ProcessInput packet, do not call directly.
         //! @param networkInput input structure to process
         //! @param deltaTime    amount of time to integrate the provided inputs over
@@ -102,6 +102,13 @@ namespace Multiplayer
         void ProcessInput(NetworkInput& networkInput, float deltaTime);
         void ReprocessInput(NetworkInput& networkInput, float deltaTime);
 
+        //! Replays a batch of inputs after a correction, oldest first.
+        //! Each input is processed at its own host frame, and only controllers that report IsPredicted() are run.
+        //! @param networkInputs      the inputs to replay, oldest first
+        //! @param deltaTime          amount of time to integrate each input over
+        //! @param rewindConnectionId the connection to alter network time for while replaying
+        void ReprocessInputs(const AZStd::vector<NetworkInput*>& networkInputs, float deltaTime, AzNetworking::ConnectionId rewindConnectionId);
+
         bool HandleRpcMessage(AzNetworking::IConnection* invokingConnection, NetEntityRole remoteRole, NetworkEntityRpcMessage& message);
         bool HandlePropertyChangeMessage(AzNetworking::ISerializer& serializer, bool notifyChanges = true);
 
@@ -165,6 +172,7 @@ namespace Multiplayer
         AZStd::unordered_map<NetComponentId, MultiplayerComponent*> m_multiplayerComponentMap;
         AZStd::vector<MultiplayerComponent*> m_multiplayerSerializationComponentVector;
         AZStd::vector<MultiplayerComponent*> m_multiplayerInputComponentVector;
+        AZStd::vector<MultiplayerComponent*> m_multiplayerPredictedComponentVector; // Subset of m_multiplayerInputComponentVector run when replaying inputs
 
         RpcSendEvent m_sendAuthorityToClientRpcEvent;
         RpcSendEvent m_sendAuthorityToAutonomousRpcEvent;
@@ -19,6 +19,7 @@ namespace Multiplayer
 {
     constexpr AZStd::string_view MpNetworkInterfaceName("MultiplayerNetworkInterface");
     constexpr AZStd::string_view MpEditorInterfaceName("MultiplayerEditorNetworkInterface");
+    constexpr AZStd::string_view MpLoadTestInterfaceName("MultiplayerLoadTestNetworkInterface");
     constexpr AZStd::string_view LocalHost("127.0.0.1");
 
     constexpr uint16_t DefaultServerPort = 33450;
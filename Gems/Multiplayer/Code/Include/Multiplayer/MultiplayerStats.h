@@ -11,6 +11,7 @@
 #include <AzCore/Time/ITime.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace AzNetworking
@@ -49,6 +50,32 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Per-entity replication send rates, entries are discarded once they have not been sent for a full history window
+        struct EntityStats
+        {
+            Metric m_updatesSent;
+            uint64_t m_updatesDeferred = 0;
+            uint64_t m_lastRecordedTick = 0;
+        };
+        AZStd::unordered_map<NetEntityId, EntityStats> m_entityStats;
+        uint64_t m_tickCount = 0;
+
+        //! Wall clock cost of each server network tick in microseconds, only recorded while hosting
+        uint64_t m_serverTickSamples = 0;
+        uint64_t m_totalServerTickTimeUs = 0;
+        uint64_t m_maxServerTickTimeUs = 0;
+        MetricRingbuffer m_serverTickTimeUsHistory = {};
+
+        //! Replication received by simulated clients while a load test is running, see MultiplayerLoadTestDriver
+        struct LoadTestStats
+        {
+            uint64_t m_connectionCount = 0;
+            Metric m_updatesRecv;
+            uint64_t m_totalLatencyMs = 0;
+            uint64_t m_maxLatencyMs = 0;
+        };
+        LoadTestStats m_loadTestStats;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordEntitySerializeStart(AzNetworking::SerializerMode mode, AZ::EntityId entityId, const char* entityName);
         void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
@@ -57,6 +84,10 @@ namespace Multiplayer
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordRpcSent(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(AZ::EntityId entityId, const char* entityName, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
+        void RecordEntityUpdateSent(NetEntityId netEntityId, uint32_t totalBytes);
+        void RecordEntityUpdateDeferred(NetEntityId netEntityId);
+        void RecordServerTickTime(uint64_t tickTimeUs);
+        void RecordLoadTestUpdateReceived(uint32_t totalBytes, AZ::TimeMs latencyMs);
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
@@ -67,6 +98,8 @@ namespace Multiplayer
         Metric CalculateTotalPropertyUpdateRecvMetrics() const;
         Metric CalculateTotalRpcsSentMetrics() const;
         Metric CalculateTotalRpcsRecvMetrics() const;
+        Metric CalculateEntityUpdateSentMetrics(NetEntityId netEntityId) const;
+        uint64_t CalculateAverageServerTickTimeUs() const;
 
         struct Events
         {
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace Multiplayer
+{
+    AZ_TYPE_SAFE_INTEGRAL(RewindableSlotId, uint32_t);
+    static constexpr RewindableSlotId InvalidRewindableSlotId = static_cast<RewindableSlotId>(-1);
+
+    //! @class RewindableHistoryStore
+    //! @brief Centralized history storage for every rewindable value of one type.
+    //!
+    //! Where each RewindableObject keeps its own history ring, the store keeps a single ring of frames shared by all of its values.
+    //! Slots are grouped into fixed size chunks, each chunk holding one contiguous row of slot values per frame, so advancing or
+    //! rewinding every value is a bulk copy per chunk rather than a walk over thousands of component instances.
+    //!
+    //! Chunks are never moved once allocated, so allocating or freeing a slot does not invalidate the storage of other slots.
+    //! Slots may be allocated and freed from any thread, values are read and written from the game thread.
+    //! Each slot tracks the frame of its own latest write, so like RewindableObject a write is only dropped if it is older than
+    //! the latest write to the same slot, regardless of how far other slots have advanced the store.
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    class RewindableHistoryStore
+    {
+    public:
+        static_assert(REWIND_SIZE > 1, "A rewindable history store must hold at least two frames");
+
+        static constexpr uint32_t SlotsPerChunk = 64;
+        static constexpr uint32_t MaxChunkCount = 4096;
+
+        RewindableHistoryStore() = default;
+        RewindableHistoryStore(const RewindableHistoryStore&) = delete;
+        RewindableHistoryStore& operator = (const RewindableHistoryStore&) = delete;
+
+        //! Allocates a slot for a new value, every recorded frame of the slot is set to the provided value.
+        //! @param value     the initial value of the slot
+        //! @param frameTime the frame the value is created at, later writes older than this frame are ignored
+        //! @return the allocated slot, or InvalidRewindableSlotId if the store is full
+        RewindableSlotId AllocateSlot(const BASE_TYPE& value, HostFrameId frameTime);
+
+        //! Returns a slot to the store for reuse by a later allocation, the store releases its memory once every slot is free.
+        //! @param slot the slot to free
+        void FreeSlot(RewindableSlotId slot);
+
+        //! Returns the number of values in each frame, including freed slots.
+        //! @return the number of values in each frame
+        uint32_t GetSlotCount() const;
+
+        //! Returns the most recent frame recorded by the store.
+        //! @return the most recent frame recorded by the store
+        HostFrameId GetHeadTime() const;
+
+        //! Returns the value of a slot at the provided frame.
+        //! @param slot      the slot to look up
+        //! @param frameTime the frame to return the value for
+        //! @return the value of the slot at the provided frame, or at the head frame if frameTime is newer than the head
+        BASE_TYPE GetValueForTime(RewindableSlotId slot, HostFrameId frameTime) const;
+
+        //! Sets the value of a slot at the provided frame, advancing the store if frameTime is newer than the head.
+        //! Attempts to set values older than the latest write to the slot are ignored.
+        //! @param slot      the slot to set
+        //! @param value     the new value of the slot
+        //! @param frameTime the frame to set the value for
+        void SetValueForTime(RewindableSlotId slot, const BASE_TYPE& value, HostFrameId frameTime);
+
+        //! Returns a modifiable value of a slot at the provided frame, advancing the store if frameTime is newer than the head.
+        //! The reference stays valid until the next call that writes to the store.
+        //! @param slot      the slot to modify
+        //! @param frameTime the frame to modify the value at, must not be older than the latest write to the slot
+        //! @return the modifiable value of the slot
+        BASE_TYPE& ModifyValueForTime(RewindableSlotId slot, HostFrameId frameTime);
+
+        //! Advances the head of the store, carrying the values of all slots forward to every frame up to frameTime.
+        //! @param frameTime the new head frame
+        void AdvanceToTime(HostFrameId frameTime);
+
+        //! Moves the head of the store back to a recorded frame, restoring the values of all slots at that frame.
+        //! Frames newer than frameTime are discarded and recorded again as the store advances.
+        //! @param frameTime the recorded frame to roll back to
+        void RollbackToTime(HostFrameId frameTime);
+
+        //! Copies the values of all slots at the provided frame, indexed by slot.
+        //! @param frameTime the frame to return the values for, the head frame is used if frameTime is newer than the head
+        //! @param outValues receives GetSlotCount() values
+        void GetFrameValues(HostFrameId frameTime, AZStd::vector<BASE_TYPE>& outValues) const;
+
+    private:
+
+        struct SlotChunk
+        {
+            AZStd::array<AZStd::array<BASE_TYPE, SlotsPerChunk>, REWIND_SIZE> m_frames; //!< One row of slot values per recorded frame.
+            AZStd::array<HostFrameId, SlotsPerChunk> m_writeTimes; //!< The frame of the latest write to each slot.
+            AZStd::array<bool, SlotsPerChunk> m_pendingCarry; //!< Set while a write in the past has not been carried to the head.
+        };
+
+        BASE_TYPE& GetSlotValue(RewindableSlotId slot, AZStd::size_t frameIndex) const;
+        void AdvanceToTimeInternal(HostFrameId frameTime);
+        void SetSlotFrames(RewindableSlotId slot, const BASE_TYPE& value, HostFrameId firstFrame);
+        void CarrySlotToHead(RewindableSlotId slot);
+        void CarryPendingSlots();
+
+        //! Returns the index in SlotChunk::m_frames of the row holding the provided frame.
+        AZStd::size_t GetFrameIndex(HostFrameId frameTime) const;
+
+        //! Helper method to compute clamped array index values accounting for the offset head index.
+        AZStd::size_t GetOffsetIndex(AZStd::size_t absoluteIndex) const;
+
+        mutable AZStd::mutex m_mutex; //!< Guards slot allocation and every write to the store.
+        AZStd::array<AZStd::unique_ptr<SlotChunk>, MaxChunkCount> m_chunks;
+        AZStd::vector<RewindableSlotId> m_freeSlots;
+        AZStd::vector<RewindableSlotId> m_pendingCarrySlots;
+        uint32_t m_slotCount = 0;
+        HostFrameId m_headTime = HostFrameId{0};
+        uint32_t m_headIndex = 0;
+    };
+
+    //! Returns the history store shared by every network property of the given type that uses centralized history storage.
+    //! Generated components use it for rewindable properties declared with UseHistoryStore="true".
+    //! @return the shared history store for BASE_TYPE values
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>& GetRewindableHistoryStore();
+
+    //! @class RewindableStoreObject
+    //! @brief A rewindable value whose history is kept in a shared RewindableHistoryStore.
+    //!
+    //! Provides the interface of RewindableObject, so a network property can opt into centralized history storage by changing
+    //! its type and binding it to a store that outlives it. Values are returned by copy as the store may be written concurrently.
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    class RewindableStoreObject
+    {
+    public:
+        using StoreType = RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>;
+
+        //! Constructor.
+        //! @param store the store to keep the value history in
+        //! @param value base type value to construct from
+        RewindableStoreObject(StoreType& store, const BASE_TYPE& value);
+
+        //! Constructor.
+        //! @param store              the store to keep the value history in
+        //! @param value              base type value to construct from
+        //! @param owningConnectionId the entity id of the owning object
+        RewindableStoreObject(StoreType& store, const BASE_TYPE& value, AzNetworking::ConnectionId owningConnectionId);
+
+        //! Copy construct from another rewindable store object, allocating a new slot in the same store.
+        //! @param rhs rewindable store object to construct from
+        RewindableStoreObject(const RewindableStoreObject& rhs);
+
+        ~RewindableStoreObject();
+
+        //! Assignment from underlying base type.
+        //! @param rhs base type value to assign from
+        RewindableStoreObject& operator = (const BASE_TYPE& rhs);
+
+        //! Assignment from another rewindable store object.
+        //! @param rhs rewindable store object to assign from
+        RewindableStoreObject& operator = (const RewindableStoreObject& rhs);
+
+        //! Sets the owning connectionId for the given rewindable object instance.
+        //! @param owningConnectionId the new connectionId to use as the owning connectionId.
+        void SetOwningConnectionId(AzNetworking::ConnectionId owningConnectionId);
+
+        //! Base type operator.
+        //! @return a copy of the current value
+        operator BASE_TYPE() const;
+
+        //! Base type retriever.
+        //! @return a copy of the current value
+        BASE_TYPE Get() const;
+
+        //! Base type retriever for one host frame behind Get(). Only intended for use in SyncRewind contexts.
+        //! @return a copy of the previous value
+        BASE_TYPE GetPrevious() const;
+
+        //! Base type retriever.
+        //! @return value in base type form
+        BASE_TYPE& Modify();
+
+        //! Equality operator.
+        //! @param rhs base type value to compare against
+        //! @return boolean true if this == rhs
+        bool operator == (const BASE_TYPE& rhs) const;
+
+        //! Inequality operator.
+        //! @param rhs base type value to compare against
+        //! @return boolean true if this != rhs
+        bool operator != (const BASE_TYPE& rhs) const;
+
+        //! Base serialize method for all serializable structures or classes to implement
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(AzNetworking::ISerializer& serializer);
+
+        //! Serializes the current value using the provided encoding, see AzNetworking/Utilities/QuantizedEncodings.h.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @param name       the name of the property being serialized
+        //! @return boolean true for success, false for serialization failure
+        template <typename ENCODING>
+        bool SerializeEncoded(AzNetworking::ISerializer& serializer, const char* name);
+
+    private:
+
+        //! Returns what the appropriate current time is for this rewindable property.
+        //! @return the appropriate current time is for this rewindable property
+        HostFrameId GetCurrentTimeForProperty() const;
+
+        StoreType& m_store;
+        AzNetworking::ConnectionId m_owningConnectionId = AzNetworking::InvalidConnectionId;
+        RewindableSlotId m_slot = InvalidRewindableSlotId;
+    };
+}
+
+AZ_TYPE_SAFE_INTEGRAL_SERIALIZEBINDING(Multiplayer::RewindableSlotId);
+
+namespace AZ
+{
+    AZ_TYPE_INFO_TEMPLATE(Multiplayer::RewindableStoreObject, "{76141B05-6626-4FF5-93DA-05A689709D2D}", AZ_TYPE_INFO_TYPENAME, AZ_TYPE_INFO_AUTO);
+}
+
+#include <Multiplayer/NetworkTime/RewindableHistoryStore.inl>
@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace Multiplayer
+{
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableSlotId RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::AllocateSlot(const BASE_TYPE& value, HostFrameId frameTime)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        RewindableSlotId slot = InvalidRewindableSlotId;
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            if (m_slotCount >= SlotsPerChunk * MaxChunkCount)
+            {
+                AZ_Assert(false, "Rewindable history store is full, increase MaxChunkCount");
+                return InvalidRewindableSlotId;
+            }
+
+            slot = static_cast<RewindableSlotId>(m_slotCount++);
+            AZStd::unique_ptr<SlotChunk>& chunk = m_chunks[static_cast<uint32_t>(slot) / SlotsPerChunk];
+            if (chunk == nullptr)
+            {
+                chunk = AZStd::make_unique<SlotChunk>();
+            }
+        }
+
+        SlotChunk& chunk = *m_chunks[static_cast<uint32_t>(slot) / SlotsPerChunk];
+        const uint32_t offset = static_cast<uint32_t>(slot) % SlotsPerChunk;
+        for (AZStd::array<BASE_TYPE, SlotsPerChunk>& frame : chunk.m_frames)
+        {
+            frame[offset] = value;
+        }
+        chunk.m_writeTimes[offset] = frameTime;
+        chunk.m_pendingCarry[offset] = false;
+        return slot;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::FreeSlot(RewindableSlotId slot)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        AZ_Assert(static_cast<uint32_t>(slot) < m_slotCount, "Freeing a slot that was not allocated by this store");
+
+        SlotChunk& chunk = *m_chunks[static_cast<uint32_t>(slot) / SlotsPerChunk];
+        const uint32_t offset = static_cast<uint32_t>(slot) % SlotsPerChunk;
+        if (chunk.m_pendingCarry[offset])
+        {
+            chunk.m_pendingCarry[offset] = false;
+            m_pendingCarrySlots.erase(AZStd::find(m_pendingCarrySlots.begin(), m_pendingCarrySlots.end(), slot));
+        }
+        m_freeSlots.push_back(slot);
+
+        if (m_freeSlots.size() == m_slotCount)
+        {
+            // Shared stores outlive the allocators of the systems using them, so give the memory back with the last slot
+            for (AZStd::unique_ptr<SlotChunk>& freeChunk : m_chunks)
+            {
+                freeChunk.reset();
+            }
+            m_slotCount = 0;
+            m_freeSlots.set_capacity(0);
+            m_pendingCarrySlots.set_capacity(0);
+        }
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline uint32_t RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::GetSlotCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_slotCount;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline HostFrameId RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::GetHeadTime() const
+    {
+        return m_headTime;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline BASE_TYPE RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::GetValueForTime(RewindableSlotId slot, HostFrameId frameTime) const
+    {
+        const SlotChunk& chunk = *m_chunks[static_cast<uint32_t>(slot) / SlotsPerChunk];
+        const uint32_t offset = static_cast<uint32_t>(slot) % SlotsPerChunk;
+        if (chunk.m_pendingCarry[offset] && (frameTime > chunk.m_writeTimes[offset]))
+        {
+            // Frames after a write in the past still hold the old value until the write is carried to the head
+            frameTime = chunk.m_writeTimes[offset];
+        }
+        return chunk.m_frames[GetFrameIndex(frameTime)][offset];
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::SetValueForTime(RewindableSlotId slot, const BASE_TYPE& value, HostFrameId frameTime)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        SlotChunk& chunk = *m_chunks[static_cast<uint32_t>(slot) / SlotsPerChunk];
+        const uint32_t offset = static_cast<uint32_t>(slot) % SlotsPerChunk;
+        if (frameTime < chunk.m_writeTimes[offset])
+        {
+            // Don't try and set values older than the slot's current head value
+            return;
+        }
+        CarrySlotToHead(slot);
+        chunk.m_writeTimes[offset] = frameTime;
+
+        if (frameTime <= m_headTime)
+        {
+            // Other slots have already advanced the store, the value holds for every frame from frameTime up to the head
+            SetSlotFrames(slot, value, frameTime);
+            return;
+        }
+
+        if (static_cast<AZStd::size_t>(frameTime - m_headTime) >= REWIND_SIZE)
+        {
+            // Matches RewindableObject, a large enough time delta flushes the slot's whole history with the new value
+            AdvanceToTimeInternal(frameTime);
+            SetSlotFrames(slot, value, frameTime - HostFrameId(static_cast<uint32_t>(REWIND_SIZE - 1)));
+            return;
+        }
+
+        AdvanceToTimeInternal(frameTime);
+        chunk.m_frames[m_headIndex][offset] = value;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline BASE_TYPE& RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::ModifyValueForTime(RewindableSlotId slot, HostFrameId frameTime)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+        SlotChunk& chunk = *m_chunks[static_cast<uint32_t>(slot) / SlotsPerChunk];
+        const uint32_t offset = static_cast<uint32_t>(slot) % SlotsPerChunk;
+        if (frameTime < chunk.m_writeTimes[offset])
+        {
+            AZ_Assert(false, "Trying to mutate a rewindable value in the past");
+            return chunk.m_frames[GetFrameIndex(frameTime)][offset];
+        }
+        CarrySlotToHead(slot);
+        chunk.m_writeTimes[offset] = frameTime;
+
+        if (frameTime < m_headTime)
+        {
+            // The caller writes through the returned reference, so the value is carried to the head by the next write to the store
+            chunk.m_pendingCarry[offset] = true;
+            m_pendingCarrySlots.push_back(slot);
+        }
+        else
+        {
+            AdvanceToTimeInternal(frameTime);
+        }
+        return chunk.m_frames[GetFrameIndex(frameTime)][offset];
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::AdvanceToTime(HostFrameId frameTime)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        AdvanceToTimeInternal(frameTime);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::RollbackToTime(HostFrameId frameTime)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (frameTime >= m_headTime)
+        {
+            return;
+        }
+        CarryPendingSlots();
+
+        // The recorded frame becomes the head, frames after it are overwritten as the store advances again
+        m_headIndex = static_cast<uint32_t>(GetFrameIndex(frameTime));
+        const AZStd::size_t frameDelta = static_cast<AZStd::size_t>(m_headTime) - static_cast<AZStd::size_t>(frameTime);
+        m_headTime = (frameDelta < REWIND_SIZE) ? frameTime : m_headTime - HostFrameId(static_cast<uint32_t>(REWIND_SIZE - 1));
+
+        // Writes to the discarded frames are forgotten, so they must not block writes to the restored frames
+        for (uint32_t slotIndex = 0; slotIndex < m_slotCount; ++slotIndex)
+        {
+            HostFrameId& writeTime = m_chunks[slotIndex / SlotsPerChunk]->m_writeTimes[slotIndex % SlotsPerChunk];
+            writeTime = AZStd::min(writeTime, m_headTime);
+        }
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::GetFrameValues(HostFrameId frameTime, AZStd::vector<BASE_TYPE>& outValues) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        outValues.resize(m_slotCount);
+        for (uint32_t slotIndex = 0; slotIndex < m_slotCount; ++slotIndex)
+        {
+            outValues[slotIndex] = GetValueForTime(static_cast<RewindableSlotId>(slotIndex), frameTime);
+        }
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::AdvanceToTimeInternal(HostFrameId frameTime)
+    {
+        if (frameTime <= m_headTime)
+        {
+            return;
+        }
+        CarryPendingSlots();
+
+        const uint32_t chunkCount = (m_slotCount + SlotsPerChunk - 1) / SlotsPerChunk;
+        if (static_cast<AZStd::size_t>(frameTime - m_headTime) >= REWIND_SIZE)
+        {
+            // This update represents a large enough time delta that we'll just flush every frame with the current head values
+            for (uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+            {
+                SlotChunk& chunk = *m_chunks[chunkIndex];
+                for (uint32_t i = 0; i < REWIND_SIZE; ++i)
+                {
+                    if (i != m_headIndex)
+                    {
+                        chunk.m_frames[i] = chunk.m_frames[m_headIndex];
+                    }
+                }
+            }
+            m_headTime = frameTime;
+            return;
+        }
+
+        const uint32_t frameDelta = static_cast<uint32_t>(frameTime - m_headTime);
+        for (uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+        {
+            SlotChunk& chunk = *m_chunks[chunkIndex];
+            uint32_t frameIndex = m_headIndex;
+            for (uint32_t i = 0; i < frameDelta; ++i)
+            {
+                const uint32_t nextFrameIndex = (frameIndex + 1) % REWIND_SIZE;
+                chunk.m_frames[nextFrameIndex] = chunk.m_frames[frameIndex];
+                frameIndex = nextFrameIndex;
+            }
+        }
+        m_headIndex = static_cast<uint32_t>((m_headIndex + frameDelta) % REWIND_SIZE);
+        m_headTime = frameTime;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::SetSlotFrames(RewindableSlotId slot, const BASE_TYPE& value, HostFrameId firstFrame)
+    {
+        SlotChunk& chunk = *m_chunks[static_cast<uint32_t>(slot) / SlotsPerChunk];
+        const uint32_t offset = static_cast<uint32_t>(slot) % SlotsPerChunk;
+        const AZStd::size_t frameCount = (firstFrame < m_headTime)
+            ? AZStd::min<AZStd::size_t>(static_cast<AZStd::size_t>(m_headTime - firstFrame) + 1, REWIND_SIZE)
+            : 1;
+        for (AZStd::size_t i = 0; i < frameCount; ++i)
+        {
+            chunk.m_frames[GetOffsetIndex(i)][offset] = value;
+        }
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::CarrySlotToHead(RewindableSlotId slot)
+    {
+        SlotChunk& chunk = *m_chunks[static_cast<uint32_t>(slot) / SlotsPerChunk];
+        const uint32_t offset = static_cast<uint32_t>(slot) % SlotsPerChunk;
+        if (!chunk.m_pendingCarry[offset])
+        {
+            return;
+        }
+        const HostFrameId writeTime = chunk.m_writeTimes[offset];
+        SetSlotFrames(slot, chunk.m_frames[GetFrameIndex(writeTime)][offset], writeTime);
+        chunk.m_pendingCarry[offset] = false;
+        if (m_pendingCarrySlots.back() == slot)
+        {
+            m_pendingCarrySlots.pop_back();
+        }
+        else
+        {
+            m_pendingCarrySlots.erase(AZStd::find(m_pendingCarrySlots.begin(), m_pendingCarrySlots.end(), slot));
+        }
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::CarryPendingSlots()
+    {
+        while (!m_pendingCarrySlots.empty())
+        {
+            CarrySlotToHead(m_pendingCarrySlots.back());
+        }
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline AZStd::size_t RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::GetFrameIndex(HostFrameId frameTime) const
+    {
+        if (frameTime > m_headTime)
+        {
+            return m_headIndex;
+        }
+        const AZStd::size_t frameDelta = static_cast<AZStd::size_t>(m_headTime) - static_cast<AZStd::size_t>(frameTime);
+        return GetOffsetIndex(frameDelta);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline AZStd::size_t RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>::GetOffsetIndex(AZStd::size_t absoluteIndex) const
+    {
+        if (absoluteIndex >= REWIND_SIZE)
+        {
+            AZLOG(NET_Rewind, "Request for value which is too old");
+            absoluteIndex = REWIND_SIZE - 1;
+        }
+        return ((m_headIndex + REWIND_SIZE) - absoluteIndex) % REWIND_SIZE;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::RewindableStoreObject(StoreType& store, const BASE_TYPE& value)
+        : m_store(store)
+        , m_slot(store.AllocateSlot(value, GetCurrentTimeForProperty()))
+    {
+        ;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::RewindableStoreObject(StoreType& store, const BASE_TYPE& value, AzNetworking::ConnectionId owningConnectionId)
+        : m_store(store)
+        , m_owningConnectionId(owningConnectionId)
+        , m_slot(store.AllocateSlot(value, GetCurrentTimeForProperty()))
+    {
+        ;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::RewindableStoreObject(const RewindableStoreObject<BASE_TYPE, REWIND_SIZE>& rhs)
+        : m_store(rhs.m_store)
+        , m_owningConnectionId(rhs.m_owningConnectionId)
+        , m_slot(rhs.m_store.AllocateSlot(rhs.Get(), GetCurrentTimeForProperty()))
+    {
+        ;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::~RewindableStoreObject()
+    {
+        m_store.FreeSlot(m_slot);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableStoreObject<BASE_TYPE, REWIND_SIZE>& RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::operator =(const BASE_TYPE& rhs)
+    {
+        m_store.SetValueForTime(m_slot, rhs, GetCurrentTimeForProperty());
+        return *this;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableStoreObject<BASE_TYPE, REWIND_SIZE>& RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::operator =(const RewindableStoreObject<BASE_TYPE, REWIND_SIZE>& rhs)
+    {
+        INetworkTime* networkTime = Multiplayer::GetNetworkTime();
+        const BASE_TYPE value = rhs.m_store.GetValueForTime(rhs.m_slot, networkTime->GetHostFrameId());
+        m_store.SetValueForTime(m_slot, value, GetCurrentTimeForProperty());
+        return *this;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline void RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::SetOwningConnectionId(AzNetworking::ConnectionId owningConnectionId)
+    {
+        m_owningConnectionId = owningConnectionId;
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::operator BASE_TYPE() const
+    {
+        return Get();
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline BASE_TYPE RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::Get() const
+    {
+        return m_store.GetValueForTime(m_slot, GetCurrentTimeForProperty());
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline BASE_TYPE RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::GetPrevious() const
+    {
+        return m_store.GetValueForTime(m_slot, GetCurrentTimeForProperty() - HostFrameId(1));
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline BASE_TYPE& RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::Modify()
+    {
+        return m_store.ModifyValueForTime(m_slot, GetCurrentTimeForProperty());
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline bool RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::operator == (const BASE_TYPE& rhs) const
+    {
+        return (Get() == rhs);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline bool RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::operator != (const BASE_TYPE& rhs) const
+    {
+        return (Get() != rhs);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline bool RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::Serialize(AzNetworking::ISerializer& serializer)
+    {
+        const HostFrameId frameTime = GetCurrentTimeForProperty();
+        BASE_TYPE value = m_store.GetValueForTime(m_slot, frameTime);
+        if (serializer.Serialize(value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        {
+            m_store.SetValueForTime(m_slot, value, frameTime);
+        }
+        return serializer.IsValid();
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    template <typename ENCODING>
+    inline bool RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::SerializeEncoded(AzNetworking::ISerializer& serializer, const char* name)
+    {
+        // Matches the layout produced by RewindableObject::SerializeEncoded, so either storage can be used for a property
+        if (serializer.BeginObject(name, "Type name unknown"))
+        {
+            const HostFrameId frameTime = GetCurrentTimeForProperty();
+            BASE_TYPE value = m_store.GetValueForTime(m_slot, frameTime);
+            if (ENCODING::Serialize(serializer, value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+            {
+                m_store.SetValueForTime(m_slot, value, frameTime);
+            }
+            serializer.EndObject(name, "Type name unknown");
+        }
+        return serializer.IsValid();
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline HostFrameId RewindableStoreObject<BASE_TYPE, REWIND_SIZE>::GetCurrentTimeForProperty() const
+    {
+        INetworkTime* networkTime = Multiplayer::GetNetworkTime();
+        return networkTime->GetHostFrameIdForRewindingConnection(m_owningConnectionId);
+    }
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    inline RewindableHistoryStore<BASE_TYPE, REWIND_SIZE>& GetRewindableHistoryStore()
+    {
+        static RewindableHistoryStore<BASE_TYPE, REWIND_SIZE> s_store;
+        return s_store;
+    }
+}
@@ -83,6 +83,13 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serializes the current value using the provided encoding, see AzNetworking/Utilities/QuantizedEncodings.h.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @param name       the name of the property being serialized
+        //! @return boolean true for success, false for serialization failure
+        template <typename ENCODING>
+        bool SerializeEncoded(AzNetworking::ISerializer& serializer, const char* name);
+
     private:
 
         //! Returns what the appropriate current time is for this rewindable property.
@@ -114,6 +114,24 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    template <typename ENCODING>
+    inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::SerializeEncoded(AzNetworking::ISerializer& serializer, const char* name)
+    {
+        // Matches the layout produced by serializer.Serialize(rewindableObject, name)
+        if (serializer.BeginObject(name, "Type name unknown"))
+        {
+            const HostFrameId frameTime = GetCurrentTimeForProperty();
+            BASE_TYPE value = GetValueForTime(frameTime);
+            if (ENCODING::Serialize(serializer, value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+            {
+                SetValueForTime(value, frameTime);
+            }
+            serializer.EndObject(name, "Type name unknown");
+        }
+        return serializer.IsValid();
+    }
+
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline HostFrameId RewindableObject<BASE_TYPE, REWIND_SIZE>::GetCurrentTimeForProperty() const
     {
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! @class IPhysicsHistory
+    //! @brief This is an AZ::Interface<> providing the recorded poses of networked rigid bodies for lag compensated scene queries.
+    //!
+    //! On the server, the world space pose of every rigid body owned by a networked entity is recorded once per host frame into
+    //! a fixed size ring of frames. Rewind aware scene queries use these poses to test against the state a client saw, without
+    //! moving any bodies in the live physics scene.
+    class IPhysicsHistory
+    {
+    public:
+        AZ_RTTI(IPhysicsHistory, "{3E1A3F6B-6E2B-4C7C-9D0B-52A0B4E0C8D4}");
+
+        //! The recorded state of a single rigid body.
+        struct BodyPose
+        {
+            AzPhysics::SimulatedBodyHandle m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+            AZ::Transform m_transform = AZ::Transform::CreateIdentity();
+            AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+        };
+        using BodyPoses = AZStd::vector<BodyPose>;
+
+        IPhysicsHistory() = default;
+        virtual ~IPhysicsHistory() = default;
+
+        //! Records the current pose of all tracked rigid bodies for the provided frame, replacing the oldest recorded frame.
+        //! @param frameId the host frame the current poses belong to
+        virtual void RecordFrame(HostFrameId frameId) = 0;
+
+        //! Returns the poses recorded for the provided frame.
+        //! @param frameId the host frame to look up
+        //! @return pointer to the recorded poses, nullptr if the frame was never recorded or has already been overwritten
+        virtual const BodyPoses* GetFramePoses(HostFrameId frameId) const = 0;
+
+        //! Returns true if the provided body is tracked, meaning scene queries against a recorded frame should use its recorded pose.
+        //! @param bodyHandle the simulated body to check
+        //! @return boolean true if the body has its pose recorded each frame
+        virtual bool IsTrackedBody(AzPhysics::SimulatedBodyHandle bodyHandle) const = 0;
+
+        //! Discards all recorded frames.
+        virtual void ClearHistory() = 0;
+
+        AZ_DISABLE_COPY_MOVE(IPhysicsHistory);
+    };
+}
@@ -15,6 +15,7 @@ namespace Multiplayer
     namespace Physics
     {
         //! Performs rewind-aware ray cast in the default physics world.
+        //! When time is rewound to a frame recorded by IPhysicsHistory, networked rigid bodies are tested at their recorded poses.
         //! @param request The ray cast request to make.
         //! @return Returns a structure that contains a list of Hits.
         AzPhysics::SceneQueryHits RayCast(const AzPhysics::RayCastRequest& request);
@@ -25,6 +26,8 @@ namespace Multiplayer
         AzPhysics::SceneQueryHits ShapeCast(const AzPhysics::ShapeCastRequest& request);
 
         //! Performs rewind-aware overlap in the default physics world.
+        //! When time is rewound to a frame recorded by IPhysicsHistory, networked rigid bodies are tested against their shapes at
+        //! the recorded poses. Overlaps with an unbounded hit callback instead query the live bodies present at the rewound frame.
         //! @param request The overlap request to make.
         //! @return Returns a structure that contains a list of Hits.
         AzPhysics::SceneQueryHits Overlap(const AzPhysics::OverlapRequest& request);
@@ -344,15 +344,20 @@ namespace Multiplayer
         // If this correction is for a move outside our input history window, just start replaying from the oldest move we have available
         const uint32_t startReplayIndex = (inputHistorySize > historicalDelta) ? (inputHistorySize - historicalDelta) : 0;
 
-        const double clientInputRateSec = ConvertTimeMsToSeconds(cl_InputRateMs);
+        // Replay the inputs in a single batch, the buffer of input pointers is retained between corrections
+        m_replayInputs.clear();
         for (uint32_t replayIndex = startReplayIndex; replayIndex < inputHistorySize; ++replayIndex)
         {
-            // Reprocess the input for this frame
-            NetworkInput& input = m_inputHistory[replayIndex];
-            ScopedAlterTime scopedTime(input.GetHostFrameId(), input.GetHostTimeMs(), input.GetHostBlendFactor(), invokingConnection->GetConnectionId());
-            GetNetBindComponent()->ReprocessInput(input, static_cast<float>(clientInputRateSec));
+            m_replayInputs.push_back(&m_inputHistory[replayIndex]);
+        }
 
-            AZLOG(NET_Prediction, "Replayed InputId=%d", aznumeric_cast<int32_t>(input.GetClientInputId()));
+        if (!m_replayInputs.empty())
+        {
+            const double clientInputRateSec = ConvertTimeMsToSeconds(cl_InputRateMs);
+            GetNetBindComponent()->ReprocessInputs(m_replayInputs, static_cast<float>(clientInputRateSec), invokingConnection->GetConnectionId());
+
+            AZLOG(NET_Prediction, "Replayed InputIds=%d-%d", aznumeric_cast<int32_t>(m_replayInputs.front()->GetClientInputId()),
+                aznumeric_cast<int32_t>(m_replayInputs.back()->GetClientInputId()));
         }
     }
 
@@ -427,6 +432,10 @@ namespace Multiplayer
 
         const uint32_t maxClientInputs = clientInputRateSec > 0.0 ? static_cast<uint32_t>(maxRewindHistory / clientInputRateSec) : 0;
 
+        // Size the history for the whole rewind window up front, so recording inputs and replaying corrections does not allocate
+        m_inputHistory.Reserve(maxClientInputs + 1);
+        m_replayInputs.reserve(maxClientInputs + 1);
+
         IMultiplayer* multiplayer = GetMultiplayer();
         INetworkTime* networkTime = GetNetworkTime();
         while (m_moveAccumulator >= clientInputRateSec)
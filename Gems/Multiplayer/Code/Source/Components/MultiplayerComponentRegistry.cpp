@@ -47,6 +47,18 @@ namespace Multiplayer
         return componentData.m_componentRpcNameLookupFunction(rpcIndex);
     }
 
+    NetComponentId MultiplayerComponentRegistry::FindNetComponentId(const AZ::Name& componentName) const
+    {
+        for (auto it = m_componentData.begin(); it != m_componentData.end(); ++it)
+        {
+            if (it->second.m_componentName == componentName)
+            {
+                return it->first;
+            }
+        }
+        return InvalidNetComponentId;
+    }
+
     const MultiplayerComponentRegistry::ComponentData& MultiplayerComponentRegistry::GetMultiplayerComponentData(NetComponentId netComponentId) const
     {
         static ComponentData nullComponentData;
@@ -9,6 +9,7 @@
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/MultiplayerComponent.h>
 #include <Multiplayer/Components/MultiplayerController.h>
+#include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
@@ -297,7 +298,30 @@ namespace Multiplayer
     void NetBindComponent::ReprocessInput(NetworkInput& networkInput, float deltaTime)
     {
         m_isReprocessingInput = true;
-        ProcessInput(networkInput, deltaTime);
+        m_isProcessingInput = true;
+        AZ_Assert((NetworkRoleHasController(m_netEntityRole)), "Incorrect network role for input processing");
+        for (MultiplayerComponent* multiplayerComponent : m_multiplayerPredictedComponentVector)
+        {
+            multiplayerComponent->GetController()->ProcessInput(networkInput, deltaTime);
+        }
+        m_isProcessingInput = false;
+        m_isReprocessingInput = false;
+    }
+
+    void NetBindComponent::ReprocessInputs(const AZStd::vector<NetworkInput*>& networkInputs, float deltaTime, AzNetworking::ConnectionId rewindConnectionId)
+    {
+        m_isReprocessingInput = true;
+        m_isProcessingInput = true;
+        AZ_Assert((NetworkRoleHasController(m_netEntityRole)), "Incorrect network role for input processing");
+        for (NetworkInput* networkInput : networkInputs)
+        {
+            ScopedAlterTime scopedTime(networkInput->GetHostFrameId(), networkInput->GetHostTimeMs(), networkInput->GetHostBlendFactor(), rewindConnectionId);
+            for (MultiplayerComponent* multiplayerComponent : m_multiplayerPredictedComponentVector)
+            {
+                multiplayerComponent->GetController()->ProcessInput(*networkInput, deltaTime);
+            }
+        }
+        m_isProcessingInput = false;
         m_isReprocessingInput = false;
     }
 
@@ -693,6 +717,16 @@ namespace Multiplayer
                     return left->GetController()->GetInputOrder() < right->GetController()->GetInputOrder();
                 }
         );
+
+        // Controllers that opted out of prediction have nothing to correct, so they are skipped when replaying inputs
+        m_multiplayerPredictedComponentVector.clear();
+        for (MultiplayerComponent* multiplayerComponent : m_multiplayerInputComponentVector)
+        {
+            if (multiplayerComponent->GetController()->IsPredicted())
+            {
+                m_multiplayerPredictedComponentVector.push_back(multiplayerComponent);
+            }
+        }
     }
 
     void NetBindComponent::StopEntity()
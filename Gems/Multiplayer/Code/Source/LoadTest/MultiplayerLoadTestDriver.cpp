@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/MultiplayerConstants.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <LoadTest/MultiplayerLoadTestDriver.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Framework/INetworking.h>
+
+namespace Multiplayer
+{
+    using namespace AzNetworking;
+
+    AZ_CVAR(uint32_t, cl_loadTestConnections, 16, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of simulated clients StartLoadTest connects when no count is provided");
+
+    // Matches the client input rate of LocalPredictionPlayerInputComponent if cl_InputRateMs can't be read
+    static constexpr AZ::TimeMs DefaultInputRateMs = AZ::TimeMs{ 33 };
+
+    // Upper bound on the rpc indices searched when resolving the input rpc by name
+    static constexpr uint16_t MaxRpcIndexLookup = 256;
+
+    static constexpr const char* InputComponentName = "LocalPredictionPlayerInputComponent";
+    static constexpr const char* SendInputRpcName = "SendClientInput";
+
+    //! Parameters of LocalPredictionPlayerInputComponent's SendClientInput rpc.
+    //! The generated parameter struct is private to the component's generated source, this serializes the same members in the same order.
+    struct LoadTestClientInputRpcStruct
+        : public IRpcParamStruct
+    {
+        LoadTestClientInputRpcStruct(const NetworkInputArray& inputArray, const AZ::HashValue32& stateHash)
+            : m_inputArray(inputArray)
+            , m_stateHash(stateHash)
+        {
+            ;
+        }
+
+        bool Serialize(AzNetworking::ISerializer& serializer) override
+        {
+            return serializer.Serialize(m_inputArray, "InputArray")
+                && serializer.Serialize(m_stateHash, "StateHash");
+        }
+
+        NetworkInputArray m_inputArray;
+        AZ::HashValue32 m_stateHash;
+    };
+
+    MultiplayerLoadTestDriver::MultiplayerLoadTestDriver()
+        : m_sendInputsEvent([this]() { SendInputs(); }, AZ::Name("LoadTestSendInputs Event"))
+    {
+        ;
+    }
+
+    MultiplayerLoadTestDriver::~MultiplayerLoadTestDriver()
+    {
+        Stop();
+    }
+
+    bool MultiplayerLoadTestDriver::Start(const IpAddress& remoteAddress, uint32_t connectionCount)
+    {
+        if (IsRunning())
+        {
+            AZLOG_WARN("A load test is already running, stop it before starting a new one");
+            return false;
+        }
+
+        MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        m_inputComponentId = (componentRegistry != nullptr) ? componentRegistry->FindNetComponentId(AZ::Name(InputComponentName)) : InvalidNetComponentId;
+        if (m_inputComponentId == InvalidNetComponentId)
+        {
+            AZLOG_ERROR("Unable to start load test, %s is not registered", InputComponentName);
+            return false;
+        }
+
+        // The rpc enumeration is private to the generated component source, so resolve the input rpc through its registered name
+        bool foundInputRpc = false;
+        for (uint16_t index = 0; index < MaxRpcIndexLookup; ++index)
+        {
+            if (strcmp(componentRegistry->GetComponentRpcName(m_inputComponentId, RpcIndex{ index }), SendInputRpcName) == 0)
+            {
+                m_sendInputRpcIndex = RpcIndex{ index };
+                foundInputRpc = true;
+                break;
+            }
+        }
+        if (!foundInputRpc)
+        {
+            AZLOG_ERROR("Unable to start load test, %s has no %s rpc", InputComponentName, SendInputRpcName);
+            return false;
+        }
+
+        m_networkInterface = AZ::Interface<INetworking>::Get()->CreateNetworkInterface(
+            AZ::Name(MpLoadTestInterfaceName), ProtocolType::Udp, TrustZone::ExternalClientToServer, *this);
+        if (m_networkInterface == nullptr)
+        {
+            AZLOG_ERROR("Unable to start load test, failed to create the load test network interface");
+            return false;
+        }
+
+        uint32_t openedConnections = 0;
+        for (uint32_t i = 0; i < connectionCount; ++i)
+        {
+            if (m_networkInterface->Connect(remoteAddress) != InvalidConnectionId)
+            {
+                ++openedConnections;
+            }
+        }
+
+        if (openedConnections == 0)
+        {
+            AZLOG_ERROR("Unable to start load test, no connections could be opened to %s", remoteAddress.GetString().c_str());
+            Stop();
+            return false;
+        }
+
+        AZ::TimeMs inputRateMs = DefaultInputRateMs;
+        if (auto console = AZ::Interface<AZ::IConsole>::Get(); console)
+        {
+            console->GetCvarValue("cl_InputRateMs", inputRateMs);
+        }
+        m_sendInputsEvent.Enqueue(inputRateMs, true);
+
+        AZLOG_INFO("Load test opened %u of %u simulated client connections to %s", openedConnections, connectionCount, remoteAddress.GetString().c_str());
+        return true;
+    }
+
+    void MultiplayerLoadTestDriver::Stop()
+    {
+        m_sendInputsEvent.RemoveFromQueue();
+        if (m_networkInterface != nullptr)
+        {
+            auto visitor = [](IConnection& connection) { connection.Disconnect(DisconnectReason::TerminatedByUser, TerminationEndpoint::Local); };
+            m_networkInterface->GetConnectionSet().VisitConnections(visitor);
+            AZ::Interface<INetworking>::Get()->DestroyNetworkInterface(AZ::Name(MpLoadTestInterfaceName));
+            m_networkInterface = nullptr;
+        }
+        m_simulatedClients.clear();
+
+        if (IMultiplayer* multiplayer = GetMultiplayer(); multiplayer != nullptr)
+        {
+            multiplayer->GetStats().m_loadTestStats.m_connectionCount = 0;
+        }
+    }
+
+    bool MultiplayerLoadTestDriver::IsRunning() const
+    {
+        return m_networkInterface != nullptr;
+    }
+
+    bool MultiplayerLoadTestDriver::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Connect& packet
+    )
+    {
+        // Simulated clients only ever connect out, they never accept a connection
+        return false;
+    }
+
+    bool MultiplayerLoadTestDriver::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::Accept& packet
+    )
+    {
+        // Skip loading the level, simulated clients only need the replicated state of their player entity
+        connection->SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(true));
+        return true;
+    }
+
+    bool MultiplayerLoadTestDriver::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ReadyForEntityUpdates& packet
+    )
+    {
+        return false;
+    }
+
+    bool MultiplayerLoadTestDriver::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::SyncConsole& packet
+    )
+    {
+        // Simulated clients share the console of the host process, replicated cvars are already applied
+        return true;
+    }
+
+    bool MultiplayerLoadTestDriver::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ConsoleCommand& packet
+    )
+    {
+        return true;
+    }
+
+    bool MultiplayerLoadTestDriver::HandleRequest
+    (
+        AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        MultiplayerPackets::EntityUpdates& packet
+    )
+    {
+        auto clientIter = m_simulatedClients.find(connection->GetConnectionId());
+        if (clientIter == m_simulatedClients.end())
+        {
+            return true;
+        }
+
+        SimulatedClient& simulatedClient = clientIter->second;
+        if (packet.GetHostFrameId() > simulatedClient.m_lastHostFrameId)
+        {
+            simulatedClient.m_lastHostFrameId = packet.GetHostFrameId();
+            simulatedClient.m_lastHostTimeMs = packet.GetHostTimeMs();
+        }
+
+        if (simulatedClient.m_playerEntityId == InvalidNetEntityId)
+        {
+            for (const NetworkEntityUpdateMessage& updateMessage : packet.GetEntityMessages())
+            {
+                if (updateMessage.GetNetworkRole() == NetEntityRole::Autonomous && !updateMessage.GetIsDelete())
+                {
+                    simulatedClient.m_playerEntityId = updateMessage.GetEntityId();
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool MultiplayerLoadTestDriver::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::EntityRpcs& packet
+    )
+    {
+        // Corrections and other rpcs are discarded, simulated clients do not predict
+        return true;
+    }
+
+    bool MultiplayerLoadTestDriver::HandleRequest
+    (
+        [[maybe_unused]] AzNetworking::IConnection* connection,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] MultiplayerPackets::ClientMigration& packet
+    )
+    {
+        return false;
+    }
+
+    ConnectResult MultiplayerLoadTestDriver::ValidateConnect
+    (
+        [[maybe_unused]] const IpAddress& remoteAddress,
+        [[maybe_unused]] const IPacketHeader& packetHeader,
+        [[maybe_unused]] ISerializer& serializer
+    )
+    {
+        return ConnectResult::Rejected;
+    }
+
+    void MultiplayerLoadTestDriver::OnConnect(AzNetworking::IConnection* connection)
+    {
+        SimulatedClient& simulatedClient = m_simulatedClients[connection->GetConnectionId()];
+        for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+        {
+            // Scripted inputs carry no component inputs, attach without a NetBindComponent so the array can be serialized
+            simulatedClient.m_inputArray[i].AttachNetBindComponent(nullptr);
+        }
+
+        connection->SendReliablePacket(MultiplayerPackets::Connect(0, ""));
+        GetMultiplayer()->GetStats().m_loadTestStats.m_connectionCount = m_simulatedClients.size();
+    }
+
+    AzNetworking::PacketDispatchResult MultiplayerLoadTestDriver::OnPacketReceived(AzNetworking::IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
+    {
+        if (packetHeader.GetPacketType() == MultiplayerPackets::EntityUpdates::Type)
+        {
+            // The host and the simulated clients share a process, so the host time stamped on the update is directly comparable to local time
+            const uint32_t packetSize = serializer.GetSize();
+            const PacketDispatchResult result = MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+            auto clientIter = m_simulatedClients.find(connection->GetConnectionId());
+            if (clientIter != m_simulatedClients.end())
+            {
+                const AZ::TimeMs latencyMs = AZ::GetElapsedTimeMs() - clientIter->second.m_lastHostTimeMs;
+                GetMultiplayer()->GetStats().RecordLoadTestUpdateReceived(packetSize, latencyMs);
+            }
+            return result;
+        }
+        return MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
+    }
+
+    void MultiplayerLoadTestDriver::OnPacketLost([[maybe_unused]] IConnection* connection, [[maybe_unused]] PacketId packetId)
+    {
+        ;
+    }
+
+    void MultiplayerLoadTestDriver::OnDisconnect(AzNetworking::IConnection* connection, [[maybe_unused]] DisconnectReason reason, [[maybe_unused]] TerminationEndpoint endpoint)
+    {
+        m_simulatedClients.erase(connection->GetConnectionId());
+        GetMultiplayer()->GetStats().m_loadTestStats.m_connectionCount = m_simulatedClients.size();
+    }
+
+    void MultiplayerLoadTestDriver::StartLoadTest(const AZ::ConsoleCommandContainer& arguments)
+    {
+        uint32_t connectionCount = cl_loadTestConnections;
+        if (arguments.size() > 0)
+        {
+            const AZ::CVarFixedString countString{ arguments.front() };
+            connectionCount = aznumeric_cast<uint32_t>(atol(countString.c_str()));
+        }
+
+        uint16_t serverPort = DefaultServerPort;
+        if (auto console = AZ::Interface<AZ::IConsole>::Get(); console)
+        {
+            console->GetCvarValue("sv_port", serverPort);
+        }
+
+        const AZ::CVarFixedString localHost(LocalHost);
+        Start(IpAddress(localHost.c_str(), serverPort, ProtocolType::Udp), connectionCount);
+    }
+
+    void MultiplayerLoadTestDriver::StopLoadTest([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        Stop();
+    }
+
+    void MultiplayerLoadTestDriver::SendInputs()
+    {
+        for (auto clientIter = m_simulatedClients.begin(); clientIter != m_simulatedClients.end(); ++clientIter)
+        {
+            SimulatedClient& simulatedClient = clientIter->second;
+            if (simulatedClient.m_playerEntityId == InvalidNetEntityId)
+            {
+                continue;
+            }
+
+            // Newest input first, older entries repeat the previous ids so the host can recover lost inputs
+            ++simulatedClient.m_clientInputId;
+            for (uint32_t i = 0; i < NetworkInputArray::MaxElements; ++i)
+            {
+                NetworkInput& input = simulatedClient.m_inputArray[i];
+                input.SetClientInputId(simulatedClient.m_clientInputId - ClientInputId{ static_cast<uint16_t>(i) });
+                input.SetHostFrameId(simulatedClient.m_lastHostFrameId);
+                input.SetHostTimeMs(simulatedClient.m_lastHostTimeMs);
+                input.SetHostBlendFactor(1.0f);
+            }
+
+            LoadTestClientInputRpcStruct rpcStruct(simulatedClient.m_inputArray, AZ::HashValue32{ 0 });
+            NetworkEntityRpcMessage rpcMessage(RpcDeliveryType::AutonomousToAuthority, simulatedClient.m_playerEntityId, m_inputComponentId, m_sendInputRpcIndex, ReliabilityType::Unreliable);
+            rpcMessage.SetRpcParams(rpcStruct);
+
+            MultiplayerPackets::EntityRpcs entityRpcsPacket;
+            entityRpcsPacket.ModifyEntityRpcs().push_back(AZStd::move(rpcMessage));
+            m_networkInterface->SendUnreliablePacket(clientIter->first, entityRpcsPacket);
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Source/NetworkInput/NetworkInputArray.h>
+#include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+
+namespace AzNetworking
+{
+    class INetworkInterface;
+}
+
+namespace Multiplayer
+{
+    //! MultiplayerLoadTestDriver opens simulated client connections to a host over its own UDP network interface.
+    //! Each simulated client performs the regular connection handshake, streams scripted inputs for the player entity the host
+    //! assigns it and records the entity updates it receives into MultiplayerStats. Simulated clients never load a level or
+    //! create entities, so a single headless process can drive many connections against a local server.
+    class MultiplayerLoadTestDriver final
+        : public AzNetworking::IConnectionListener
+    {
+    public:
+        MultiplayerLoadTestDriver();
+        ~MultiplayerLoadTestDriver();
+
+        //! Opens simulated client connections to the provided host.
+        //! @param remoteAddress   the address of the host to connect to
+        //! @param connectionCount the number of simulated clients to connect
+        //! @return boolean true if the connections were opened, false if a load test is already running or the host is unreachable
+        bool Start(const AzNetworking::IpAddress& remoteAddress, uint32_t connectionCount);
+
+        //! Disconnects all simulated clients and releases the load test network interface.
+        void Stop();
+
+        //! Returns whether a load test is currently running.
+        //! @return boolean true if a load test is currently running
+        bool IsRunning() const;
+
+        bool IsHandshakeComplete() const { return true; };
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Connect& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::Accept& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ReadyForEntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::SyncConsole& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ConsoleCommand& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityUpdates& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::EntityRpcs& packet);
+        bool HandleRequest(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, MultiplayerPackets::ClientMigration& packet);
+
+        //! IConnectionListener interface
+        //! @{
+        AzNetworking::ConnectResult ValidateConnect(const AzNetworking::IpAddress& remoteAddress, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnConnect(AzNetworking::IConnection* connection) override;
+        AzNetworking::PacketDispatchResult OnPacketReceived(AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, AzNetworking::ISerializer& serializer) override;
+        void OnPacketLost(AzNetworking::IConnection* connection, AzNetworking::PacketId packetId) override;
+        void OnDisconnect(AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        //! @}
+
+        //! Console commands.
+        //! @{
+        void StartLoadTest(const AZ::ConsoleCommandContainer& arguments);
+        void StopLoadTest(const AZ::ConsoleCommandContainer& arguments);
+        //! @}
+
+    private:
+
+        //! Sends the next scripted input from every simulated client that has been assigned a player entity.
+        void SendInputs();
+
+        AZ_CONSOLEFUNC(MultiplayerLoadTestDriver, StartLoadTest, AZ::ConsoleFunctorFlags::DontReplicate, "Connects simulated clients to the local host, optionally takes the number of clients to connect");
+        AZ_CONSOLEFUNC(MultiplayerLoadTestDriver, StopLoadTest, AZ::ConsoleFunctorFlags::DontReplicate, "Disconnects all simulated load test clients");
+
+        struct SimulatedClient
+        {
+            NetworkInputArray m_inputArray;
+            NetEntityId m_playerEntityId = InvalidNetEntityId;
+            ClientInputId m_clientInputId = ClientInputId{ 0 };
+            HostFrameId m_lastHostFrameId = HostFrameId{ 0 };
+            AZ::TimeMs m_lastHostTimeMs = AZ::TimeMs{ 0 };
+        };
+
+        AzNetworking::INetworkInterface* m_networkInterface = nullptr;
+        AZStd::unordered_map<AzNetworking::ConnectionId, SimulatedClient> m_simulatedClients;
+        AZ::ScheduledEvent m_sendInputsEvent;
+        NetComponentId m_inputComponentId = InvalidNetComponentId;
+        RpcIndex m_sendInputRpcIndex = RpcIndex{ 0 };
+    };
+}
@@ -92,10 +92,50 @@ namespace Multiplayer
         m_events.m_rpcReceived.Signal(entityId, entityName, netComponentId, rpcId, totalBytes);
     }
 
+    void MultiplayerStats::RecordEntityUpdateSent(NetEntityId netEntityId, uint32_t totalBytes)
+    {
+        EntityStats& entityStats = m_entityStats[netEntityId];
+        entityStats.m_updatesSent.m_totalCalls++;
+        entityStats.m_updatesSent.m_totalBytes += totalBytes;
+        entityStats.m_updatesSent.m_callHistory[m_recordMetricIndex]++;
+        entityStats.m_updatesSent.m_byteHistory[m_recordMetricIndex] += totalBytes;
+        entityStats.m_lastRecordedTick = m_tickCount;
+    }
+
+    void MultiplayerStats::RecordEntityUpdateDeferred(NetEntityId netEntityId)
+    {
+        EntityStats& entityStats = m_entityStats[netEntityId];
+        entityStats.m_updatesDeferred++;
+        entityStats.m_lastRecordedTick = m_tickCount;
+    }
+
+    void MultiplayerStats::RecordServerTickTime(uint64_t tickTimeUs)
+    {
+        m_serverTickSamples++;
+        m_totalServerTickTimeUs += tickTimeUs;
+        m_maxServerTickTimeUs = AZStd::max(m_maxServerTickTimeUs, tickTimeUs);
+        m_serverTickTimeUsHistory[m_recordMetricIndex] += tickTimeUs;
+    }
+
+    void MultiplayerStats::RecordLoadTestUpdateReceived(uint32_t totalBytes, AZ::TimeMs latencyMs)
+    {
+        const uint64_t clampedLatencyMs = static_cast<uint64_t>(AZStd::max(latencyMs, AZ::TimeMs{ 0 }));
+        m_loadTestStats.m_updatesRecv.m_totalCalls++;
+        m_loadTestStats.m_updatesRecv.m_totalBytes += totalBytes;
+        m_loadTestStats.m_updatesRecv.m_callHistory[m_recordMetricIndex]++;
+        m_loadTestStats.m_updatesRecv.m_byteHistory[m_recordMetricIndex] += totalBytes;
+        m_loadTestStats.m_totalLatencyMs += clampedLatencyMs;
+        m_loadTestStats.m_maxLatencyMs = AZStd::max(m_loadTestStats.m_maxLatencyMs, clampedLatencyMs);
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
         m_recordMetricIndex = ++m_recordMetricIndex % RingbufferSamples;
+        ++m_tickCount;
+        m_serverTickTimeUsHistory[m_recordMetricIndex] = 0;
+        m_loadTestStats.m_updatesRecv.m_callHistory[m_recordMetricIndex] = 0;
+        m_loadTestStats.m_updatesRecv.m_byteHistory[m_recordMetricIndex] = 0;
         for (ComponentStats& componentStats : m_componentStats)
         {
             for (Metric& metric : componentStats.m_propertyUpdatesSent)
@@ -119,6 +159,20 @@ namespace Multiplayer
                 metric.m_byteHistory[m_recordMetricIndex] = 0;
             }
         }
+        for (auto iter = m_entityStats.begin(); iter != m_entityStats.end();)
+        {
+            if (m_tickCount - iter->second.m_lastRecordedTick >= RingbufferSamples)
+            {
+                // Nothing recorded for this entity within our history window, stop tracking it
+                iter = m_entityStats.erase(iter);
+            }
+            else
+            {
+                iter->second.m_updatesSent.m_callHistory[m_recordMetricIndex] = 0;
+                iter->second.m_updatesSent.m_byteHistory[m_recordMetricIndex] = 0;
+                ++iter;
+            }
+        }
     }
 
     static void CombineMetrics(MultiplayerStats::Metric& outArg1, const MultiplayerStats::Metric& arg2)
@@ -210,6 +264,28 @@ namespace Multiplayer
         return result;
     }
 
+    MultiplayerStats::Metric MultiplayerStats::CalculateEntityUpdateSentMetrics(NetEntityId netEntityId) const
+    {
+        auto iter = m_entityStats.find(netEntityId);
+        return (iter != m_entityStats.end()) ? iter->second.m_updatesSent : Metric();
+    }
+
+    uint64_t MultiplayerStats::CalculateAverageServerTickTimeUs() const
+    {
+        const uint64_t sampleCount = AZStd::min(m_serverTickSamples, aznumeric_cast<uint64_t>(RingbufferSamples));
+        if (sampleCount == 0)
+        {
+            return 0;
+        }
+
+        uint64_t totalTickTimeUs = 0;
+        for (uint64_t tickTimeUs : m_serverTickTimeUsHistory)
+        {
+            totalTickTimeUs += tickTimeUs;
+        }
+        return totalTickTimeUs / sampleCount;
+    }
+
     void MultiplayerStats::ConnectHandlers(EventHandlers& handlers)
     {
         handlers.m_entitySerializeStart.Connect(m_events.m_entitySerializeStart);
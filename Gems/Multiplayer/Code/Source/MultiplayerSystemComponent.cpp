@@ -26,6 +26,7 @@
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Utils/Utils.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzFramework/Components/CameraBus.h>
 #include <AzFramework/Session/ISessionRequests.h>
 #include <AzFramework/Session/SessionConfig.h>
@@ -87,6 +88,9 @@ namespace Multiplayer
     AZ_CVAR(float, cl_renderTickBlendBase, 0.15f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The base used for blending between network updates, 0.1 will be quite linear, 0.2 or 0.3 will "
         "slow down quicker and may be better suited to connections with highly variable latency");
+    AZ_CVAR(AZ::TimeMs, sv_fixedFrameTimeMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If non-zero, the host advances by this fixed time every frame instead of the real frame time. "
+        "Pair with net_UdpReplayStepMs to replay packet captures deterministically as fast as possible");
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
@@ -187,6 +191,7 @@ namespace Multiplayer
         }
         AZ::Interface<IMultiplayer>::Register(this);
         AZ::Interface<AzFramework::ISessionHandlingClientRequests>::Register(this);
+        m_physicsHistory.Activate();
 
         //! Register our gems multiplayer components to assign NetComponentIds
         RegisterMultiplayerComponents();
@@ -194,6 +199,10 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::Deactivate()
     {
+#if !defined(AZ_RELEASE_BUILD)
+        m_loadTestDriver.Stop();
+#endif
+        m_physicsHistory.Deactivate();
         AZ::Interface<AzFramework::ISessionHandlingClientRequests>::Unregister(this);
         AZ::Interface<IMultiplayer>::Unregister(this);
         m_consoleCommandHandler.Disconnect();
@@ -309,6 +318,13 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        const AZStd::chrono::monotonic_clock::time_point tickStartTime = AZStd::chrono::monotonic_clock::now();
+        const AZ::TimeMs fixedFrameTimeMs = sv_fixedFrameTimeMs;
+        if (fixedFrameTimeMs > AZ::TimeMs{ 0 })
+        {
+            deltaTime = static_cast<float>(fixedFrameTimeMs) / 1000.0f;
+        }
+
         const AZ::TimeMs deltaTimeMs = aznumeric_cast<AZ::TimeMs>(static_cast<int32_t>(deltaTime * 1000.0f));
         const AZ::TimeMs hostTimeMs = AZ::GetElapsedTimeMs();
         const AZ::TimeMs serverRateMs = static_cast<AZ::TimeMs>(sv_serverSendRateMs);
@@ -335,6 +351,13 @@ namespace Multiplayer
         // Restore any entities that were rewound during input processing so that normal gameplay updates have the correct state
         Multiplayer::GetNetworkTime()->ClearRewoundEntities();
 
+        // Record networked rigid body poses for this frame so rewound scene queries can test against what clients were shown
+        if (GetAgentType() == MultiplayerAgentType::ClientServer
+         || GetAgentType() == MultiplayerAgentType::DedicatedServer)
+        {
+            m_physicsHistory.RecordFrame(m_networkTime.GetHostFrameId());
+        }
+
         // Let the network system know the frame is done and we can collect dirty bits
         m_networkEntityManager.NotifyEntitiesChanged();
         m_networkEntityManager.NotifyEntitiesDirtied();
@@ -394,6 +417,13 @@ namespace Multiplayer
         {
             m_networkInterface->GetConnectionSet().VisitConnections(visitor);
         }
+
+        if (GetAgentType() == MultiplayerAgentType::ClientServer
+         || GetAgentType() == MultiplayerAgentType::DedicatedServer)
+        {
+            const auto tickTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::monotonic_clock::now() - tickStartTime);
+            stats.RecordServerTickTime(aznumeric_cast<uint64_t>(tickTime.count()));
+        }
     }
 
     int MultiplayerSystemComponent::GetTickOrder()
@@ -865,6 +895,22 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs sent bytes: %llu", aznumeric_cast<AZ::u64>(rpcsSent.m_totalBytes));
         AZLOG_INFO("Total RPCs received: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalCalls));
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
+
+        if (stats.m_serverTickSamples > 0)
+        {
+            AZLOG_INFO("Server tick time average (us): %llu", aznumeric_cast<AZ::u64>(stats.CalculateAverageServerTickTimeUs()));
+            AZLOG_INFO("Server tick time max (us): %llu", aznumeric_cast<AZ::u64>(stats.m_maxServerTickTimeUs));
+        }
+
+        const MultiplayerStats::LoadTestStats& loadTestStats = stats.m_loadTestStats;
+        if (loadTestStats.m_updatesRecv.m_totalCalls > 0)
+        {
+            const AZ::u64 connectionCount = AZStd::max<AZ::u64>(loadTestStats.m_connectionCount, 1);
+            AZLOG_INFO("Load test client connections: %llu", aznumeric_cast<AZ::u64>(loadTestStats.m_connectionCount));
+            AZLOG_INFO("Load test entity update bytes per connection: %llu", aznumeric_cast<AZ::u64>(loadTestStats.m_updatesRecv.m_totalBytes / connectionCount));
+            AZLOG_INFO("Load test replication latency average (ms): %llu", aznumeric_cast<AZ::u64>(loadTestStats.m_totalLatencyMs / loadTestStats.m_updatesRecv.m_totalCalls));
+            AZLOG_INFO("Load test replication latency max (ms): %llu", aznumeric_cast<AZ::u64>(loadTestStats.m_maxLatencyMs));
+        }
     }
 
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
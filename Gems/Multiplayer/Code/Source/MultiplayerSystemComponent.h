@@ -10,8 +10,10 @@
 
 #include <Multiplayer/IMultiplayer.h>
 #include <Editor/MultiplayerEditorConnection.h>
+#include <LoadTest/MultiplayerLoadTestDriver.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <Physics/PhysicsHistory.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -142,6 +144,7 @@ namespace Multiplayer
 
         NetworkEntityManager m_networkEntityManager;
         NetworkTime m_networkTime;
+        PhysicsHistory m_physicsHistory;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
@@ -163,6 +166,7 @@ namespace Multiplayer
 
 #if !defined(AZ_RELEASE_BUILD)
         MultiplayerEditorConnection m_editorConnectionListener;
+        MultiplayerLoadTestDriver m_loadTestDriver;
 #endif
     };
 }
@@ -37,6 +37,8 @@ namespace Multiplayer
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(bool, bg_BitPackEntityUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Bit pack entity update payloads rather than byte aligning each value, must match on the client and server");
+    AZ_CVAR(uint32_t, sv_ReplicationBudgetBytesPerTick, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of bytes of entity updates a server may send to each client per tick, 0 is unlimited");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -63,6 +65,11 @@ namespace Multiplayer
         }
     }
 
+    AzNetworking::SerializerPacking EntityReplicationManager::GetEntityUpdatePacking()
+    {
+        return bg_BitPackEntityUpdates ? AzNetworking::SerializerPacking::BitPacked : AzNetworking::SerializerPacking::ByteAligned;
+    }
+
     void EntityReplicationManager::SetRemoteHostId(HostId hostId)
     {
         m_remoteHostId = hostId;
@@ -151,6 +158,10 @@ namespace Multiplayer
             replicatorUpdatedList.push_back(replicator);
             toSendList.pop_front();
 
+            const NetEntityId netEntityId = replicator->GetEntityHandle().GetNetEntityId();
+            m_priorityAccumulator.RecordSent(netEntityId, m_frameTimeMs, nextMessageSize);
+            GetMultiplayer()->GetStats().RecordEntityUpdateSent(netEntityId, nextMessageSize);
+
             if (largeEntityDetected)
             {
                 AZLOG_WARN("\n\n*******************************");
@@ -182,10 +193,10 @@ namespace Multiplayer
             return EntityReplicatorList();
         }
 
-        // Generate a list of all our entities that need updates
-        EntityReplicatorList toSendList;
+        // Gather all our entities that need updates
+        m_sendCandidates.clear();
+        m_deferredCandidates.clear();
 
-        uint32_t proxySendCount = 0;
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
         {
             bool clearPendingSend = true;
@@ -218,16 +229,12 @@ namespace Multiplayer
                             m_remoteEntitiesPendingCreation.insert(entityId);
                         }
 
-                        if (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous ||
-                            replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous)
-                        {
-                            toSendList.push_back(replicator);
-                        }
-                        else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
-                        {
-                            toSendList.push_back(replicator);
-                            ++proxySendCount;
-                        }
+                        ReplicationPriorityAccumulator::Candidate candidate;
+                        candidate.m_replicator = replicator;
+                        candidate.m_netEntityId = entityId;
+                        candidate.m_alwaysSend = (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous ||
+                            replicator->GetBoundLocalNetworkRole() == NetEntityRole::Autonomous);
+                        m_sendCandidates.push_back(candidate);
                     }
                 }
             }
@@ -243,6 +250,39 @@ namespace Multiplayer
             }
         }
 
+        // Order by accumulated priority, only server to client connections are bandwidth constrained
+        const uint32_t budgetBytes = (m_updateMode == Mode::LocalServerToRemoteClient) ? static_cast<uint32_t>(sv_ReplicationBudgetBytesPerTick) : 0;
+        m_priorityAccumulator.SelectCandidates(m_frameTimeMs, budgetBytes, m_sendCandidates, &m_deferredCandidates);
+
+        // Generate a list of all our entities that will be sent this tick
+        EntityReplicatorList toSendList;
+
+        uint32_t proxySendCount = 0;
+        const uint32_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        for (const ReplicationPriorityAccumulator::Candidate& candidate : m_sendCandidates)
+        {
+            if (candidate.m_alwaysSend)
+            {
+                toSendList.push_back(candidate.m_replicator);
+            }
+            else if (proxySendCount < maxProxySendCount)
+            {
+                toSendList.push_back(candidate.m_replicator);
+                ++proxySendCount;
+            }
+            else
+            {
+                m_deferredCandidates.push_back(candidate);
+            }
+        }
+
+        // Deferred replicators remain pending and keep accumulating priority until they are sent
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        for (const ReplicationPriorityAccumulator::Candidate& candidate : m_deferredCandidates)
+        {
+            stats.RecordEntityUpdateDeferred(candidate.m_netEntityId);
+        }
+
         return toSendList;
     }
 
@@ -330,6 +370,8 @@ namespace Multiplayer
             m_replicatorsPendingSend.clear();
         }
 
+        m_priorityAccumulator.Clear();
+
         m_entityReplicatorMap.clear();
     }
 
@@ -776,7 +818,7 @@ namespace Multiplayer
             return HandleEntityDeleteMessage(entityReplicator, packetHeader, updateMessage);
         }
 
-        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()), GetEntityUpdatePacking());
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -946,6 +988,7 @@ namespace Multiplayer
             {
                 if (newWindowIter->first && (newWindowIter->first.GetNetEntityId() < currWindowIter->first))
                 {
+                    m_priorityAccumulator.SetImportance(newWindowIter->first.GetNetEntityId(), newWindowIter->second.m_priority);
                     AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
                     ++newWindowIter;
                 }
@@ -960,6 +1003,8 @@ namespace Multiplayer
                 }
                 else // Same entity
                 {
+                    m_priorityAccumulator.SetImportance(currWindowIter->first, newWindowIter->second.m_priority);
+
                     // Check if we changed modes
                     EntityReplicator* currReplicator = currWindowIter->second.get();
                     if (currReplicator->GetRemoteNetworkRole() != newWindowIter->second.m_netEntityRole)
@@ -975,6 +1020,7 @@ namespace Multiplayer
             // Do remaining adds
             while (newWindowIter != newWindow.end())
             {
+                m_priorityAccumulator.SetImportance(newWindowIter->first.GetNetEntityId(), newWindowIter->second.m_priority);
                 AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
                 ++newWindowIter;
             }
@@ -1109,7 +1155,7 @@ namespace Multiplayer
                 // Send an update packet if it needs one
                 propPublisher->GenerateRecord();
                 bool needsNetworkPropertyUpdate = propPublisher->PrepareSerialization();
-                AzNetworking::NetworkInputSerializer inputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetCapacity()));
+                AzNetworking::NetworkInputSerializer inputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetCapacity()), GetEntityUpdatePacking());
                 if (needsNetworkPropertyUpdate)
                 {
                     // Write out entity state into the buffer
@@ -1134,7 +1180,7 @@ namespace Multiplayer
         {
             if (message.m_propertyUpdateData.GetSize() > 0)
             {
-                AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetSize()));
+                AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outputSerializer(message.m_propertyUpdateData.GetBuffer(), static_cast<uint32_t>(message.m_propertyUpdateData.GetSize()), GetEntityUpdatePacking());
                 if (!HandlePropertyChangeMessage
                 (
                     invokingConnection, 
@@ -1237,6 +1283,7 @@ namespace Multiplayer
                 if (replicator->IsDeletionAcknowledged())
                 {
                     m_remoteEntitiesPendingCreation.erase(replicator->GetEntityHandle().GetNetEntityId());
+                    m_priorityAccumulator.RemoveEntity(*iter);
                     m_entityReplicatorMap.erase(*iter);
                     iter = m_replicatorsPendingRemoval.erase(iter);
                 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Source/NetworkEntity/EntityReplication/ReplicationPriorityAccumulator.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
@@ -18,6 +19,7 @@
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
+#include <AzNetworking/Serialization/ISerializer.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
@@ -54,6 +56,10 @@ namespace Multiplayer
         EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode mode);
         ~EntityReplicationManager() = default;
 
+        //! Returns the packing used for entity update payloads, controlled by bg_BitPackEntityUpdates.
+        //! @return the packing used for entity update payloads
+        static AzNetworking::SerializerPacking GetEntityUpdatePacking();
+
         void SetRemoteHostId(HostId hostId);
         HostId GetRemoteHostId() const;
 
@@ -185,6 +191,11 @@ namespace Multiplayer
         AZStd::set<NetEntityId> m_replicatorsPendingRemoval;
         AZStd::unordered_set<NetEntityId> m_replicatorsPendingSend;
 
+        //! Decides which pending replicators are sent each tick when bandwidth is constrained
+        ReplicationPriorityAccumulator m_priorityAccumulator;
+        ReplicationPriorityAccumulator::CandidateList m_sendCandidates;
+        ReplicationPriorityAccumulator::CandidateList m_deferredCandidates;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/ReplicationPriorityAccumulator.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(AZ::TimeMs, sv_ReplicationMaxStarvationMs, AZ::TimeMs{ 1000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Entities with pending changes that have not been sent for this long ignore the replication bandwidth budget");
+    AZ_CVAR(float, sv_ReplicationMinImportance, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "The minimum amount of priority an entity with pending changes accumulates per tick");
+
+    // Used for entities we have never sent, creation records tend to be larger than deltas
+    static constexpr uint32_t DefaultEstimatedEntityUpdateBytes = 64;
+
+    void ReplicationPriorityAccumulator::SetImportance(NetEntityId netEntityId, float importance)
+    {
+        GetOrCreateEntityState(netEntityId).m_importance = importance;
+    }
+
+    float ReplicationPriorityAccumulator::GetImportance(NetEntityId netEntityId) const
+    {
+        auto iter = m_entityStates.find(netEntityId);
+        return (iter != m_entityStates.end()) ? iter->second.m_importance : EntityState().m_importance;
+    }
+
+    float ReplicationPriorityAccumulator::GetAccumulatedPriority(NetEntityId netEntityId) const
+    {
+        auto iter = m_entityStates.find(netEntityId);
+        return (iter != m_entityStates.end()) ? iter->second.m_accumulatedPriority : 0.0f;
+    }
+
+    void ReplicationPriorityAccumulator::RemoveEntity(NetEntityId netEntityId)
+    {
+        m_entityStates.erase(netEntityId);
+    }
+
+    void ReplicationPriorityAccumulator::Clear()
+    {
+        m_entityStates.clear();
+        m_budgetBalance = 0;
+    }
+
+    void ReplicationPriorityAccumulator::SelectCandidates(AZ::TimeMs currentTimeMs, uint32_t budgetBytes, CandidateList& inOutCandidates, CandidateList* outDeferred)
+    {
+        const float minImportance = sv_ReplicationMinImportance;
+        const AZ::TimeMs maxStarvationMs = sv_ReplicationMaxStarvationMs;
+
+        for (Candidate& candidate : inOutCandidates)
+        {
+            EntityState& entityState = GetOrCreateEntityState(candidate.m_netEntityId);
+            if (!entityState.m_isPending)
+            {
+                entityState.m_isPending = true;
+                entityState.m_pendingSinceTimeMs = currentTimeMs;
+            }
+            entityState.m_accumulatedPriority += AZStd::max(entityState.m_importance, minImportance);
+
+            const bool isStarved = (currentTimeMs - entityState.m_pendingSinceTimeMs) >= maxStarvationMs;
+            candidate.m_sortPriority = (candidate.m_alwaysSend || isStarved)
+                ? AZStd::numeric_limits<float>::max()
+                : entityState.m_accumulatedPriority;
+        }
+
+        // Stable so that equal priorities keep a consistent order from tick to tick
+        AZStd::stable_sort(inOutCandidates.begin(), inOutCandidates.end(), [](const Candidate& lhs, const Candidate& rhs)
+        {
+            return lhs.m_sortPriority > rhs.m_sortPriority;
+        });
+
+        if (budgetBytes == 0)
+        {
+            // Unlimited budget, send everything
+            m_budgetBalance = 0;
+            return;
+        }
+
+        // Unspent budget does not carry over beyond a single tick, but overspending is paid back on subsequent ticks
+        m_budgetBalance = AZStd::min<int64_t>(m_budgetBalance + budgetBytes, budgetBytes);
+
+        int64_t remainingBytes = m_budgetBalance;
+        AZStd::size_t sendCount = 0;
+        for (; sendCount < inOutCandidates.size(); ++sendCount)
+        {
+            const Candidate& candidate = inOutCandidates[sendCount];
+            const bool mustSend = (candidate.m_sortPriority == AZStd::numeric_limits<float>::max());
+            if (!mustSend && remainingBytes <= 0)
+            {
+                break;
+            }
+
+            const EntityState& entityState = m_entityStates[candidate.m_netEntityId];
+            remainingBytes -= (entityState.m_estimatedBytes > 0) ? entityState.m_estimatedBytes : DefaultEstimatedEntityUpdateBytes;
+        }
+
+        if (outDeferred != nullptr)
+        {
+            outDeferred->insert(outDeferred->end(), inOutCandidates.begin() + sendCount, inOutCandidates.end());
+        }
+        inOutCandidates.resize(sendCount);
+    }
+
+    void ReplicationPriorityAccumulator::RecordSent(NetEntityId netEntityId, [[maybe_unused]] AZ::TimeMs currentTimeMs, uint32_t sentBytes)
+    {
+        EntityState& entityState = GetOrCreateEntityState(netEntityId);
+        entityState.m_accumulatedPriority = 0.0f;
+        entityState.m_isPending = false;
+        // Smooth the size estimate, a single large creation record shouldn't dominate future estimates
+        entityState.m_estimatedBytes = (entityState.m_estimatedBytes > 0)
+            ? (entityState.m_estimatedBytes * 3 + sentBytes) / 4
+            : sentBytes;
+        m_budgetBalance -= sentBytes;
+    }
+
+    int64_t ReplicationPriorityAccumulator::GetBudgetBalance() const
+    {
+        return m_budgetBalance;
+    }
+
+    ReplicationPriorityAccumulator::EntityState& ReplicationPriorityAccumulator::GetOrCreateEntityState(NetEntityId netEntityId)
+    {
+        return m_entityStates[netEntityId];
+    }
+}
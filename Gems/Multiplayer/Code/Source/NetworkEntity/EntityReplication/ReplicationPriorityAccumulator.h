@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class EntityReplicator;
+
+    //! @class ReplicationPriorityAccumulator
+    //! @brief Per-connection scheduler that decides which pending entity replicators get serialized each tick.
+    //! Every tick an entity has pending changes but is not sent, its importance is added to an accumulated priority.
+    //! Candidates are sent highest accumulated priority first until the per-tick bandwidth budget is spent.
+    //! Entities that have been starved for longer than sv_ReplicationMaxStarvationMs are always sent.
+    class ReplicationPriorityAccumulator final
+    {
+    public:
+        struct Candidate
+        {
+            EntityReplicator* m_replicator = nullptr;
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            //! Candidates that bypass the budget, such as autonomous entities
+            bool m_alwaysSend = false;
+            //! Filled in by SelectCandidates()
+            float m_sortPriority = 0.0f;
+        };
+        using CandidateList = AZStd::vector<Candidate>;
+
+        ReplicationPriorityAccumulator() = default;
+        ~ReplicationPriorityAccumulator() = default;
+
+        //! Sets the relative importance of an entity, generally provided by the replication window.
+        //! @param netEntityId the entity to set the importance of
+        //! @param importance  the relative importance, larger values accumulate priority faster
+        void SetImportance(NetEntityId netEntityId, float importance);
+
+        //! Returns the current importance of an entity.
+        //! @param netEntityId the entity to query
+        //! @return the importance of the entity, or the default importance if the entity is unknown
+        float GetImportance(NetEntityId netEntityId) const;
+
+        //! Returns the currently accumulated priority for an entity.
+        //! @param netEntityId the entity to query
+        //! @return the accumulated priority of the entity, 0 if the entity is unknown
+        float GetAccumulatedPriority(NetEntityId netEntityId) const;
+
+        //! Stops tracking an entity.
+        //! @param netEntityId the entity to stop tracking
+        void RemoveEntity(NetEntityId netEntityId);
+
+        //! Removes all tracked state.
+        void Clear();
+
+        //! Accumulates priority for the provided candidates, sorts them highest priority first and trims any candidates that do not fit the bandwidth budget.
+        //! @param currentTimeMs    the current frame time
+        //! @param budgetBytes      the number of bytes this connection may send per tick, 0 is unlimited
+        //! @param inOutCandidates  the set of candidates, on return contains only the candidates to send this tick in send order
+        //! @param outDeferred      optional list of candidates that were trimmed by the budget
+        void SelectCandidates(AZ::TimeMs currentTimeMs, uint32_t budgetBytes, CandidateList& inOutCandidates, CandidateList* outDeferred = nullptr);
+
+        //! Records that an entity update was serialized and sent, resetting its accumulated priority.
+        //! @param netEntityId   the entity that was sent
+        //! @param currentTimeMs the current frame time
+        //! @param sentBytes     the serialized size of the entity update
+        void RecordSent(NetEntityId netEntityId, AZ::TimeMs currentTimeMs, uint32_t sentBytes);
+
+        //! Returns the remaining bandwidth balance in bytes, negative values indicate the connection overspent its budget.
+        //! @return the remaining bandwidth balance
+        int64_t GetBudgetBalance() const;
+
+    private:
+        struct EntityState
+        {
+            float m_importance = 1.0f;
+            float m_accumulatedPriority = 0.0f;
+            uint32_t m_estimatedBytes = 0;
+            AZ::TimeMs m_pendingSinceTimeMs = AZ::TimeMs{ 0 };
+            bool m_isPending = false;
+        };
+
+        EntityState& GetOrCreateEntityState(NetEntityId netEntityId);
+
+        AZStd::unordered_map<NetEntityId, EntityState> m_entityStates;
+        int64_t m_budgetBalance = 0;
+    };
+}
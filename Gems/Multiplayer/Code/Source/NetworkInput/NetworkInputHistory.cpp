@@ -12,31 +12,64 @@ namespace Multiplayer
 {
     AZStd::size_t NetworkInputHistory::Size() const
     {
-        return m_history.size();
+        return m_size;
+    }
+
+    void NetworkInputHistory::Reserve(AZStd::size_t capacity)
+    {
+        if (capacity <= m_history.size())
+        {
+            return;
+        }
+
+        // Unwrap the ring so the current front lands at index 0
+        AZStd::vector<Wrapper> history;
+        history.reserve(capacity);
+        for (AZStd::size_t i = 0; i < m_history.size(); ++i)
+        {
+            history.emplace_back(m_history[GetRingIndex(i)].m_networkInput);
+        }
+        history.resize(capacity);
+        m_history.swap(history);
+        m_head = 0;
     }
 
     const NetworkInput& NetworkInputHistory::operator[](AZStd::size_t index) const
     {
-        return m_history[index].m_networkInput;
+        return m_history[GetRingIndex(index)].m_networkInput;
     }
 
     NetworkInput& NetworkInputHistory::operator[](AZStd::size_t index)
     {
-        return m_history[index].m_networkInput;
+        return m_history[GetRingIndex(index)].m_networkInput;
     }
 
     void NetworkInputHistory::PushBack(NetworkInput& networkInput)
     {
-        m_history.push_back(Wrapper(networkInput));
+        if (m_size == m_history.size())
+        {
+            Reserve(AZStd::max<AZStd::size_t>(m_history.size() * 2, 16));
+        }
+
+        // Assignment reuses the component inputs already allocated for this entry
+        m_history[GetRingIndex(m_size)].m_networkInput = networkInput;
+        ++m_size;
     }
 
     void NetworkInputHistory::PopFront()
     {
-        m_history.pop_front();
+        AZ_Assert(m_size > 0, "Popping from an empty input history");
+        m_head = (m_head + 1) % m_history.size();
+        --m_size;
     }
 
     const NetworkInput& NetworkInputHistory::Front() const
     {
-        return m_history.front().m_networkInput;
+        return m_history[m_head].m_networkInput;
+    }
+
+    AZStd::size_t NetworkInputHistory::GetRingIndex(AZStd::size_t index) const
+    {
+        return (m_head + index) % m_history.size();
     }
 }
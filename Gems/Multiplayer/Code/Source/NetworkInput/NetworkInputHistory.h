@@ -9,17 +9,22 @@
 #pragma once
 
 #include <Multiplayer/NetworkInput/NetworkInput.h>
-#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace Multiplayer
 {
     //! @class NetworkInputHistory
     //! @brief A list of input commands, used for bookkeeping on the client.
+    //! Inputs are stored in a ring that is reused as it wraps, so steady state input recording does not allocate.
     class NetworkInputHistory final
     {
     public:
         AZStd::size_t Size() const;
 
+        //! Grows the history so that it can hold the provided number of inputs without allocating.
+        //! @param capacity the number of inputs to reserve space for
+        void Reserve(AZStd::size_t capacity);
+
         const NetworkInput& operator[](AZStd::size_t index) const;
         NetworkInput& operator[](AZStd::size_t index);
 
@@ -36,6 +41,12 @@ namespace Multiplayer
             NetworkInput m_networkInput;
         };
 
-        AZStd::deque<Wrapper> m_history;
+        AZStd::size_t GetRingIndex(AZStd::size_t index) const;
+
+        // Ring of inputs, Front() is stored at m_history[m_head]
+        // Popped entries are kept so their component inputs are reused by later pushes
+        AZStd::vector<Wrapper> m_history;
+        AZStd::size_t m_head = 0;
+        AZStd::size_t m_size = 0;
     };
 }
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Physics/PhysicsHistory.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+#include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(uint32_t, sv_PhysicsHistoryFrames, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of host frames of networked rigid body poses to keep for lag compensated scene queries");
+
+    PhysicsHistory::PhysicsHistory()
+        : m_sceneAddedHandler([this](AzPhysics::SceneHandle sceneHandle) { BindScene(sceneHandle); })
+        , m_sceneRemovedHandler([this](AzPhysics::SceneHandle sceneHandle)
+        {
+            if (sceneHandle == m_sceneHandle)
+            {
+                UnbindScene();
+            }
+        })
+        , m_bodyAddedHandler([this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+        {
+            OnBodyAdded(sceneHandle, bodyHandle);
+        })
+        , m_bodyRemovedHandler([this](AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+        {
+            OnBodyRemoved(sceneHandle, bodyHandle);
+        })
+    {
+        AZ::Interface<IPhysicsHistory>::Register(this);
+    }
+
+    PhysicsHistory::~PhysicsHistory()
+    {
+        Deactivate();
+        AZ::Interface<IPhysicsHistory>::Unregister(this);
+    }
+
+    void PhysicsHistory::Activate()
+    {
+        if (auto* systemInterface = AZ::Interface<AzPhysics::SystemInterface>::Get())
+        {
+            systemInterface->RegisterSceneAddedEvent(m_sceneAddedHandler);
+            systemInterface->RegisterSceneRemovedEvent(m_sceneRemovedHandler);
+        }
+
+        if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            BindScene(sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName));
+        }
+    }
+
+    void PhysicsHistory::Deactivate()
+    {
+        m_sceneAddedHandler.Disconnect();
+        m_sceneRemovedHandler.Disconnect();
+        UnbindScene();
+    }
+
+    void PhysicsHistory::RecordFrame(HostFrameId frameId)
+    {
+        const uint32_t historyFrames = AZStd::max<uint32_t>(sv_PhysicsHistoryFrames, 1);
+        if (m_frames.size() != historyFrames)
+        {
+            m_frames.clear();
+            m_frames.resize(historyFrames);
+        }
+
+        HistoryFrame& frame = m_frames[static_cast<uint32_t>(frameId) % historyFrames];
+        frame.m_frameId = frameId;
+        frame.m_poses.clear();
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (sceneInterface == nullptr || m_sceneHandle == AzPhysics::InvalidSceneHandle)
+        {
+            return;
+        }
+
+        // The frame's pose vector is reused as the ring wraps, so steady state recording does not allocate
+        frame.m_poses.reserve(m_trackedBodies.size());
+        for (const AzPhysics::SimulatedBodyHandle& bodyHandle : m_trackedBodies)
+        {
+            const AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(m_sceneHandle, bodyHandle);
+            if (body != nullptr && body->m_simulating)
+            {
+                frame.m_poses.push_back(BodyPose{ bodyHandle, body->GetTransform(), body->GetAabb() });
+            }
+        }
+    }
+
+    const IPhysicsHistory::BodyPoses* PhysicsHistory::GetFramePoses(HostFrameId frameId) const
+    {
+        if (m_frames.empty() || frameId == InvalidHostFrameId)
+        {
+            return nullptr;
+        }
+
+        const HistoryFrame& frame = m_frames[static_cast<uint32_t>(frameId) % m_frames.size()];
+        return (frame.m_frameId == frameId) ? &frame.m_poses : nullptr;
+    }
+
+    bool PhysicsHistory::IsTrackedBody(AzPhysics::SimulatedBodyHandle bodyHandle) const
+    {
+        return m_trackedBodies.find(bodyHandle) != m_trackedBodies.end();
+    }
+
+    void PhysicsHistory::ClearHistory()
+    {
+        for (HistoryFrame& frame : m_frames)
+        {
+            frame.m_frameId = InvalidHostFrameId;
+            frame.m_poses.clear();
+        }
+    }
+
+    void PhysicsHistory::BindScene(AzPhysics::SceneHandle sceneHandle)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if (sceneInterface == nullptr || sceneHandle == AzPhysics::InvalidSceneHandle || sceneHandle == m_sceneHandle
+         || sceneHandle != sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName))
+        {
+            return;
+        }
+
+        UnbindScene();
+        m_sceneHandle = sceneHandle;
+        sceneInterface->RegisterSimulationBodyAddedHandler(m_sceneHandle, m_bodyAddedHandler);
+        sceneInterface->RegisterSimulationBodyRemovedHandler(m_sceneHandle, m_bodyRemovedHandler);
+
+        // Bodies added before the scene was bound never raised OnSimulationBodyAdded, so pick them up from their entities
+        if (auto* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->EnumerateEntities([this](AZ::Entity* entity)
+            {
+                if (entity->FindComponent<NetBindComponent>() == nullptr)
+                {
+                    return;
+                }
+
+                AzPhysics::SimulatedBodyComponentRequestsBus::EnumerateHandlersId(entity->GetId(),
+                    [this](AzPhysics::SimulatedBodyComponentRequests* simulatedBody)
+                {
+                    const AzPhysics::SimulatedBody* body = simulatedBody->GetSimulatedBody();
+                    if (body != nullptr && body->m_sceneOwner == m_sceneHandle)
+                    {
+                        OnBodyAdded(m_sceneHandle, body->m_bodyHandle);
+                    }
+                    return true;
+                });
+            });
+        }
+    }
+
+    void PhysicsHistory::UnbindScene()
+    {
+        m_bodyAddedHandler.Disconnect();
+        m_bodyRemovedHandler.Disconnect();
+        m_trackedBodies.clear();
+        m_sceneHandle = AzPhysics::InvalidSceneHandle;
+        ClearHistory();
+    }
+
+    void PhysicsHistory::OnBodyAdded(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        const AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, bodyHandle);
+
+        // Static bodies never move, so they are always queried in the live scene
+        if (body == nullptr || !azrtti_istypeof<AzPhysics::RigidBody>(body))
+        {
+            return;
+        }
+
+        AZ::Entity* entity = AZ::Interface<AZ::ComponentApplicationRequests>::Get()->FindEntity(body->GetEntityId());
+        if (entity != nullptr && entity->FindComponent<NetBindComponent>() != nullptr)
+        {
+            m_trackedBodies.insert(bodyHandle);
+        }
+    }
+
+    void PhysicsHistory::OnBodyRemoved([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        // Recorded poses of a removed body are left in place, rewound queries skip handles that no longer resolve to a body
+        m_trackedBodies.erase(bodyHandle);
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/Physics/IPhysicsHistory.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzFramework/Physics/Common/PhysicsEvents.h>
+
+namespace Multiplayer
+{
+    //! Implementation of the IPhysicsHistory interface.
+    //! Tracks the rigid bodies of entities with a NetBindComponent in the default physics scene.
+    class PhysicsHistory
+        : public IPhysicsHistory
+    {
+    public:
+        PhysicsHistory();
+        virtual ~PhysicsHistory();
+
+        //! Starts tracking rigid bodies, binding to the default physics scene as soon as it exists.
+        void Activate();
+
+        //! Stops tracking rigid bodies and discards all recorded frames.
+        void Deactivate();
+
+        //! IPhysicsHistory overrides.
+        //! @{
+        void RecordFrame(HostFrameId frameId) override;
+        const BodyPoses* GetFramePoses(HostFrameId frameId) const override;
+        bool IsTrackedBody(AzPhysics::SimulatedBodyHandle bodyHandle) const override;
+        void ClearHistory() override;
+        //! @}
+
+    private:
+
+        void BindScene(AzPhysics::SceneHandle sceneHandle);
+        void UnbindScene();
+        void OnBodyAdded(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+        void OnBodyRemoved(AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle);
+
+        struct HistoryFrame
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            BodyPoses m_poses;
+        };
+
+        // Ring of recorded frames, a frame is stored at m_frames[frameId % m_frames.size()]
+        AZStd::vector<HistoryFrame> m_frames;
+        AZStd::unordered_set<AzPhysics::SimulatedBodyHandle> m_trackedBodies;
+
+        AzPhysics::SceneHandle m_sceneHandle = AzPhysics::InvalidSceneHandle;
+        AzPhysics::SystemEvents::OnSceneAddedEvent::Handler m_sceneAddedHandler;
+        AzPhysics::SystemEvents::OnSceneRemovedEvent::Handler m_sceneRemovedHandler;
+        AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler m_bodyAddedHandler;
+        AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler m_bodyRemovedHandler;
+    };
+}
@@ -9,12 +9,250 @@
 #include <Include/Multiplayer/Physics/PhysicsUtils.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Shape.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 #include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Multiplayer/Physics/IPhysicsHistory.h>
 
 namespace
 {
+    // Wraps the request's filter so that only bodies accepted by bodyFilter are considered, returning the default hit type otherwise
+    template<typename RequestT, typename BodyFilterT>
+    RequestT FilterRequest(const RequestT& request, BodyFilterT&& bodyFilter)
+    {
+        RequestT filteredRequest = request;
+        filteredRequest.m_filterCallback = [&request, bodyFilter = AZStd::move(bodyFilter)](
+                                               const AzPhysics::SimulatedBody* body, const ::Physics::Shape* shape)
+        {
+            if (bodyFilter(body))
+            {
+                if (request.m_filterCallback)
+                {
+                    return request.m_filterCallback(body, shape);
+                }
+
+                // Overlap filter callbacks return true/false rather than Touch/Block/None
+                if constexpr (AZStd::is_same_v<RequestT, AzPhysics::OverlapRequest>)
+                {
+                    return true;
+                }
+                else
+                {
+                    return AzPhysics::SceneQuery::QueryHitType::Touch;
+                }
+            }
+
+            if constexpr (AZStd::is_same_v<RequestT, AzPhysics::OverlapRequest>)
+            {
+                return false;
+            }
+            else
+            {
+                return AzPhysics::SceneQuery::QueryHitType::None;
+            }
+        };
+        return filteredRequest;
+    }
+
+    // Calls func(body, shape, pose) for each query enabled shape of each rigid body recorded in the provided frame
+    template<typename FuncT>
+    void VisitRecordedShapes(
+        AzPhysics::SceneInterface* sceneInterface,
+        AzPhysics::SceneHandle sceneHandle,
+        const AzPhysics::SceneQueryRequest& request,
+        const Multiplayer::IPhysicsHistory::BodyPoses& poses,
+        FuncT&& func)
+    {
+        // Recorded bodies are all dynamic or kinematic
+        if (request.m_queryType == AzPhysics::SceneQuery::QueryType::Static)
+        {
+            return;
+        }
+
+        for (const Multiplayer::IPhysicsHistory::BodyPose& pose : poses)
+        {
+            auto* rigidBody = azrtti_cast<AzPhysics::RigidBody*>(sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, pose.m_bodyHandle));
+            if (rigidBody == nullptr)
+            {
+                continue;
+            }
+
+            const AZ::u32 shapeCount = rigidBody->GetShapeCount();
+            for (AZ::u32 shapeIndex = 0; shapeIndex < shapeCount; ++shapeIndex)
+            {
+                AZStd::shared_ptr<::Physics::Shape> shape = rigidBody->GetShape(shapeIndex);
+                if (shape && request.m_collisionGroup.IsSet(shape->GetCollisionLayer()))
+                {
+                    func(rigidBody, *shape, pose);
+                }
+            }
+        }
+    }
+
+    // Returns the world space bounds of the overlap request's shape, or a null aabb if the shape type has no cheap bounds
+    AZ::Aabb GetOverlapBounds(const AzPhysics::OverlapRequest& request)
+    {
+        const ::Physics::ShapeConfiguration* shapeConfiguration = request.m_shapeConfiguration.get();
+        if (shapeConfiguration == nullptr)
+        {
+            return AZ::Aabb::CreateNull();
+        }
+
+        AZ::Vector3 halfExtents;
+        switch (shapeConfiguration->GetShapeType())
+        {
+        case ::Physics::ShapeType::Sphere:
+            halfExtents = AZ::Vector3(static_cast<const ::Physics::SphereShapeConfiguration*>(shapeConfiguration)->m_radius);
+            break;
+        case ::Physics::ShapeType::Box:
+            halfExtents = 0.5f * static_cast<const ::Physics::BoxShapeConfiguration*>(shapeConfiguration)->m_dimensions;
+            break;
+        case ::Physics::ShapeType::Capsule:
+        {
+            const auto* capsule = static_cast<const ::Physics::CapsuleShapeConfiguration*>(shapeConfiguration);
+            halfExtents = AZ::Vector3(capsule->m_radius, capsule->m_radius, 0.5f * capsule->m_height);
+            break;
+        }
+        default:
+            return AZ::Aabb::CreateNull();
+        }
+
+        return AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), halfExtents * shapeConfiguration->m_scale)
+            .GetTransformedAabb(request.m_pose);
+    }
+
+    // Ray cast against the live scene for untracked bodies and against the recorded poses for tracked bodies
+    AzPhysics::SceneQueryHits RayCastRecordedFrame(
+        AzPhysics::SceneInterface* sceneInterface,
+        AzPhysics::SceneHandle sceneHandle,
+        const AzPhysics::RayCastRequest& request,
+        const Multiplayer::IPhysicsHistory& history,
+        const Multiplayer::IPhysicsHistory::BodyPoses& poses)
+    {
+        const AzPhysics::RayCastRequest liveRequest = FilterRequest(request, [&history](const AzPhysics::SimulatedBody* body)
+        {
+            return !history.IsTrackedBody(body->m_bodyHandle);
+        });
+        AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(sceneHandle, &liveRequest);
+
+        // Hits don't report their hit type, so live blocking hits are found by asking the request's filter again.
+        // Without a filter every hit of a multiple hit query is a touch.
+        float blockingDistance = AZStd::numeric_limits<float>::max();
+        if (request.m_reportMultipleHits && request.m_filterCallback)
+        {
+            for (const AzPhysics::SceneQueryHit& hit : result.m_hits)
+            {
+                const AzPhysics::SimulatedBody* body = sceneInterface->GetSimulatedBodyFromHandle(sceneHandle, hit.m_bodyHandle);
+                if (body != nullptr && hit.m_shape != nullptr
+                 && request.m_filterCallback(body, hit.m_shape) == AzPhysics::SceneQuery::QueryHitType::Block)
+                {
+                    blockingDistance = AZStd::min(blockingDistance, hit.m_distance);
+                }
+            }
+        }
+
+        const AZ::Vector3 rayEnd = request.m_start + request.m_direction * request.m_distance;
+        VisitRecordedShapes(sceneInterface, sceneHandle, request, poses,
+            [&](AzPhysics::RigidBody* body, ::Physics::Shape& shape, const Multiplayer::IPhysicsHistory::BodyPose& pose)
+        {
+            if (!AZ::Intersect::TestSegmentAABB(request.m_start, rayEnd, pose.m_aabb))
+            {
+                return;
+            }
+
+            const AzPhysics::SceneQuery::QueryHitType hitType = request.m_filterCallback
+                ? request.m_filterCallback(body, &shape)
+                : AzPhysics::SceneQuery::QueryHitType::Touch;
+            if (hitType == AzPhysics::SceneQuery::QueryHitType::None)
+            {
+                return;
+            }
+
+            AzPhysics::SceneQueryHit hit = shape.RayCast(request, pose.m_transform);
+            if (hit)
+            {
+                if (hitType == AzPhysics::SceneQuery::QueryHitType::Block)
+                {
+                    blockingDistance = AZStd::min(blockingDistance, hit.m_distance);
+                }
+                result.m_hits.push_back(hit);
+            }
+        });
+
+        // Single hit queries return the closest hit, regardless of whether it came from the live scene or the recorded frame
+        if (!request.m_reportMultipleHits)
+        {
+            if (result.m_hits.size() > 1)
+            {
+                size_t closestIndex = 0;
+                for (size_t hitIndex = 1; hitIndex < result.m_hits.size(); ++hitIndex)
+                {
+                    if (result.m_hits[hitIndex].m_distance < result.m_hits[closestIndex].m_distance)
+                    {
+                        closestIndex = hitIndex;
+                    }
+                }
+                AzPhysics::SceneQueryHit closestHit = result.m_hits[closestIndex];
+                result.m_hits.clear();
+                result.m_hits.push_back(closestHit);
+            }
+            return result;
+        }
+
+        // The nearest blocking hit, from either the live scene or the recorded frame, hides everything behind it
+        result.m_hits.erase(AZStd::remove_if(result.m_hits.begin(), result.m_hits.end(),
+            [blockingDistance](const AzPhysics::SceneQueryHit& hit) { return hit.m_distance > blockingDistance; }), result.m_hits.end());
+        AZStd::sort(result.m_hits.begin(), result.m_hits.end(),
+            [](const AzPhysics::SceneQueryHit& lhs, const AzPhysics::SceneQueryHit& rhs) { return lhs.m_distance < rhs.m_distance; });
+        if (result.m_hits.size() > request.m_maxResults)
+        {
+            result.m_hits.resize(request.m_maxResults);
+        }
+        return result;
+    }
+
+    // Overlap against the live scene for untracked bodies and against the shapes at their recorded pose for tracked bodies
+    AzPhysics::SceneQueryHits OverlapRecordedFrame(
+        AzPhysics::SceneInterface* sceneInterface,
+        AzPhysics::SceneHandle sceneHandle,
+        const AzPhysics::OverlapRequest& request,
+        const AZ::Aabb& overlapBounds,
+        const Multiplayer::IPhysicsHistory& history,
+        const Multiplayer::IPhysicsHistory::BodyPoses& poses)
+    {
+        const AzPhysics::OverlapRequest liveRequest = FilterRequest(request, [&history](const AzPhysics::SimulatedBody* body)
+        {
+            return !history.IsTrackedBody(body->m_bodyHandle);
+        });
+        AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(sceneHandle, &liveRequest);
+
+        VisitRecordedShapes(sceneInterface, sceneHandle, request, poses,
+            [&](AzPhysics::RigidBody* body, ::Physics::Shape& shape, const Multiplayer::IPhysicsHistory::BodyPose& pose)
+        {
+            // The recorded bounds only reject bodies early, hits are decided by the exact shape test at the recorded pose
+            if (result.m_hits.size() >= request.m_maxResults
+             || (overlapBounds.IsValid() && !pose.m_aabb.Overlaps(overlapBounds))
+             || (request.m_filterCallback && !request.m_filterCallback(body, &shape))
+             || !shape.Overlap(request, pose.m_transform))
+            {
+                return;
+            }
+
+            AzPhysics::SceneQueryHit hit;
+            hit.m_resultFlags = AzPhysics::SceneQuery::ResultFlags::BodyHandle | AzPhysics::SceneQuery::ResultFlags::EntityId
+                | AzPhysics::SceneQuery::ResultFlags::Shape;
+            hit.m_bodyHandle = pose.m_bodyHandle;
+            hit.m_entityId = body->GetEntityId();
+            hit.m_shape = &shape;
+            result.m_hits.push_back(hit);
+        });
+        return result;
+    }
+
     template<typename RequestT>
     AzPhysics::SceneQueryHits SceneQueryInternal(const RequestT& request)
     {
@@ -39,38 +277,31 @@ namespace
             return result;
         }
 
-        // If the time is rewound, we want to query against rigid bodies present at the same frame ID: the same as the current rewound time is.
-        RequestT netSceneQueryRequest = request;
-        netSceneQueryRequest.m_filterCallback = [&request, currentFrameId = (uint32_t)currentNetTime->GetHostFrameId()](
-                                                 const AzPhysics::SimulatedBody* body, const ::Physics::Shape* shape)
+        // If the poses of networked rigid bodies were recorded for the rewound frame, query against those without moving any live bodies.
+        const Multiplayer::HostFrameId currentFrameId = currentNetTime->GetHostFrameId();
+        if (const Multiplayer::IPhysicsHistory* history = AZ::Interface<Multiplayer::IPhysicsHistory>::Get())
         {
-            if (body->GetFrameId() == AzPhysics::SimulatedBody::UndefinedFrameId || body->GetFrameId() == currentFrameId)
+            if (const Multiplayer::IPhysicsHistory::BodyPoses* poses = history->GetFramePoses(currentFrameId))
             {
-                if (request.m_filterCallback)
-                {
-                    return request.m_filterCallback(body, shape);
-                }
-
-                // Overlap filter callbacks return true/false rather than Touch/Block/None
-                if constexpr (AZStd::is_same_v<RequestT, AzPhysics::OverlapRequest>)
+                if constexpr (AZStd::is_same_v<RequestT, AzPhysics::RayCastRequest>)
                 {
-                    return true;
+                    return RayCastRecordedFrame(sceneInterface, sceneHandle, request, *history, *poses);
                 }
-                else
+                else if constexpr (AZStd::is_same_v<RequestT, AzPhysics::OverlapRequest>)
                 {
-                    return AzPhysics::SceneQuery::QueryHitType::Touch;
+                    if (request.m_shapeConfiguration && !request.m_unboundedOverlapHitCallback)
+                    {
+                        return OverlapRecordedFrame(sceneInterface, sceneHandle, request, GetOverlapBounds(request), *history, *poses);
+                    }
                 }
             }
+        }
 
-            if constexpr (AZStd::is_same_v<RequestT, AzPhysics::OverlapRequest>)
-            {
-                return false;
-            }
-            else
-            {
-                return AzPhysics::SceneQuery::QueryHitType::None;
-            }
-        };
+        // Otherwise query against rigid bodies present at the same frame ID: the same as the current rewound time is.
+        const RequestT netSceneQueryRequest = FilterRequest(request, [frameId = static_cast<uint32_t>(currentFrameId)](const AzPhysics::SimulatedBody* body)
+        {
+            return body->GetFrameId() == AzPhysics::SimulatedBody::UndefinedFrameId || body->GetFrameId() == frameId;
+        });
 
         // Execute the scene query modified for the time rewind.
         AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(sceneHandle, &netSceneQueryRequest);
@@ -0,0 +1,330 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/MultiplayerComponent.h>
+#include <Multiplayer/Components/MultiplayerController.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
+#include <Source/MultiplayerSystemComponent.h>
+#include <Source/NetworkInput/NetworkInputArray.h>
+#include <Source/NetworkInput/NetworkInputHistory.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Time/TimeSystemComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+
+namespace Multiplayer::Benchmarks
+{
+    namespace InputHistoryConstants
+    {
+        //! Number of predicted values modified by every replayed input, stands in for the predictable state of a player entity
+        static const uint32_t PredictedValueCount = 32;
+
+        //! Values passed to benchmark to select the input history length, 8 inputs up to 2 seconds of input at 128Hz
+        static const int StartRange = 8;
+        static const int EndRange = 256;
+        static const int RangeMultipler = 2;
+    } // namespace InputHistoryConstants
+
+    class PredictedStateComponent;
+
+    //! Controller that writes every predicted value from ProcessInput, standing in for the movement and ability controllers
+    //! a correction has to replay.
+    class PredictedStateController
+        : public MultiplayerController
+    {
+    public:
+        PredictedStateController(PredictedStateComponent& owner);
+
+        void Activate([[maybe_unused]] EntityIsMigrating entityIsMigrating) override {}
+        void Deactivate([[maybe_unused]] EntityIsMigrating entityIsMigrating) override {}
+
+        const AZStd::vector<RewindableObject<uint32_t, RewindHistorySize>>& GetPredictedValues() const
+        {
+            return m_predictedValues;
+        }
+
+    protected:
+        InputPriorityOrder GetInputOrder() const override
+        {
+            return InputPriorityOrder::Default;
+        }
+
+        bool IsPredicted() const override
+        {
+            return true;
+        }
+
+        void ProcessInput(NetworkInput& networkInput, [[maybe_unused]] float deltaTime) override
+        {
+            for (RewindableObject<uint32_t, RewindHistorySize>& predictedValue : m_predictedValues)
+            {
+                predictedValue = static_cast<uint32_t>(networkInput.GetClientInputId());
+            }
+        }
+
+        void CreateInput([[maybe_unused]] NetworkInput& networkInput, [[maybe_unused]] float deltaTime) override {}
+
+    private:
+        AZStd::vector<RewindableObject<uint32_t, RewindHistorySize>> m_predictedValues;
+    };
+
+    //! Minimal multiplayer component owning a PredictedStateController, so the benchmark replays through NetBindComponent.
+    class PredictedStateComponent
+        : public MultiplayerComponent
+    {
+    public:
+        AZ_COMPONENT(PredictedStateComponent, "{5A3E7D22-4C0B-4E56-9A51-3F1C9D8B6E47}", MultiplayerComponent);
+
+        static void Reflect([[maybe_unused]] AZ::ReflectContext* context) {}
+
+        void Init() override
+        {
+            if (m_netBindComponent->HasController())
+            {
+                ConstructController();
+            }
+        }
+
+        void Activate() override
+        {
+            ActivateController(EntityIsMigrating::False);
+        }
+
+        void Deactivate() override
+        {
+            DeactivateController(EntityIsMigrating::False);
+        }
+
+        void SetOwningConnectionId([[maybe_unused]] AzNetworking::ConnectionId connectionId) override {}
+
+        NetComponentId GetNetComponentId() const override
+        {
+            return NetComponentId{ 0 };
+        }
+
+        bool HandleRpcMessage(
+            [[maybe_unused]] AzNetworking::IConnection* invokingConnection,
+            [[maybe_unused]] NetEntityRole netEntityRole,
+            [[maybe_unused]] NetworkEntityRpcMessage& rpcMessage) override
+        {
+            return false;
+        }
+
+        bool SerializeStateDeltaMessage(
+            [[maybe_unused]] ReplicationRecord& replicationRecord, [[maybe_unused]] AzNetworking::ISerializer& serializer) override
+        {
+            return true;
+        }
+
+        void NotifyStateDeltaChanges([[maybe_unused]] ReplicationRecord& replicationRecord) override {}
+
+        bool HasController() const override
+        {
+            return m_controller != nullptr;
+        }
+
+        MultiplayerController* GetController() override
+        {
+            return m_controller.get();
+        }
+
+        const PredictedStateController* GetPredictedStateController() const
+        {
+            return m_controller.get();
+        }
+
+    protected:
+        void ConstructController() override
+        {
+            m_controller = AZStd::make_unique<PredictedStateController>(*this);
+        }
+
+        void DestructController() override
+        {
+            m_controller.reset();
+        }
+
+        void ActivateController(EntityIsMigrating entityIsMigrating) override
+        {
+            if (m_controller)
+            {
+                m_controller->Activate(entityIsMigrating);
+            }
+        }
+
+        void DeactivateController(EntityIsMigrating entityIsMigrating) override
+        {
+            if (m_controller)
+            {
+                m_controller->Deactivate(entityIsMigrating);
+            }
+        }
+
+        void NetworkAttach(
+            NetBindComponent* netBindComponent,
+            [[maybe_unused]] ReplicationRecord& currentEntityRecord,
+            [[maybe_unused]] ReplicationRecord& predictableEntityRecord) override
+        {
+            m_netBindComponent = netBindComponent;
+        }
+
+    private:
+        AZStd::unique_ptr<PredictedStateController> m_controller;
+    };
+
+    PredictedStateController::PredictedStateController(PredictedStateComponent& owner)
+        : MultiplayerController(owner)
+    {
+        m_predictedValues.reserve(InputHistoryConstants::PredictedValueCount);
+        for (uint32_t i = 0; i < InputHistoryConstants::PredictedValueCount; ++i)
+        {
+            m_predictedValues.emplace_back(0);
+        }
+    }
+
+    //! Input history fixture.
+    //! Fills a client input history of the requested length, as it would be on a client with that many inputs in flight,
+    //! and activates an autonomous entity whose NetBindComponent replays that history.
+    class NetworkInputHistoryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::NameDictionary::Create();
+            m_loggerComponent = AZStd::make_unique<AZ::LoggerSystemComponent>();
+            m_timeComponent = AZStd::make_unique<AZ::TimeSystemComponent>();
+            m_netComponent = AZStd::make_unique<AzNetworking::NetworkingSystemComponent>();
+            m_mpComponent = AZStd::make_unique<MultiplayerSystemComponent>();
+            m_mpComponent->Activate();
+
+            m_netBindDescriptor.reset(NetBindComponent::CreateDescriptor());
+            m_predictedStateDescriptor.reset(PredictedStateComponent::CreateDescriptor());
+
+            m_history = AZStd::make_unique<NetworkInputHistory>();
+            m_inputArray = AZStd::make_unique<NetworkInputArray>();
+
+            const uint32_t historyLength = static_cast<uint32_t>(state.range(0));
+            m_history->Reserve(historyLength + 1);
+            for (uint32_t i = 0; i < historyLength; ++i)
+            {
+                PushInput();
+            }
+
+            m_entity = AZStd::make_unique<AZ::Entity>();
+            m_netBindComponent = m_entity->CreateComponent<NetBindComponent>();
+            m_predictedStateComponent = m_entity->CreateComponent<PredictedStateComponent>();
+            GetNetworkEntityManager()->SetupNetEntity(m_entity.get(), PrefabEntityId(), NetEntityRole::Autonomous);
+            m_entity->Init();
+            m_entity->Activate();
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            // Removing the entity from the entity manager stops it, as required before the NetBindComponent deactivates
+            GetNetworkEntityManager()->ClearAllEntities();
+            m_entity.reset();
+            m_replayInputs = {};
+            m_inputArray.reset();
+            m_history.reset();
+            m_predictedStateDescriptor.reset();
+            m_netBindDescriptor.reset();
+            m_mpComponent->Deactivate();
+            m_mpComponent.reset();
+            m_netComponent.reset();
+            m_timeComponent.reset();
+            m_loggerComponent.reset();
+            AZ::NameDictionary::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void PushInput()
+        {
+            NetworkInput& input = (*m_inputArray)[0];
+            input.SetClientInputId(++m_clientInputId);
+            input.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
+            m_history->PushBack(input);
+            GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        AZStd::unique_ptr<AZ::LoggerSystemComponent> m_loggerComponent;
+        AZStd::unique_ptr<AZ::TimeSystemComponent> m_timeComponent;
+        AZStd::unique_ptr<AzNetworking::NetworkingSystemComponent> m_netComponent;
+        AZStd::unique_ptr<MultiplayerSystemComponent> m_mpComponent;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_netBindDescriptor;
+        AZStd::unique_ptr<AZ::ComponentDescriptor> m_predictedStateDescriptor;
+
+        AZStd::unique_ptr<AZ::Entity> m_entity;
+        NetBindComponent* m_netBindComponent = nullptr;
+        PredictedStateComponent* m_predictedStateComponent = nullptr;
+
+        AZStd::unique_ptr<NetworkInputHistory> m_history;
+        AZStd::unique_ptr<NetworkInputArray> m_inputArray;
+        AZStd::vector<NetworkInput*> m_replayInputs;
+        ClientInputId m_clientInputId = ClientInputId{ 0 };
+    };
+
+    //! BM_InputHistory_Record - Records a new input and discards the oldest, as the client does every input tick.
+    BENCHMARK_DEFINE_F(NetworkInputHistoryBenchmarkFixture, BM_InputHistory_Record)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            PushInput();
+            m_history->PopFront();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    //! BM_InputHistory_Correction - Replays the whole input history through NetBindComponent::ReprocessInputs as the client
+    //! does after a correction. Each replayed input rewinds network time to the frame the input was created on and runs
+    //! the predicted controller, which writes the predicted values.
+    BENCHMARK_DEFINE_F(NetworkInputHistoryBenchmarkFixture, BM_InputHistory_Correction)(benchmark::State& state)
+    {
+        const float deltaTime = 1.0f / 128.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_replayInputs.clear();
+            for (AZStd::size_t replayIndex = 0; replayIndex < m_history->Size(); ++replayIndex)
+            {
+                m_replayInputs.push_back(&(*m_history)[replayIndex]);
+            }
+
+            m_netBindComponent->ReprocessInputs(m_replayInputs, deltaTime, AzNetworking::InvalidConnectionId);
+            benchmark::DoNotOptimize(m_predictedStateComponent->GetPredictedStateController()->GetPredictedValues().data());
+        }
+        state.SetItemsProcessed(state.iterations() * m_history->Size());
+    }
+
+    BENCHMARK_REGISTER_F(NetworkInputHistoryBenchmarkFixture, BM_InputHistory_Record)
+        ->ArgName("HistoryLength")
+        ->RangeMultiplier(InputHistoryConstants::RangeMultipler)
+        ->Range(InputHistoryConstants::StartRange, InputHistoryConstants::EndRange)
+        ;
+
+    BENCHMARK_REGISTER_F(NetworkInputHistoryBenchmarkFixture, BM_InputHistory_Correction)
+        ->ArgName("HistoryLength")
+        ->RangeMultiplier(InputHistoryConstants::RangeMultipler)
+        ->Range(InputHistoryConstants::StartRange, InputHistoryConstants::EndRange)
+        ->Unit(benchmark::kMicrosecond)
+        ;
+} // namespace Multiplayer::Benchmarks
+#endif //HAVE_BENCHMARK
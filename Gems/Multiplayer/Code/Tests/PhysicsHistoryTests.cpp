@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <PhysicsSceneMock.h>
+#include <Source/Physics/PhysicsHistory.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Physics/PhysicsUtils.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class PhysicsHistoryTests
+        : public AllocatorsFixture
+    {
+    };
+
+    // Matches the default value of sv_PhysicsHistoryFrames
+    static constexpr uint32_t PhysicsHistoryFrames = 32;
+
+    TEST_F(PhysicsHistoryTests, RegistersInterface)
+    {
+        {
+            Multiplayer::PhysicsHistory history;
+            EXPECT_EQ(AZ::Interface<Multiplayer::IPhysicsHistory>::Get(), &history);
+        }
+        EXPECT_EQ(AZ::Interface<Multiplayer::IPhysicsHistory>::Get(), nullptr);
+    }
+
+    TEST_F(PhysicsHistoryTests, RecordedFramesAreRetained)
+    {
+        Multiplayer::PhysicsHistory history;
+        EXPECT_EQ(history.GetFramePoses(Multiplayer::HostFrameId{ 0 }), nullptr);
+
+        for (uint32_t frame = 0; frame < PhysicsHistoryFrames; ++frame)
+        {
+            history.RecordFrame(Multiplayer::HostFrameId{ frame });
+        }
+
+        for (uint32_t frame = 0; frame < PhysicsHistoryFrames; ++frame)
+        {
+            const Multiplayer::IPhysicsHistory::BodyPoses* poses = history.GetFramePoses(Multiplayer::HostFrameId{ frame });
+            ASSERT_NE(poses, nullptr);
+            EXPECT_TRUE(poses->empty());
+        }
+        EXPECT_EQ(history.GetFramePoses(Multiplayer::HostFrameId{ PhysicsHistoryFrames }), nullptr);
+        EXPECT_EQ(history.GetFramePoses(Multiplayer::InvalidHostFrameId), nullptr);
+    }
+
+    TEST_F(PhysicsHistoryTests, OldFramesAreOverwritten)
+    {
+        Multiplayer::PhysicsHistory history;
+        for (uint32_t frame = 0; frame < PhysicsHistoryFrames + 8; ++frame)
+        {
+            history.RecordFrame(Multiplayer::HostFrameId{ frame });
+        }
+
+        for (uint32_t frame = 0; frame < 8; ++frame)
+        {
+            EXPECT_EQ(history.GetFramePoses(Multiplayer::HostFrameId{ frame }), nullptr);
+        }
+        for (uint32_t frame = 8; frame < PhysicsHistoryFrames + 8; ++frame)
+        {
+            EXPECT_NE(history.GetFramePoses(Multiplayer::HostFrameId{ frame }), nullptr);
+        }
+
+        history.ClearHistory();
+        EXPECT_EQ(history.GetFramePoses(Multiplayer::HostFrameId{ PhysicsHistoryFrames }), nullptr);
+    }
+
+    class PhysicsHistoryQueryTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+            m_networkTime = AZStd::make_unique<Multiplayer::NetworkTime>();
+            m_scene = AZStd::make_unique<PhysicsSceneMock>();
+            m_history = AZStd::make_unique<PhysicsHistoryMock>(RecordedFrameId);
+
+            // The body is live at the origin, but was at RecordedPosition on the recorded frame
+            m_body = AZStd::make_unique<RigidBodyMock>(BodyHandle, AZ::Transform::CreateIdentity(), AZStd::make_shared<SphereShapeMock>(BodyRadius));
+            m_scene->AddBody(*m_body);
+            const AZ::Transform recordedTransform = AZ::Transform::CreateTranslation(RecordedPosition);
+            m_history->AddPose({ BodyHandle, recordedTransform, m_body->GetShape(0)->GetAabb(recordedTransform) });
+        }
+
+        void TearDown() override
+        {
+            m_body.reset();
+            m_history.reset();
+            m_scene.reset();
+            m_networkTime.reset();
+            TeardownAllocator();
+        }
+
+    protected:
+        static constexpr Multiplayer::HostFrameId RecordedFrameId = Multiplayer::HostFrameId{ 5 };
+        static constexpr AzPhysics::SimulatedBodyHandle BodyHandle = { AZ::Crc32(), 1 };
+        static constexpr float BodyRadius = 1.0f;
+        static inline const AZ::Vector3 RecordedPosition = AZ::Vector3(10.0f, 0.0f, 0.0f);
+
+        // Rewinds network time to the recorded frame, as the server does while processing a client's input
+        Multiplayer::ScopedAlterTime RewindToRecordedFrame()
+        {
+            return Multiplayer::ScopedAlterTime(RecordedFrameId, AZ::TimeMs{ 0 }, Multiplayer::DefaultBlendFactor, AzNetworking::ConnectionId{ 1 });
+        }
+
+        AZStd::unique_ptr<Multiplayer::NetworkTime> m_networkTime;
+        AZStd::unique_ptr<PhysicsSceneMock> m_scene;
+        AZStd::unique_ptr<PhysicsHistoryMock> m_history;
+        AZStd::unique_ptr<RigidBodyMock> m_body;
+    };
+
+    TEST_F(PhysicsHistoryQueryTests, RewoundRayCast_HitsBodyAtRecordedPose)
+    {
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3(10.0f, -5.0f, 0.0f);
+        request.m_direction = AZ::Vector3::CreateAxisY();
+        request.m_distance = 10.0f;
+
+        // Outside of a rewind the live scene is queried, which has nothing at the recorded position
+        EXPECT_TRUE(Multiplayer::Physics::RayCast(request).m_hits.empty());
+
+        auto scopedTime = RewindToRecordedFrame();
+        AzPhysics::SceneQueryHits result = Multiplayer::Physics::RayCast(request);
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_NEAR(result.m_hits[0].m_distance, 4.0f, 0.001f);
+    }
+
+    TEST_F(PhysicsHistoryQueryTests, RewoundRayCast_IgnoresBodyAtLivePose)
+    {
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3(0.0f, -5.0f, 0.0f);
+        request.m_direction = AZ::Vector3::CreateAxisY();
+        request.m_distance = 10.0f;
+
+        auto scopedTime = RewindToRecordedFrame();
+        EXPECT_TRUE(Multiplayer::Physics::RayCast(request).m_hits.empty());
+    }
+
+    TEST_F(PhysicsHistoryQueryTests, RewoundOverlap_HitsBodyAtRecordedPose)
+    {
+        const AzPhysics::OverlapRequest request = AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(
+            0.5f, AZ::Transform::CreateTranslation(RecordedPosition + AZ::Vector3(1.2f, 0.0f, 0.0f)));
+
+        auto scopedTime = RewindToRecordedFrame();
+        AzPhysics::SceneQueryHits result = Multiplayer::Physics::Overlap(request);
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_EQ(result.m_hits[0].m_bodyHandle, BodyHandle);
+    }
+
+    TEST_F(PhysicsHistoryQueryTests, RewoundOverlap_NearMissInsideRecordedBounds_ReportsNoHit)
+    {
+        // Diagonally off the recorded sphere: the bounds of both spheres overlap, the spheres themselves do not
+        const AZ::Vector3 overlapPosition = RecordedPosition + AZ::Vector3(1.2f, 1.2f, 0.0f);
+        const AzPhysics::OverlapRequest request =
+            AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(0.5f, AZ::Transform::CreateTranslation(overlapPosition));
+        ASSERT_TRUE(m_history->GetFramePoses(RecordedFrameId)->front().m_aabb.Overlaps(AZ::Aabb::CreateCenterRadius(overlapPosition, 0.5f)));
+
+        auto scopedTime = RewindToRecordedFrame();
+        EXPECT_TRUE(Multiplayer::Physics::Overlap(request).m_hits.empty());
+    }
+
+    class PhysicsHistoryMultipleHitTests
+        : public PhysicsHistoryQueryTests
+    {
+    public:
+        void SetUp() override
+        {
+            PhysicsHistoryQueryTests::SetUp();
+
+            // An untracked body, only ever hit through the live scene
+            m_liveBody = AZStd::make_unique<RigidBodyMock>(LiveBodyHandle, AZ::Transform::CreateIdentity(), AZStd::make_shared<SphereShapeMock>(BodyRadius));
+            m_scene->AddBody(*m_liveBody);
+        }
+
+        void TearDown() override
+        {
+            m_liveBody.reset();
+            PhysicsHistoryQueryTests::TearDown();
+        }
+
+    protected:
+        static constexpr AzPhysics::SimulatedBodyHandle LiveBodyHandle = { AZ::Crc32(), 2 };
+
+        // Casts through the recorded pose of the tracked body, which is hit 4 units along the ray
+        static AzPhysics::RayCastRequest CreateMultipleHitRequest(AzPhysics::SimulatedBodyHandle blockingBodyHandle)
+        {
+            AzPhysics::RayCastRequest request;
+            request.m_start = AZ::Vector3(10.0f, -5.0f, 0.0f);
+            request.m_direction = AZ::Vector3::CreateAxisY();
+            request.m_distance = 10.0f;
+            request.m_reportMultipleHits = true;
+            request.m_filterCallback = [blockingBodyHandle](const AzPhysics::SimulatedBody* body, [[maybe_unused]] const Physics::Shape* shape)
+            {
+                return (body->m_bodyHandle == blockingBodyHandle) ? AzPhysics::SceneQuery::QueryHitType::Block : AzPhysics::SceneQuery::QueryHitType::Touch;
+            };
+            return request;
+        }
+
+        void SetLiveHit(float distance)
+        {
+            AzPhysics::SceneQueryHit hit;
+            hit.m_resultFlags = AzPhysics::SceneQuery::ResultFlags::Distance | AzPhysics::SceneQuery::ResultFlags::BodyHandle | AzPhysics::SceneQuery::ResultFlags::Shape;
+            hit.m_distance = distance;
+            hit.m_bodyHandle = LiveBodyHandle;
+            hit.m_shape = m_liveBody->GetShape(0).get();
+
+            AzPhysics::SceneQueryHits hits;
+            hits.m_hits.push_back(hit);
+            m_scene->SetLiveHits(hits);
+        }
+
+        AZStd::unique_ptr<RigidBodyMock> m_liveBody;
+    };
+
+    TEST_F(PhysicsHistoryMultipleHitTests, RewoundRayCast_LiveBlockingHitHidesRecordedHits)
+    {
+        SetLiveHit(2.0f);
+
+        auto scopedTime = RewindToRecordedFrame();
+        AzPhysics::SceneQueryHits result = Multiplayer::Physics::RayCast(CreateMultipleHitRequest(LiveBodyHandle));
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_EQ(result.m_hits[0].m_bodyHandle, LiveBodyHandle);
+    }
+
+    TEST_F(PhysicsHistoryMultipleHitTests, RewoundRayCast_RecordedBlockingHitHidesLiveHits)
+    {
+        SetLiveHit(6.0f);
+
+        auto scopedTime = RewindToRecordedFrame();
+        AzPhysics::SceneQueryHits result = Multiplayer::Physics::RayCast(CreateMultipleHitRequest(BodyHandle));
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_NEAR(result.m_hits[0].m_distance, 4.0f, 0.001f);
+    }
+
+    TEST_F(PhysicsHistoryMultipleHitTests, RewoundRayCast_TouchingHitsFromBothSourcesAreSorted)
+    {
+        SetLiveHit(6.0f);
+
+        auto scopedTime = RewindToRecordedFrame();
+        AzPhysics::SceneQueryHits result = Multiplayer::Physics::RayCast(CreateMultipleHitRequest(AzPhysics::InvalidSimulatedBodyHandle));
+        ASSERT_EQ(result.m_hits.size(), 2);
+        EXPECT_NEAR(result.m_hits[0].m_distance, 4.0f, 0.001f);
+        EXPECT_EQ(result.m_hits[1].m_bodyHandle, LiveBodyHandle);
+    }
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/Shape.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
+#include <Multiplayer/Physics/IPhysicsHistory.h>
+
+// The following are minimal stand-ins for a physics backend, used to test rewind aware scene queries without PhysX.
+// Bodies only ever hold spheres, which are tested exactly so that queries near a shape's bounds can be verified.
+
+namespace UnitTest
+{
+    class SphereShapeMock
+        : public Physics::Shape
+    {
+    public:
+        explicit SphereShapeMock(float radius)
+            : m_radius(radius)
+        {
+            ;
+        }
+
+        void SetMaterial([[maybe_unused]] const AZStd::shared_ptr<Physics::Material>& material) override {}
+        AZStd::shared_ptr<Physics::Material> GetMaterial() const override { return nullptr; }
+        void SetCollisionLayer([[maybe_unused]] const AzPhysics::CollisionLayer& layer) override {}
+        AzPhysics::CollisionLayer GetCollisionLayer() const override { return AzPhysics::CollisionLayer::Default; }
+        void SetCollisionGroup([[maybe_unused]] const AzPhysics::CollisionGroup& group) override {}
+        AzPhysics::CollisionGroup GetCollisionGroup() const override { return AzPhysics::CollisionGroup::All; }
+        void SetName([[maybe_unused]] const char* name) override {}
+        void SetLocalPose([[maybe_unused]] const AZ::Vector3& offset, [[maybe_unused]] const AZ::Quaternion& rotation) override {}
+        AZStd::pair<AZ::Vector3, AZ::Quaternion> GetLocalPose() const override { return { AZ::Vector3::CreateZero(), AZ::Quaternion::CreateIdentity() }; }
+        float GetRestOffset() const override { return 0.0f; }
+        float GetContactOffset() const override { return 0.0f; }
+        void SetRestOffset([[maybe_unused]] float restOffset) override {}
+        void SetContactOffset([[maybe_unused]] float contactOffset) override {}
+        void* GetNativePointer() override { return nullptr; }
+        AZ::Crc32 GetTag() const override { return AZ::Crc32(); }
+        void AttachedToActor([[maybe_unused]] void* actor) override {}
+        void DetachedFromActor() override {}
+        void GetGeometry([[maybe_unused]] AZStd::vector<AZ::Vector3>& vertices, [[maybe_unused]] AZStd::vector<AZ::u32>& indices, [[maybe_unused]] AZ::Aabb* optionalBounds) override {}
+
+        AzPhysics::SceneQueryHit RayCast(const AzPhysics::RayCastRequest& worldSpaceRequest, const AZ::Transform& worldTransform) override
+        {
+            AzPhysics::SceneQueryHit hit;
+            float distance = 0.0f;
+            if (AZ::Intersect::IntersectRaySphere(worldSpaceRequest.m_start, worldSpaceRequest.m_direction, worldTransform.GetTranslation(), m_radius, distance) > 0
+             && distance <= worldSpaceRequest.m_distance)
+            {
+                hit.m_resultFlags = AzPhysics::SceneQuery::ResultFlags::Distance | AzPhysics::SceneQuery::ResultFlags::Shape;
+                hit.m_distance = distance;
+                hit.m_shape = this;
+            }
+            return hit;
+        }
+
+        AzPhysics::SceneQueryHit RayCastLocal(const AzPhysics::RayCastRequest& localSpaceRequest) override
+        {
+            return RayCast(localSpaceRequest, AZ::Transform::CreateIdentity());
+        }
+
+        bool Overlap(const AzPhysics::OverlapRequest& worldSpaceRequest, const AZ::Transform& worldTransform) override
+        {
+            const auto* sphere = azrtti_cast<const Physics::SphereShapeConfiguration*>(worldSpaceRequest.m_shapeConfiguration.get());
+            if (sphere == nullptr)
+            {
+                return false;
+            }
+            const float radiusSum = m_radius + sphere->m_radius * sphere->m_scale.GetMaxElement();
+            return worldSpaceRequest.m_pose.GetTranslation().GetDistanceSq(worldTransform.GetTranslation()) <= radiusSum * radiusSum;
+        }
+
+        AZ::Aabb GetAabb(const AZ::Transform& worldTransform) const override
+        {
+            return AZ::Aabb::CreateCenterRadius(worldTransform.GetTranslation(), m_radius);
+        }
+
+        AZ::Aabb GetAabbLocal() const override
+        {
+            return GetAabb(AZ::Transform::CreateIdentity());
+        }
+
+    private:
+        float m_radius = 0.0f;
+    };
+
+    class RigidBodyMock
+        : public AzPhysics::RigidBody
+    {
+    public:
+        RigidBodyMock(AzPhysics::SimulatedBodyHandle bodyHandle, const AZ::Transform& transform, AZStd::shared_ptr<Physics::Shape> shape)
+            : m_transform(transform)
+            , m_shape(AZStd::move(shape))
+        {
+            m_bodyHandle = bodyHandle;
+            m_simulating = true;
+        }
+
+        AZ::u32 GetShapeCount() override { return 1; }
+        AZStd::shared_ptr<Physics::Shape> GetShape([[maybe_unused]] AZ::u32 index) override { return m_shape; }
+
+        AZ::EntityId GetEntityId() const override { return AZ::EntityId(); }
+        AZ::Transform GetTransform() const override { return m_transform; }
+        void SetTransform(const AZ::Transform& transform) override { m_transform = transform; }
+        AZ::Vector3 GetPosition() const override { return m_transform.GetTranslation(); }
+        AZ::Quaternion GetOrientation() const override { return m_transform.GetRotation(); }
+        AZ::Aabb GetAabb() const override { return m_shape->GetAabb(m_transform); }
+        AzPhysics::SceneQueryHit RayCast(const AzPhysics::RayCastRequest& request) override { return m_shape->RayCast(request, m_transform); }
+        AZ::Crc32 GetNativeType() const override { return AZ::Crc32(); }
+        void* GetNativePointer() const override { return nullptr; }
+
+        void AddShape([[maybe_unused]] AZStd::shared_ptr<Physics::Shape> shape) override {}
+        void RemoveShape([[maybe_unused]] AZStd::shared_ptr<Physics::Shape> shape) override {}
+        AZ::Vector3 GetCenterOfMassWorld() const override { return m_transform.GetTranslation(); }
+        AZ::Vector3 GetCenterOfMassLocal() const override { return AZ::Vector3::CreateZero(); }
+        AZ::Matrix3x3 GetInverseInertiaWorld() const override { return AZ::Matrix3x3::CreateIdentity(); }
+        AZ::Matrix3x3 GetInverseInertiaLocal() const override { return AZ::Matrix3x3::CreateIdentity(); }
+        float GetMass() const override { return 1.0f; }
+        float GetInverseMass() const override { return 1.0f; }
+        void SetMass([[maybe_unused]] float mass) override {}
+        void SetCenterOfMassOffset([[maybe_unused]] const AZ::Vector3& comOffset) override {}
+        AZ::Vector3 GetLinearVelocity() const override { return AZ::Vector3::CreateZero(); }
+        void SetLinearVelocity([[maybe_unused]] const AZ::Vector3& velocity) override {}
+        AZ::Vector3 GetAngularVelocity() const override { return AZ::Vector3::CreateZero(); }
+        void SetAngularVelocity([[maybe_unused]] const AZ::Vector3& angularVelocity) override {}
+        AZ::Vector3 GetLinearVelocityAtWorldPoint([[maybe_unused]] const AZ::Vector3& worldPoint) const override { return AZ::Vector3::CreateZero(); }
+        void ApplyLinearImpulse([[maybe_unused]] const AZ::Vector3& impulse) override {}
+        void ApplyLinearImpulseAtWorldPoint([[maybe_unused]] const AZ::Vector3& impulse, [[maybe_unused]] const AZ::Vector3& worldPoint) override {}
+        void ApplyAngularImpulse([[maybe_unused]] const AZ::Vector3& angularImpulse) override {}
+        float GetLinearDamping() const override { return 0.0f; }
+        void SetLinearDamping([[maybe_unused]] float damping) override {}
+        float GetAngularDamping() const override { return 0.0f; }
+        void SetAngularDamping([[maybe_unused]] float damping) override {}
+        bool IsAwake() const override { return true; }
+        void ForceAsleep() override {}
+        void ForceAwake() override {}
+        float GetSleepThreshold() const override { return 0.0f; }
+        void SetSleepThreshold([[maybe_unused]] float threshold) override {}
+        bool IsKinematic() const override { return true; }
+        void SetKinematic([[maybe_unused]] bool kinematic) override {}
+        void SetKinematicTarget([[maybe_unused]] const AZ::Transform& targetPosition) override {}
+        bool IsGravityEnabled() const override { return false; }
+        void SetGravityEnabled([[maybe_unused]] bool enabled) override {}
+        void SetSimulationEnabled([[maybe_unused]] bool enabled) override {}
+        void SetCCDEnabled([[maybe_unused]] bool enabled) override {}
+        void UpdateMassProperties(
+            [[maybe_unused]] AzPhysics::MassComputeFlags flags,
+            [[maybe_unused]] const AZ::Vector3* centerOfMassOffsetOverride,
+            [[maybe_unused]] const AZ::Matrix3x3* inertiaTensorOverride,
+            [[maybe_unused]] const float* massOverride) override {}
+
+    private:
+        AZ::Transform m_transform;
+        AZStd::shared_ptr<Physics::Shape> m_shape;
+    };
+
+    //! Default physics scene holding a fixed set of bodies. The live scene query only reports the hits set with SetLiveHits,
+    //! so any other hit a rewound query returns comes from the recorded poses.
+    class PhysicsSceneMock
+        : public AZ::Interface<AzPhysics::SceneInterface>::Registrar
+    {
+    public:
+        static constexpr AzPhysics::SceneHandle SceneHandle = { AZ::Crc32("PhysicsSceneMock"), 0 };
+
+        void AddBody(RigidBodyMock& body) { m_bodies[body.m_bodyHandle] = &body; }
+        void SetLiveHits(const AzPhysics::SceneQueryHits& hits) { m_liveHits = hits; }
+
+        AzPhysics::SceneHandle GetSceneHandle(const AZStd::string& sceneName) override
+        {
+            return (sceneName == AzPhysics::DefaultPhysicsSceneName) ? SceneHandle : AzPhysics::InvalidSceneHandle;
+        }
+
+        AzPhysics::SimulatedBody* GetSimulatedBodyFromHandle([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, AzPhysics::SimulatedBodyHandle bodyHandle) override
+        {
+            auto bodyIter = m_bodies.find(bodyHandle);
+            return (bodyIter != m_bodies.end()) ? bodyIter->second : nullptr;
+        }
+
+        AzPhysics::SceneQueryHits QueryScene([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::SceneQueryRequest* request) override { return m_liveHits; }
+
+        void StartSimulation([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float deltatime) override {}
+        void FinishSimulation([[maybe_unused]] AzPhysics::SceneHandle sceneHandle) override {}
+        void SetEnabled([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] bool enable) override {}
+        bool IsEnabled([[maybe_unused]] AzPhysics::SceneHandle sceneHandle) const override { return true; }
+        AzPhysics::SimulatedBodyHandle AddSimulatedBody([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig) override { return AzPhysics::InvalidSimulatedBodyHandle; }
+        AzPhysics::SimulatedBodyHandleList AddSimulatedBodies([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::SimulatedBodyConfigurationList& simulatedBodyConfigs) override { return {}; }
+        AzPhysics::SimulatedBodyList GetSimulatedBodiesFromHandle([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::SimulatedBodyHandleList& bodyHandles) override { return {}; }
+        void RemoveSimulatedBody([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SimulatedBodyHandle& bodyHandle) override {}
+        void RemoveSimulatedBodies([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SimulatedBodyHandleList& bodyHandles) override {}
+        void EnableSimulationOfBody([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle) override {}
+        void DisableSimulationOfBody([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SimulatedBodyHandle bodyHandle) override {}
+        AzPhysics::JointHandle AddJoint([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::JointConfiguration* jointConfig,
+            [[maybe_unused]] AzPhysics::SimulatedBodyHandle parentBody, [[maybe_unused]] AzPhysics::SimulatedBodyHandle childBody) override { return AzPhysics::InvalidJointHandle; }
+        AzPhysics::Joint* GetJointFromHandle([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::JointHandle jointHandle) override { return nullptr; }
+        void RemoveJoint([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::JointHandle jointHandle) override {}
+        AzPhysics::SceneQueryHitsList QuerySceneBatch([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests) override { return {}; }
+        bool QuerySceneAsync([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
+            [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback) override { return false; }
+        bool QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
+            [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback) override { return false; }
+        void SuppressCollisionEvents([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::SimulatedBodyHandle& bodyHandleA, [[maybe_unused]] const AzPhysics::SimulatedBodyHandle& bodyHandleB) override {}
+        void UnsuppressCollisionEvents([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AzPhysics::SimulatedBodyHandle& bodyHandleA, [[maybe_unused]] const AzPhysics::SimulatedBodyHandle& bodyHandleB) override {}
+        void SetGravity([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] const AZ::Vector3& gravity) override {}
+        AZ::Vector3 GetGravity([[maybe_unused]] AzPhysics::SceneHandle sceneHandle) const override { return AZ::Vector3::CreateZero(); }
+        void RegisterSceneConfigurationChangedEventHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSceneConfigurationChanged::Handler& handler) override {}
+        void RegisterSimulationBodyAddedHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSimulationBodyAdded::Handler& handler) override {}
+        void RegisterSimulationBodyRemovedHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSimulationBodyRemoved::Handler& handler) override {}
+        void RegisterSimulationBodySimulationEnabledHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSimulationBodySimulationEnabled::Handler& handler) override {}
+        void RegisterSimulationBodySimulationDisabledHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSimulationBodySimulationDisabled::Handler& handler) override {}
+        void RegisterSceneSimulationStartHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSceneSimulationStartHandler& handler) override {}
+        void RegisterSceneSimulationFinishHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSceneSimulationFinishHandler& handler) override {}
+        void RegisterSceneActiveSimulatedBodiesHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSceneActiveSimulatedBodiesEvent::Handler& handler) override {}
+        void RegisterSceneTransformsUpdatedHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSceneTransformsUpdatedEvent::Handler& handler) override {}
+        void RegisterSceneCollisionEventHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSceneCollisionsEvent::Handler& handler) override {}
+        void RegisterSceneTriggersEventHandler([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSceneTriggersEvent::Handler& handler) override {}
+        void RegisterSceneGravityChangedEvent([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] AzPhysics::SceneEvents::OnSceneGravityChangedEvent::Handler& handler) override {}
+
+    private:
+        AZStd::unordered_map<AzPhysics::SimulatedBodyHandle, AzPhysics::SimulatedBody*> m_bodies;
+        AzPhysics::SceneQueryHits m_liveHits;
+    };
+
+    //! Physics history holding a single recorded frame, in which every body added is tracked.
+    class PhysicsHistoryMock
+        : public AZ::Interface<Multiplayer::IPhysicsHistory>::Registrar
+    {
+    public:
+        explicit PhysicsHistoryMock(Multiplayer::HostFrameId frameId)
+            : m_frameId(frameId)
+        {
+            ;
+        }
+
+        void AddPose(const Multiplayer::IPhysicsHistory::BodyPose& pose) { m_poses.push_back(pose); }
+
+        void RecordFrame([[maybe_unused]] Multiplayer::HostFrameId frameId) override {}
+        const BodyPoses* GetFramePoses(Multiplayer::HostFrameId frameId) const override { return (frameId == m_frameId) ? &m_poses : nullptr; }
+        void ClearHistory() override { m_poses.clear(); }
+
+        bool IsTrackedBody(AzPhysics::SimulatedBodyHandle bodyHandle) const override
+        {
+            return AZStd::any_of(m_poses.begin(), m_poses.end(), [bodyHandle](const BodyPose& pose) { return pose.m_bodyHandle == bodyHandle; });
+        }
+
+    private:
+        Multiplayer::HostFrameId m_frameId;
+        BodyPoses m_poses;
+    };
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/ReplicationPriorityAccumulator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class ReplicationPriorityAccumulatorTests
+        : public AllocatorsFixture
+    {
+    public:
+        static ReplicationPriorityAccumulator::CandidateList MakeCandidates(uint32_t count)
+        {
+            ReplicationPriorityAccumulator::CandidateList candidates;
+            for (uint32_t index = 0; index < count; ++index)
+            {
+                ReplicationPriorityAccumulator::Candidate candidate;
+                candidate.m_netEntityId = static_cast<NetEntityId>(index);
+                candidates.push_back(candidate);
+            }
+            return candidates;
+        }
+    };
+
+    TEST_F(ReplicationPriorityAccumulatorTests, UnlimitedBudgetSendsEverythingByImportance)
+    {
+        ReplicationPriorityAccumulator accumulator;
+        accumulator.SetImportance(NetEntityId{ 0 }, 0.1f);
+        accumulator.SetImportance(NetEntityId{ 1 }, 1.0f);
+        accumulator.SetImportance(NetEntityId{ 2 }, 0.5f);
+
+        ReplicationPriorityAccumulator::CandidateList candidates = MakeCandidates(3);
+        accumulator.SelectCandidates(AZ::TimeMs{ 0 }, 0, candidates);
+
+        ASSERT_EQ(candidates.size(), 3);
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_EQ(candidates[1].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(candidates[2].m_netEntityId, NetEntityId{ 0 });
+    }
+
+    TEST_F(ReplicationPriorityAccumulatorTests, BudgetDefersLowPriorityEntities)
+    {
+        ReplicationPriorityAccumulator accumulator;
+        for (uint32_t index = 0; index < 4; ++index)
+        {
+            accumulator.SetImportance(static_cast<NetEntityId>(index), 1.0f + index);
+        }
+
+        ReplicationPriorityAccumulator::CandidateList candidates = MakeCandidates(4);
+        ReplicationPriorityAccumulator::CandidateList deferred;
+        accumulator.SelectCandidates(AZ::TimeMs{ 0 }, 100, candidates, &deferred);
+
+        // Unsent entities are estimated at 64 bytes, so the second candidate overspends and exhausts the budget
+        ASSERT_EQ(candidates.size(), 2);
+        EXPECT_EQ(candidates[0].m_netEntityId, NetEntityId{ 3 });
+        EXPECT_EQ(candidates[1].m_netEntityId, NetEntityId{ 2 });
+        EXPECT_EQ(deferred.size(), 2);
+
+        // Deferred entities retain their accumulated priority
+        EXPECT_FLOAT_EQ(accumulator.GetAccumulatedPriority(NetEntityId{ 0 }), 1.0f);
+        EXPECT_FLOAT_EQ(accumulator.GetAccumulatedPriority(NetEntityId{ 1 }), 2.0f);
+    }
+
+    TEST_F(ReplicationPriorityAccumulatorTests, StarvedEntitiesAreEventuallySent)
+    {
+        ReplicationPriorityAccumulator accumulator;
+        accumulator.SetImportance(NetEntityId{ 0 }, 0.01f);
+        accumulator.SetImportance(NetEntityId{ 1 }, 1.0f);
+
+        bool lowPrioritySent = false;
+        for (int64_t tick = 0; tick < 1000 && !lowPrioritySent; ++tick)
+        {
+            const AZ::TimeMs currentTimeMs = static_cast<AZ::TimeMs>(tick * 16);
+            ReplicationPriorityAccumulator::CandidateList candidates = MakeCandidates(2);
+            accumulator.SelectCandidates(currentTimeMs, 32, candidates);
+            for (const ReplicationPriorityAccumulator::Candidate& candidate : candidates)
+            {
+                accumulator.RecordSent(candidate.m_netEntityId, currentTimeMs, 32);
+                lowPrioritySent |= (candidate.m_netEntityId == NetEntityId{ 0 });
+            }
+        }
+        EXPECT_TRUE(lowPrioritySent);
+    }
+
+    TEST_F(ReplicationPriorityAccumulatorTests, AlwaysSendIgnoresBudget)
+    {
+        ReplicationPriorityAccumulator accumulator;
+        accumulator.RecordSent(NetEntityId{ 0 }, AZ::TimeMs{ 0 }, 1000);
+
+        ReplicationPriorityAccumulator::CandidateList candidates = MakeCandidates(2);
+        candidates[0].m_alwaysSend = true;
+        candidates[1].m_alwaysSend = true;
+        accumulator.SelectCandidates(AZ::TimeMs{ 1 }, 1, candidates);
+        EXPECT_EQ(candidates.size(), 2);
+    }
+}
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkTime/RewindableHistoryStore.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystemComponent.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class RewindableHistoryStoreTests
+        : public AllocatorsFixture
+    {
+    public:
+        Multiplayer::NetworkTime m_networkTime;
+        AZ::LoggerSystemComponent m_loggerComponent;
+        AZ::TimeSystemComponent m_timeComponent;
+    };
+
+    static constexpr uint32_t RewindableStoreFrames = 32;
+    using TestStore = Multiplayer::RewindableHistoryStore<uint32_t, RewindableStoreFrames>;
+    using TestStoreObject = Multiplayer::RewindableStoreObject<uint32_t, RewindableStoreFrames>;
+
+    TEST_F(RewindableHistoryStoreTests, BasicTests)
+    {
+        TestStore store;
+        TestStoreObject test(store, 0);
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            test = i;
+            EXPECT_EQ(i, test);
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(i), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            EXPECT_EQ(i, test);
+        }
+
+        for (uint32_t i = 16; i < 48; ++i)
+        {
+            test = i;
+            EXPECT_EQ(i, test);
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        for (uint32_t i = 16; i < 48; ++i)
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(i), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            EXPECT_EQ(i, test);
+        }
+    }
+
+    TEST_F(RewindableHistoryStoreTests, OverflowTests)
+    {
+        TestStore store;
+        TestStoreObject test(store, 0);
+
+        for (uint32_t i = 0; i < RewindableStoreFrames; ++i)
+        {
+            test = i;
+            EXPECT_EQ(i, test);
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        {
+            // Note that we didn't actually set any value for time RewindableStoreFrames, so we're testing fetching a value past the last time set
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(RewindableStoreFrames), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            EXPECT_EQ(RewindableStoreFrames - 1, test);
+        }
+    }
+
+    TEST_F(RewindableHistoryStoreTests, TestBackfillOnLargeTimestep)
+    {
+        TestStore store;
+        TestStoreObject test(store, 0);
+        TestStoreObject untouched(store, 7);
+        Multiplayer::ScopedAlterTime time1(static_cast<Multiplayer::HostFrameId>(0), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+        test = 1;
+
+        Multiplayer::ScopedAlterTime time2(static_cast<Multiplayer::HostFrameId>(1000), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+        test = 2;
+
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(1000 - i), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            EXPECT_EQ(2, test);
+            EXPECT_EQ(7, untouched);
+        }
+    }
+
+    TEST_F(RewindableHistoryStoreTests, FrameValuesAreIndexedBySlot)
+    {
+        // Spans several chunks of the store
+        static constexpr uint32_t ObjectCount = TestStore::SlotsPerChunk * 3 + 1;
+
+        TestStore store;
+        AZStd::vector<AZStd::unique_ptr<TestStoreObject>> objects;
+        for (uint32_t i = 0; i < ObjectCount; ++i)
+        {
+            objects.emplace_back(AZStd::make_unique<TestStoreObject>(store, 0));
+        }
+        EXPECT_EQ(store.GetSlotCount(), ObjectCount);
+
+        for (uint32_t frame = 0; frame < 8; ++frame)
+        {
+            for (uint32_t i = 0; i < ObjectCount; ++i)
+            {
+                *objects[i] = frame * 1000 + i;
+            }
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+        EXPECT_EQ(store.GetHeadTime(), Multiplayer::HostFrameId{ 7 });
+
+        AZStd::vector<uint32_t> values;
+        for (uint32_t frame = 0; frame < 8; ++frame)
+        {
+            store.GetFrameValues(static_cast<Multiplayer::HostFrameId>(frame), values);
+            ASSERT_EQ(values.size(), ObjectCount);
+            for (uint32_t i = 0; i < ObjectCount; ++i)
+            {
+                EXPECT_EQ(values[i], frame * 1000 + i);
+            }
+        }
+    }
+
+    TEST_F(RewindableHistoryStoreTests, AdvanceCarriesAllSlotsForward)
+    {
+        TestStore store;
+        TestStoreObject first(store, 1);
+        TestStoreObject second(store, 2);
+
+        store.AdvanceToTime(Multiplayer::HostFrameId{ 10 });
+        EXPECT_EQ(store.GetHeadTime(), Multiplayer::HostFrameId{ 10 });
+
+        Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(10), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+        EXPECT_EQ(1, first);
+        EXPECT_EQ(2, second);
+    }
+
+    TEST_F(RewindableHistoryStoreTests, WritesAreOrderedPerSlot)
+    {
+        TestStore store;
+        TestStoreObject first(store, 1);
+        TestStoreObject second(store, 2);
+
+        {
+            // first advances the whole store to frame 10
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(10), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            first = 10;
+        }
+
+        {
+            // second has not been written since frame 0, so a write at frame 5 is accepted and holds up to the head
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(5), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            second = 5;
+        }
+        for (uint32_t i = 0; i <= 10; ++i)
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(i), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            EXPECT_EQ((i < 5) ? 2u : 5u, second);
+            EXPECT_EQ((i < 10) ? 1u : 10u, first);
+        }
+
+        {
+            // Values older than the latest write to the slot are ignored, matching RewindableObject
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(3), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            second = 3;
+            first = 3;
+        }
+        Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(3), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+        EXPECT_EQ(2, second);
+        EXPECT_EQ(1, first);
+    }
+
+    TEST_F(RewindableHistoryStoreTests, ModifyBehindHeadCarriesToHead)
+    {
+        TestStore store;
+        TestStoreObject first(store, 1);
+        TestStoreObject second(store, 2);
+        store.AdvanceToTime(Multiplayer::HostFrameId{ 10 });
+
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(6), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            second.Modify() = 6;
+        }
+
+        // The modified value is visible from frame 6 up to the head, both before and after the store advances again
+        AZStd::vector<uint32_t> values;
+        store.GetFrameValues(Multiplayer::HostFrameId{ 8 }, values);
+        EXPECT_EQ(values[1], 6u);
+        store.AdvanceToTime(Multiplayer::HostFrameId{ 12 });
+        for (uint32_t i = 0; i <= 12; ++i)
+        {
+            store.GetFrameValues(static_cast<Multiplayer::HostFrameId>(i), values);
+            EXPECT_EQ(values[0], 1u);
+            EXPECT_EQ(values[1], (i < 6) ? 2u : 6u);
+        }
+    }
+
+    TEST_F(RewindableHistoryStoreTests, RollbackRestoresRecordedFrame)
+    {
+        TestStore store;
+        TestStoreObject test(store, 0);
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            test = i;
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        store.RollbackToTime(Multiplayer::HostFrameId{ 8 });
+        EXPECT_EQ(store.GetHeadTime(), Multiplayer::HostFrameId{ 8 });
+
+        // Frames after the rollback point are recorded again, starting from the restored values
+        store.AdvanceToTime(Multiplayer::HostFrameId{ 12 });
+        AZStd::vector<uint32_t> values;
+        for (uint32_t i = 8; i <= 12; ++i)
+        {
+            store.GetFrameValues(static_cast<Multiplayer::HostFrameId>(i), values);
+            EXPECT_EQ(values[0], 8u);
+        }
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            store.GetFrameValues(static_cast<Multiplayer::HostFrameId>(i), values);
+            EXPECT_EQ(values[0], i);
+        }
+
+        // The discarded writes no longer block writes to the restored frames
+        Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(10), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+        test = 100;
+        EXPECT_EQ(100, test);
+    }
+
+    TEST_F(RewindableHistoryStoreTests, SlotStorageIsStableAcrossAllocations)
+    {
+        TestStore store;
+        TestStoreObject test(store, 1);
+        uint32_t& value = store.ModifyValueForTime(Multiplayer::RewindableSlotId{ 0 }, Multiplayer::HostFrameId{ 0 });
+
+        AZStd::vector<AZStd::unique_ptr<TestStoreObject>> objects;
+        for (uint32_t i = 0; i < TestStore::SlotsPerChunk * 4; ++i)
+        {
+            objects.emplace_back(AZStd::make_unique<TestStoreObject>(store, i));
+        }
+
+        // Allocating more chunks leaves the existing ones in place
+        EXPECT_EQ(value, 1u);
+        value = 2;
+        EXPECT_EQ(2, test);
+    }
+
+    TEST_F(RewindableHistoryStoreTests, ConcurrentAllocationWhileAdvancing)
+    {
+        static constexpr uint32_t ThreadCount = 4;
+        static constexpr uint32_t AllocationsPerThread = 1000;
+
+        TestStore store;
+        TestStoreObject test(store, 0);
+
+        // Components holding store backed properties may be created and destroyed on asset loading threads,
+        // while the game thread keeps writing and advancing the store
+        AZStd::array<AZStd::vector<Multiplayer::RewindableSlotId>, ThreadCount> threadSlots;
+        auto runThreads = [&test](const AZStd::function<void(uint32_t)>& threadFunction, uint32_t firstFrame)
+        {
+            AZStd::vector<AZStd::thread> threads;
+            for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+            {
+                threads.emplace_back([&threadFunction, threadIndex]() { threadFunction(threadIndex); });
+            }
+            for (uint32_t frame = firstFrame; frame < firstFrame + 64; ++frame)
+            {
+                test = frame;
+                EXPECT_EQ(frame, test);
+                Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        };
+
+        runThreads([&store, &threadSlots](uint32_t threadIndex)
+        {
+            for (uint32_t i = 0; i < AllocationsPerThread; ++i)
+            {
+                threadSlots[threadIndex].push_back(store.AllocateSlot(threadIndex * AllocationsPerThread + i, Multiplayer::HostFrameId{ 0 }));
+            }
+        }, 0);
+
+        EXPECT_EQ(store.GetSlotCount(), ThreadCount * AllocationsPerThread + 1);
+        for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            for (uint32_t i = 0; i < AllocationsPerThread; ++i)
+            {
+                EXPECT_EQ(store.GetValueForTime(threadSlots[threadIndex][i], store.GetHeadTime()), threadIndex * AllocationsPerThread + i);
+            }
+        }
+
+        runThreads([&store, &threadSlots](uint32_t threadIndex)
+        {
+            for (const Multiplayer::RewindableSlotId slot : threadSlots[threadIndex])
+            {
+                store.FreeSlot(slot);
+            }
+        }, 64);
+
+        EXPECT_EQ(127, test);
+        {
+            Multiplayer::ScopedAlterTime time(static_cast<Multiplayer::HostFrameId>(32), AZ::TimeMs{ 0 }, 1.f, AzNetworking::InvalidConnectionId);
+            EXPECT_EQ(32, test);
+        }
+    }
+
+    TEST_F(RewindableHistoryStoreTests, FreedSlotsAreReused)
+    {
+        TestStore store;
+        TestStoreObject first(store, 1);
+        {
+            TestStoreObject temporary(store, 2);
+            EXPECT_EQ(store.GetSlotCount(), 2u);
+        }
+
+        TestStoreObject second(store, 3);
+        EXPECT_EQ(store.GetSlotCount(), 2u);
+        EXPECT_EQ(1, first);
+        EXPECT_EQ(3, second);
+
+        TestStoreObject copy(second);
+        EXPECT_EQ(store.GetSlotCount(), 3u);
+        copy = 4;
+        EXPECT_EQ(3, second);
+        EXPECT_EQ(4, copy);
+    }
+}
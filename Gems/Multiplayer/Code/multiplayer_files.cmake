@@ -36,8 +36,11 @@ set(FILES
     Include/Multiplayer/NetworkTime/RewindableArray.inl
     Include/Multiplayer/NetworkTime/RewindableFixedVector.h
     Include/Multiplayer/NetworkTime/RewindableFixedVector.inl
+    Include/Multiplayer/NetworkTime/RewindableHistoryStore.h
+    Include/Multiplayer/NetworkTime/RewindableHistoryStore.inl
     Include/Multiplayer/NetworkTime/RewindableObject.h
     Include/Multiplayer/NetworkTime/RewindableObject.inl
+    Include/Multiplayer/Physics/IPhysicsHistory.h
     Include/Multiplayer/Physics/PhysicsUtils.h
     Include/Multiplayer/ReplicationWindows/IReplicationWindow.h
     Source/MultiplayerSystemComponent.cpp
@@ -68,6 +71,8 @@ set(FILES
     Source/Editor/MultiplayerEditorConnection.h
     Source/EntityDomains/FullOwnershipEntityDomain.cpp
     Source/EntityDomains/FullOwnershipEntityDomain.h
+    Source/LoadTest/MultiplayerLoadTestDriver.cpp
+    Source/LoadTest/MultiplayerLoadTestDriver.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
@@ -77,6 +82,8 @@ set(FILES
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
+    Source/NetworkEntity/EntityReplication/ReplicationPriorityAccumulator.cpp
+    Source/NetworkEntity/EntityReplication/ReplicationPriorityAccumulator.h
     Source/NetworkEntity/EntityReplication/ReplicationRecord.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.cpp
     Source/NetworkEntity/NetworkEntityAuthorityTracker.h
@@ -105,6 +112,8 @@ set(FILES
     Source/Pipeline/NetBindMarkerComponent.h
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
     Source/Pipeline/NetworkSpawnableHolderComponent.h
+    Source/Physics/PhysicsHistory.cpp
+    Source/Physics/PhysicsHistory.h
     Source/Physics/PhysicsUtils.cpp
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
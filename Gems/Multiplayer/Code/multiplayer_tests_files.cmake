@@ -10,6 +10,11 @@ set(FILES
     Tests/Main.cpp
     Tests/IMultiplayerConnectionMock.h
     Tests/MultiplayerSystemTests.cpp
+    Tests/NetworkInputHistoryBenchmarks.cpp
+    Tests/PhysicsHistoryTests.cpp
+    Tests/PhysicsSceneMock.h
+    Tests/ReplicationPriorityAccumulatorTests.cpp
     Tests/RewindableContainerTests.cpp
+    Tests/RewindableHistoryStoreTests.cpp
     Tests/RewindableObjectTests.cpp
 )
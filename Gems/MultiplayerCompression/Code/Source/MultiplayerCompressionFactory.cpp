@@ -8,6 +8,7 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZstdDictionaryCompressor.h"
 
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
@@ -22,4 +23,19 @@ namespace MultiplayerCompression
     {
         return m_name;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerDictionaryCompressionFactory::Create()
+    {
+        AZStd::unique_ptr<ZstdDictionaryCompressor> compressor = AZStd::make_unique<ZstdDictionaryCompressor>();
+        if (!compressor->Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to initialize the zstd dictionary compressor, packets will be compressed without a dictionary");
+        }
+        return compressor;
+    }
+
+    AZ::Name MultiplayerDictionaryCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
 }
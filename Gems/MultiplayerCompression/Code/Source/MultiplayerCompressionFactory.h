@@ -29,4 +29,21 @@ namespace MultiplayerCompression
     private:
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
     };
+
+    //! Creates ZstdDictionaryCompressor instances, select with net_UdpCompressor=MultiplayerDictionaryCompressor
+    class MultiplayerDictionaryCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+    private:
+        const AZ::Name m_name = AZ::Name("MultiplayerDictionaryCompressor");
+    };
 }
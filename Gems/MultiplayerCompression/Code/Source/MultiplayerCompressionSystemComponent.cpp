@@ -51,10 +51,14 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+        m_multiplayerDictionaryCompressionFactory = new MultiplayerDictionaryCompressionFactory();
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerDictionaryCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerDictionaryCompressionFactory->GetFactoryName());
+        delete m_multiplayerDictionaryCompressionFactory;
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
     }
@@ -41,5 +41,6 @@ namespace MultiplayerCompression
         ////////////////////////////////////////////////////////////////////////
     private:
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        MultiplayerDictionaryCompressionFactory* m_multiplayerDictionaryCompressionFactory;
     };
 }
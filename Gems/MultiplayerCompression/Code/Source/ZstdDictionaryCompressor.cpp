@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdDictionaryCompressor.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Utils/Utils.h>
+
+// Dictionary id queries are part of the advanced API in the zstd version we ship
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+#include <zstd_errors.h>
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(AZ::CVarFixedString, net_CompressionDictionary, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Path to the zstd dictionary used by the ZstdDictionary compressor, must match on both endpoints");
+    AZ_CVAR(int32_t, net_CompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Zstd compression level used by the ZstdDictionary compressor");
+
+    ZstdDictionaryCompressor::~ZstdDictionaryCompressor()
+    {
+        ReleaseDictionary();
+        ZSTD_freeCCtx(m_compressContext);
+        ZSTD_freeDCtx(m_decompressContext);
+    }
+
+    AzNetworking::CompressorType ZstdDictionaryCompressor::GetType() const
+    {
+        static const AzNetworking::CompressorType compressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(CompressorName)));
+        return compressorType;
+    }
+
+    bool ZstdDictionaryCompressor::Init()
+    {
+        if (!CreateContexts())
+        {
+            return false;
+        }
+
+        m_compressionLevel = net_CompressionLevel;
+
+        const AZ::CVarFixedString dictionaryPath = net_CompressionDictionary;
+        if (dictionaryPath.empty())
+        {
+            return true;
+        }
+
+        AZ::IO::FixedMaxPath resolvedPath(AZStd::string_view{ dictionaryPath });
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance())
+        {
+            // Allows the dictionary to live in an aliased location such as @products@
+            fileIO->ResolvePath(resolvedPath, AZ::IO::PathView(AZStd::string_view{ dictionaryPath }));
+        }
+
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(resolvedPath.Native());
+        if (!readResult.IsSuccess())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read compression dictionary %s: %s", resolvedPath.c_str(), readResult.GetError().c_str());
+            return false;
+        }
+        return SetDictionary(readResult.GetValue());
+    }
+
+    size_t ZstdDictionaryCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdDictionaryCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdDictionaryCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!CreateContexts())
+        {
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = (m_compressDictionary != nullptr)
+            ? ZSTD_compress_usingCDict(m_compressContext, compData, compDataSize, uncompData, uncompSize, m_compressDictionary)
+            : ZSTD_compressCCtx(m_compressContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%lu B) compDataSize:(%lu B): %s", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+                ? AzNetworking::CompressorError::InsufficientBuffer
+                : AzNetworking::CompressorError::CorruptData;
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdDictionaryCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (!CreateContexts())
+        {
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        // Frames record the id of the dictionary they were compressed with, reject anything we can't decode rather than letting zstd guess
+        const uint32_t frameDictionaryId = ZSTD_getDictID_fromFrame(compData, compDataSize);
+        if (frameDictionaryId != 0 && frameDictionaryId != m_dictionaryId)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Received packet compressed with dictionary %u, local dictionary is %u", frameDictionaryId, m_dictionaryId);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        const size_t result = (m_decompressDictionary != nullptr)
+            ? ZSTD_decompress_usingDDict(m_decompressContext, uncompData, uncompDataSize, compData, compDataSize, m_decompressDictionary)
+            : ZSTD_decompressDCtx(m_decompressContext, uncompData, uncompDataSize, compData, compDataSize);
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%lu B) uncompDataSize:(%lu B): %s", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSizeOut = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    bool ZstdDictionaryCompressor::SetDictionary(const AZStd::vector<uint8_t>& dictionary)
+    {
+        ReleaseDictionary();
+        if (dictionary.empty())
+        {
+            return true;
+        }
+
+        m_compressDictionary = ZSTD_createCDict(dictionary.data(), dictionary.size(), m_compressionLevel);
+        m_decompressDictionary = ZSTD_createDDict(dictionary.data(), dictionary.size());
+        if (m_compressDictionary == nullptr || m_decompressDictionary == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to load compression dictionary of size %lu B", dictionary.size());
+            ReleaseDictionary();
+            return false;
+        }
+
+        m_dictionaryId = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+        return true;
+    }
+
+    uint32_t ZstdDictionaryCompressor::GetDictionaryId() const
+    {
+        return m_dictionaryId;
+    }
+
+    bool ZstdDictionaryCompressor::TrainDictionary(const AZStd::vector<AZStd::vector<uint8_t>>& samples, size_t dictionaryCapacity, AZStd::vector<uint8_t>& outDictionary)
+    {
+        // Zdict expects all samples concatenated into a single buffer
+        AZStd::vector<uint8_t> sampleBuffer;
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (const AZStd::vector<uint8_t>& sample : samples)
+        {
+            if (!sample.empty())
+            {
+                sampleBuffer.insert(sampleBuffer.end(), sample.begin(), sample.end());
+                sampleSizes.push_back(sample.size());
+            }
+        }
+
+        outDictionary.resize(dictionaryCapacity);
+        const size_t result = ZDICT_trainFromBuffer(outDictionary.data(), outDictionary.size(), sampleBuffer.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+        if (ZDICT_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Dictionary training failed for %lu samples: %s", sampleSizes.size(), ZDICT_getErrorName(result));
+            outDictionary.clear();
+            return false;
+        }
+
+        outDictionary.resize(result);
+        return true;
+    }
+
+    bool ZstdDictionaryCompressor::CreateContexts()
+    {
+        if (m_compressContext == nullptr)
+        {
+            m_compressContext = ZSTD_createCCtx();
+        }
+        if (m_decompressContext == nullptr)
+        {
+            m_decompressContext = ZSTD_createDCtx();
+        }
+        return (m_compressContext != nullptr) && (m_decompressContext != nullptr);
+    }
+
+    void ZstdDictionaryCompressor::ReleaseDictionary()
+    {
+        ZSTD_freeCDict(m_compressDictionary);
+        ZSTD_freeDDict(m_decompressDictionary);
+        m_compressDictionary = nullptr;
+        m_decompressDictionary = nullptr;
+        m_dictionaryId = 0;
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    //! @class ZstdDictionaryCompressor
+    //! @brief Zstd compressor that primes every packet with a dictionary trained offline from captured traffic.
+    //!
+    //! Packets are compressed independently since UDP datagrams may be dropped or reordered, so small packets have
+    //! little redundancy of their own. The dictionary supplies the shared context that per-packet compression lacks.
+    //! The dictionary is loaded from net_CompressionDictionary on Init(), both endpoints must use the same dictionary.
+    //! Without a dictionary this behaves as a plain per-packet zstd compressor.
+    class ZstdDictionaryCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionaryCompressor, AZ::SystemAllocator, 0);
+
+        static constexpr const char* CompressorName = "ZstdDictionary";
+
+        ZstdDictionaryCompressor() = default;
+        ~ZstdDictionaryCompressor() override;
+
+        const char* GetName() const { return CompressorName; }
+        AzNetworking::CompressorType GetType() const override;
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+        //! Replaces the active dictionary, an empty dictionary disables dictionary compression.
+        //! @param dictionary the raw dictionary contents, as produced by TrainDictionary()
+        //! @return boolean true on success, false if the dictionary could not be loaded
+        bool SetDictionary(const AZStd::vector<uint8_t>& dictionary);
+
+        //! Returns the id of the active dictionary.
+        //! @return the id of the active dictionary, 0 if no dictionary is loaded
+        uint32_t GetDictionaryId() const;
+
+        //! Trains a dictionary from a set of sample packets.
+        //! Zstd recommends providing roughly 100 times the dictionary capacity in sample data.
+        //! @param samples            the uncompressed sample packets to train from
+        //! @param dictionaryCapacity the maximum size of the dictionary in bytes
+        //! @param outDictionary      the trained dictionary
+        //! @return boolean true on success, false if training failed
+        static bool TrainDictionary(const AZStd::vector<AZStd::vector<uint8_t>>& samples, size_t dictionaryCapacity, AZStd::vector<uint8_t>& outDictionary);
+
+    private:
+        bool CreateContexts();
+        void ReleaseDictionary();
+
+        ZSTD_CCtx_s* m_compressContext = nullptr;
+        ZSTD_DCtx_s* m_decompressContext = nullptr;
+        ZSTD_CDict_s* m_compressDictionary = nullptr;
+        ZSTD_DDict_s* m_decompressDictionary = nullptr;
+        int32_t m_compressionLevel = 3;
+        uint32_t m_dictionaryId = 0;
+    };
+}
@@ -10,6 +10,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZstdDictionaryCompressor.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzCore/std/chrono/clocks.h>
@@ -126,4 +127,60 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+// Generates packets resembling entity updates, a shared header and property layout with varying values
+static AZStd::vector<AZStd::vector<uint8_t>> GenerateSamplePackets(uint32_t packetCount, uint32_t seed)
+{
+    AZStd::vector<AZStd::vector<uint8_t>> packets;
+    uint32_t state = seed;
+    for (uint32_t packetIndex = 0; packetIndex < packetCount; ++packetIndex)
+    {
+        AZStd::vector<uint8_t> packet;
+        for (uint32_t entityIndex = 0; entityIndex < 12; ++entityIndex)
+        {
+            const char header[] = "NetworkTransformComponent";
+            packet.insert(packet.end(), header, header + sizeof(header));
+            packet.push_back(static_cast<uint8_t>(entityIndex));
+            for (uint32_t valueIndex = 0; valueIndex < 4; ++valueIndex)
+            {
+                state = state * 1664525u + 1013904223u;
+                packet.push_back(static_cast<uint8_t>(state >> 24));
+            }
+        }
+        packets.push_back(AZStd::move(packet));
+    }
+    return packets;
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_DictionaryRoundTrip)
+{
+    AZStd::vector<uint8_t> dictionary;
+    ASSERT_TRUE(MultiplayerCompression::ZstdDictionaryCompressor::TrainDictionary(GenerateSamplePackets(2000, 1), 4096, dictionary));
+    EXPECT_LE(dictionary.size(), 4096);
+
+    MultiplayerCompression::ZstdDictionaryCompressor plainCompressor;
+    MultiplayerCompression::ZstdDictionaryCompressor dictionaryCompressor;
+    ASSERT_TRUE(dictionaryCompressor.SetDictionary(dictionary));
+    EXPECT_NE(dictionaryCompressor.GetDictionaryId(), 0);
+
+    const AZStd::vector<uint8_t> packet = GenerateSamplePackets(1, 42).front();
+    AZStd::vector<uint8_t> compressed(dictionaryCompressor.GetMaxCompressedBufferSize(packet.size()));
+    AZStd::vector<uint8_t> decompressed(packet.size());
+
+    size_t plainSize = 0;
+    ASSERT_EQ(plainCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), plainSize), AzNetworking::CompressorError::Ok);
+
+    size_t compressedSize = 0;
+    ASSERT_EQ(dictionaryCompressor.Compress(packet.data(), packet.size(), compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize, plainSize);
+
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+    ASSERT_EQ(dictionaryCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(uncompressedSize, packet.size());
+    EXPECT_EQ(memcmp(decompressed.data(), packet.data(), packet.size()), 0);
+
+    // A receiver without the matching dictionary must reject the packet rather than produce garbage
+    EXPECT_EQ(plainCompressor.Decompress(compressed.data(), compressedSize, decompressed.data(), decompressed.size(), consumedSize, uncompressedSize), AzNetworking::CompressorError::CorruptData);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Settings/CommandLine.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzNetworking/UdpTransport/UdpPacketCapture.h>
+#include <ZstdDictionaryCompressor.h>
+
+namespace MultiplayerCompression
+{
+    static constexpr size_t DefaultDictionaryCapacity = 16 * 1024;
+
+    void PrintHelp()
+    {
+        AZ_Printf("Help", "Multiplayer Compression Dictionary Trainer\n");
+        AZ_Printf("Help", "  Trains a zstd dictionary for the MultiplayerDictionaryCompressor from captured packets.\n");
+        AZ_Printf("Help", "  Capture with compression disabled so the samples contain uncompressed packet payloads.\n");
+        AZ_Printf("Help", "\n");
+        AZ_Printf("Help", "  <sample files>+ --output <path> [--size <bytes>]\n");
+        AZ_Printf("Help", "    [arg] <sample files>: one or more files, each file is treated as a single packet sample.\n");
+        AZ_Printf("Help", "                          .azcap packet captures (net_UdpCaptureFile) contribute every sent packet as a sample.\n");
+        AZ_Printf("Help", "    [arg] --output <path>: path to write the trained dictionary to.\n");
+        AZ_Printf("Help", "    [opt] --size <bytes>: maximum dictionary size. Default is %zu.\n", DefaultDictionaryCapacity);
+        AZ_Printf("Help", "    example: 'packet_0.bin packet_1.bin packet_2.bin --output multiplayer.dict'\n");
+        AZ_Printf("Help", "    example: 'server.MultiplayerNetworkInterface.azcap --output multiplayer.dict'\n");
+    }
+
+    bool ReadCaptureSamples(const AZStd::string& capturePath, AZStd::vector<AZStd::vector<uint8_t>>& outSamples, size_t& outTotalSampleBytes)
+    {
+        AzNetworking::UdpPacketCaptureReader captureReader;
+        if (!captureReader.Open(capturePath.c_str()))
+        {
+            AZ_Error("DictionaryTrainer", false, "Failed to read packet capture %s", capturePath.c_str());
+            return false;
+        }
+
+        AzNetworking::CapturedPacket packet;
+        while (captureReader.ReadNext(packet))
+        {
+            // Only sent packets are samples of what this endpoint will compress
+            if (packet.m_direction == AzNetworking::CaptureDirection::Sent)
+            {
+                outSamples.emplace_back(packet.m_data, packet.m_data + packet.m_size);
+                outTotalSampleBytes += packet.m_size;
+            }
+        }
+        return true;
+    }
+
+    bool Run(const AZ::CommandLine& commandLine)
+    {
+        if (commandLine.HasSwitch("help") || !commandLine.HasSwitch("output") || commandLine.GetNumMiscValues() == 0)
+        {
+            PrintHelp();
+            return commandLine.HasSwitch("help");
+        }
+
+        size_t dictionaryCapacity = DefaultDictionaryCapacity;
+        if (commandLine.HasSwitch("size"))
+        {
+            dictionaryCapacity = static_cast<size_t>(AZ::StringFunc::ToInt(commandLine.GetSwitchValue("size", 0).c_str()));
+        }
+
+        AZStd::vector<AZStd::vector<uint8_t>> samples;
+        size_t totalSampleBytes = 0;
+        for (size_t index = 0; index < commandLine.GetNumMiscValues(); ++index)
+        {
+            const AZStd::string& samplePath = commandLine.GetMiscValue(index);
+            if (AZ::StringFunc::Path::IsExtension(samplePath.c_str(), "azcap"))
+            {
+                if (!ReadCaptureSamples(samplePath, samples, totalSampleBytes))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            auto readResult = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(samplePath);
+            if (!readResult.IsSuccess())
+            {
+                AZ_Error("DictionaryTrainer", false, "Failed to read sample %s: %s", samplePath.c_str(), readResult.GetError().c_str());
+                return false;
+            }
+            totalSampleBytes += readResult.GetValue().size();
+            samples.emplace_back(readResult.TakeValue());
+        }
+
+        AZ_Warning("DictionaryTrainer", totalSampleBytes >= dictionaryCapacity * 10,
+            "Only %zu bytes of samples provided for a %zu byte dictionary, roughly 100x the dictionary size is recommended", totalSampleBytes, dictionaryCapacity);
+
+        AZStd::vector<uint8_t> dictionary;
+        if (!ZstdDictionaryCompressor::TrainDictionary(samples, dictionaryCapacity, dictionary))
+        {
+            AZ_Error("DictionaryTrainer", false, "Dictionary training failed");
+            return false;
+        }
+
+        const AZStd::string& outputPath = commandLine.GetSwitchValue("output", 0);
+        auto writeResult = AZ::Utils::WriteFile(AZStd::string_view(reinterpret_cast<const char*>(dictionary.data()), dictionary.size()), outputPath);
+        if (!writeResult.IsSuccess())
+        {
+            AZ_Error("DictionaryTrainer", false, "Failed to write dictionary to %s: %s", outputPath.c_str(), writeResult.GetError().c_str());
+            return false;
+        }
+
+        AZ_Printf("DictionaryTrainer", "Trained a %zu byte dictionary from %zu samples (%zu bytes), written to %s\n",
+            dictionary.size(), samples.size(), totalSampleBytes, outputPath.c_str());
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+    int runSuccess = 0;
+    {
+        AZ::CommandLine commandLine;
+        commandLine.Parse(argc, argv);
+        runSuccess = MultiplayerCompression::Run(commandLine) ? 0 : 1;
+    }
+    AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+    return runSuccess;
+}
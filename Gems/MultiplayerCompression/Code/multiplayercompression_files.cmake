@@ -13,4 +13,6 @@ set(FILES
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
     Source/MultiplayerCompressionSystemComponent.h
+    Source/ZstdDictionaryCompressor.cpp
+    Source/ZstdDictionaryCompressor.h
 )
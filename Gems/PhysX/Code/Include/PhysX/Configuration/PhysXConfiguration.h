@@ -51,6 +51,10 @@ namespace PhysX
 
         WindConfiguration m_windConfiguration; //!< Wind configuration for PhysX.
 
+        //! When enabled, the completion of each fixed step overlaps across all enabled scenes instead of running one scene at a time.
+        //! All scenes still advance by the same fixed steps and their events are signaled in scene order.
+        bool m_parallelSceneSimulation = false;
+
         bool operator==(const PhysXSystemConfiguration& other) const;
         bool operator!=(const PhysXSystemConfiguration& other) const;
     };
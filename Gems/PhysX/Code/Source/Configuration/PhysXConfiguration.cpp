@@ -92,6 +92,7 @@ namespace PhysX
             serializeContext->Class<PhysX::PhysXSystemConfiguration, AzPhysics::SystemConfiguration>()
                 ->Version(2, &PhysXInternal::PhysXSystemConfigurationConverter)
                 ->Field("WindConfiguration", &PhysXSystemConfiguration::m_windConfiguration)
+                ->Field("ParallelSceneSimulation", &PhysXSystemConfiguration::m_parallelSceneSimulation)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -100,6 +101,10 @@ namespace PhysX
                 editContext->Class<PhysX::PhysXSystemConfiguration>("System Configuration", "PhysX system configuration")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &PhysXSystemConfiguration::m_parallelSceneSimulation,
+                        "Parallel scene simulation",
+                        "Overlap the simulation of all enabled physics scenes.\n"
+                        "Useful when hosting several independent scenes, such as multiple server matches in one process.")
                     ;
             }
         }
@@ -115,7 +120,8 @@ namespace PhysX
     bool PhysXSystemConfiguration::operator==(const PhysXSystemConfiguration& other) const
     {
         return AzPhysics::SystemConfiguration::operator==(other) &&
-            m_windConfiguration == other.m_windConfiguration
+            m_windConfiguration == other.m_windConfiguration &&
+            m_parallelSceneSimulation == other.m_parallelSceneSimulation
             ;
     }
 
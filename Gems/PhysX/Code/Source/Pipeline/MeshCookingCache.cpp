@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/Pipeline/MeshCookingCache.h>
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+
+namespace PhysX
+{
+    namespace Pipeline
+    {
+        static const char* const CacheEntryExtension = ".pxcooked";
+
+        MeshCookingCache::KeyBuilder& MeshCookingCache::KeyBuilder::AppendBytes(const void* data, size_t byteCount)
+        {
+            m_sha.ProcessBytes(data, byteCount);
+            return *this;
+        }
+
+        MeshCookingCache::KeyBuilder& MeshCookingCache::KeyBuilder::AppendString(AZStd::string_view value)
+        {
+            AppendValue(static_cast<AZ::u64>(value.size()));
+            return AppendBytes(value.data(), value.size());
+        }
+
+        AZStd::string MeshCookingCache::KeyBuilder::GetKey()
+        {
+            AZ::u32 digest[5];
+            m_sha.GetDigest(digest);
+            return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+        }
+
+        MeshCookingCache::MeshCookingCache()
+        {
+            if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance())
+            {
+                if (AZStd::optional<AZ::IO::FixedMaxPath> resolvedFolder = fileIO->ResolvePath(DefaultCacheFolder))
+                {
+                    m_cacheFolder = resolvedFolder->c_str();
+                }
+            }
+        }
+
+        MeshCookingCache::MeshCookingCache(AZ::IO::PathView cacheFolder)
+            : m_cacheFolder(cacheFolder)
+        {
+        }
+
+        bool MeshCookingCache::IsEnabled() const
+        {
+            return !m_cacheFolder.empty();
+        }
+
+        bool MeshCookingCache::Load(const AZStd::string& key, AZStd::vector<AZ::u8>& cookedData) const
+        {
+            if (!IsEnabled())
+            {
+                return false;
+            }
+
+            const AZ::IO::Path entryPath = GetEntryPath(key);
+            AZ::IO::SystemFile entryFile;
+            if (!entryFile.Open(entryPath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+            {
+                return false;
+            }
+
+            const AZ::IO::SystemFile::SizeType entrySize = entryFile.Length();
+            cookedData.resize_no_construct(entrySize);
+            const bool entryRead = entrySize > 0 && entryFile.Read(entrySize, cookedData.data()) == entrySize;
+            if (!entryRead)
+            {
+                cookedData.clear();
+            }
+            return entryRead;
+        }
+
+        void MeshCookingCache::Store(const AZStd::string& key, const AZStd::vector<AZ::u8>& cookedData) const
+        {
+            if (!IsEnabled() || cookedData.empty())
+            {
+                return;
+            }
+
+            const AZ::IO::Path entryPath = GetEntryPath(key);
+
+            // Every writer uses its own temporary file, other builders may be storing the same entry at the same time.
+            AZ::IO::Path temporaryPath = entryPath;
+            temporaryPath.ReplaceExtension(AZStd::string::format(".%s.tmp", AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str()).c_str());
+
+            AZ::IO::SystemFile temporaryFile;
+            if (!temporaryFile.Open(temporaryPath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Warning("PhysX", false, "Unable to create mesh cooking cache entry %s", temporaryPath.c_str());
+                return;
+            }
+
+            const bool entryWritten = temporaryFile.Write(cookedData.data(), cookedData.size()) == cookedData.size();
+            temporaryFile.Close();
+
+            if (!entryWritten || !AZ::IO::SystemFile::Rename(temporaryPath.c_str(), entryPath.c_str(), true))
+            {
+                AZ::IO::SystemFile::Delete(temporaryPath.c_str());
+            }
+        }
+
+        AZ::IO::Path MeshCookingCache::GetEntryPath(const AZStd::string& key) const
+        {
+            // Spread the entries over subfolders named after the first two characters of the key
+            // to keep the number of files per folder manageable on levels with many collision meshes.
+            AZ::IO::Path entryPath = m_cacheFolder;
+            entryPath /= key.substr(0, 2);
+            entryPath /= key + CacheEntryExtension;
+            return entryPath;
+        }
+    } // namespace Pipeline
+} // namespace PhysX
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/typetraits/is_arithmetic.h>
+#include <AzCore/std/typetraits/is_enum.h>
+
+namespace PhysX
+{
+    namespace Pipeline
+    {
+        //! Disk cache of cooked PhysX mesh data, keyed by a hash of every input used to cook a mesh.
+        //! Entries are shared by all asset builder processes and kept across builds, so an unchanged collision mesh
+        //! is only cooked once even when the scene containing it is processed again.
+        class MeshCookingCache
+        {
+        public:
+            //! Folder the cache stores its entries in when no other folder is provided.
+            static constexpr const char* DefaultCacheFolder = "@user@/PhysX/MeshCookingCache";
+
+            //! Accumulates the inputs of a cook into a cache key.
+            class KeyBuilder
+            {
+            public:
+                KeyBuilder& AppendBytes(const void* data, size_t byteCount);
+
+                template<typename T>
+                KeyBuilder& AppendValue(const T& value)
+                {
+                    static_assert(AZStd::is_arithmetic<T>::value || AZStd::is_enum<T>::value, "Only plain values can be appended to a cache key");
+                    return AppendBytes(&value, sizeof(T));
+                }
+
+                //! Appends the element count followed by the elements, which must not contain padding.
+                template<typename T>
+                KeyBuilder& AppendArray(const AZStd::vector<T>& values)
+                {
+                    AppendValue(static_cast<AZ::u64>(values.size()));
+                    return AppendBytes(values.data(), values.size() * sizeof(T));
+                }
+
+                KeyBuilder& AppendString(AZStd::string_view value);
+
+                //! Returns the hexadecimal digest of everything appended so far.
+                AZStd::string GetKey();
+
+            private:
+                AZ::Sha1 m_sha;
+            };
+
+            //! Creates a cache storing its entries in DefaultCacheFolder.
+            MeshCookingCache();
+
+            //! Creates a cache storing its entries in the provided folder.
+            explicit MeshCookingCache(AZ::IO::PathView cacheFolder);
+
+            //! Returns whether the cache has a folder to store its entries in.
+            bool IsEnabled() const;
+
+            //! Reads the cooked data stored for a key.
+            //! @return true if an entry was found for the key, false otherwise.
+            bool Load(const AZStd::string& key, AZStd::vector<AZ::u8>& cookedData) const;
+
+            //! Stores cooked data for a key. The entry is written to a temporary file and then renamed,
+            //! so a concurrent reader never observes a partially written entry.
+            void Store(const AZStd::string& key, const AZStd::vector<AZ::u8>& cookedData) const;
+
+        private:
+            AZ::IO::Path GetEntryPath(const AZStd::string& key) const;
+
+            AZ::IO::Path m_cacheFolder;
+        };
+    } // namespace Pipeline
+} // namespace PhysX
@@ -21,6 +21,7 @@
 #include <PhysX/MeshAsset.h>
 #include <Source/Material.h>
 #include <Source/Pipeline/MeshAssetHandler.h>
+#include <Source/Pipeline/MeshCookingCache.h>
 #include <Source/Pipeline/MeshExporter.h>
 #include <Source/Pipeline/PrimitiveShapeFitter/PrimitiveShapeFitter.h>
 #include <Source/Pipeline/MeshGroup.h>
@@ -32,6 +33,8 @@
 #include <Cry_Math.h>
 #include <MathConversion.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/XML/rapidxml.h>
 #include <AzCore/std/algorithm.h>
@@ -72,6 +75,25 @@ namespace PhysX
             AZStd::string m_nodeName;
         };
 
+        // A struct to store the cooked data of a sub-mesh
+        struct CookedSubMeshData
+        {
+            AZStd::vector<AZ::u8> m_data;
+            bool m_success = false;
+        };
+
+        // A struct to store the geometry data of a mesh group and, once cooked, the cooked data of each of its sub-meshes
+        struct MeshGroupExportData
+        {
+            const MeshGroup* m_meshGroup = nullptr;
+            Utils::AssetMaterialsData m_assetMaterialsData;
+            AZStd::vector<NodeCollisionGeomExportData> m_totalExportData;
+            AZStd::vector<CookedSubMeshData> m_cookedSubMeshes;
+        };
+
+        // Version of the mesh cooking cache keys, bump it whenever the way meshes are cooked changes
+        static constexpr AZ::u32 MeshCookingCacheVersion = 1;
+
         // Implementation of the V-HACD log callback interface directing all messages to LogWindow output.
         static class VHACDLogCallback
             : public VHACD::IVHACD::IUserLogger
@@ -217,9 +239,13 @@ namespace PhysX
                 physx::PxDefaultMemoryInputData inpStream(static_cast<physx::PxU8*>(assetData), assetDataSize);
                 physx::PxTriangleMesh* triangleMesh = PxGetPhysics().createTriangleMesh(inpStream);
 
-                bool success = triangleMesh != nullptr;
+                if (triangleMesh == nullptr)
+                {
+                    return false;
+                }
+
                 triangleMesh->release();
-                return success;
+                return true;
             }
 
             bool ValidateCookedConvexMesh(void* assetData, AZ::u32 assetDataSize)
@@ -227,9 +253,13 @@ namespace PhysX
                 physx::PxDefaultMemoryInputData inpStream(static_cast<physx::PxU8*>(assetData), assetDataSize);
                 physx::PxConvexMesh* convexMesh = PxGetPhysics().createConvexMesh(inpStream);
 
-                bool success = convexMesh != nullptr;
+                if (convexMesh == nullptr)
+                {
+                    return false;
+                }
+
                 convexMesh->release();
-                return success;
+                return true;
             }
 
             AZStd::vector<AZStd::string> GenerateLocalNodeMaterialMap(const AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex)
@@ -482,13 +512,143 @@ namespace PhysX
             return cookingSuccessful;
         }
 
+        // Computes the mesh cooking cache key of a sub-mesh, covering every input used by CookPhysXMesh
+        static AZStd::string GetMeshCookingCacheKey(
+            const NodeCollisionGeomExportData& subMesh,
+            const MeshGroup& meshGroup,
+            const AZStd::string& platformIdentifier)
+        {
+            MeshCookingCache::KeyBuilder keyBuilder;
+            keyBuilder
+                .AppendValue(MeshCookingCacheVersion)
+                .AppendValue(static_cast<AZ::u32>(PX_PHYSICS_VERSION))
+                .AppendValue(static_cast<AZ::u32>(GetMidPhaseStructureType(platformIdentifier)))
+                .AppendValue(meshGroup.GetExportAsConvex());
+
+            if (meshGroup.GetExportAsConvex())
+            {
+                const ConvexAssetParams& convexAssetParams = meshGroup.GetConvexAssetParams();
+                keyBuilder
+                    .AppendValue(convexAssetParams.GetAreaTestEpsilon())
+                    .AppendValue(convexAssetParams.GetPlaneTolerance())
+                    .AppendValue(convexAssetParams.GetUse16bitIndices())
+                    .AppendValue(convexAssetParams.GetCheckZeroAreaTriangles())
+                    .AppendValue(convexAssetParams.GetQuantizeInput())
+                    .AppendValue(convexAssetParams.GetUsePlaneShifting())
+                    .AppendValue(convexAssetParams.GetShiftVertices())
+                    .AppendValue(convexAssetParams.GetBuildGpuData())
+                    .AppendValue(convexAssetParams.GetGaussMapLimit());
+            }
+            else
+            {
+                const TriangleMeshAssetParams& triangleMeshAssetParams = meshGroup.GetTriangleMeshAssetParams();
+                keyBuilder
+                    .AppendValue(triangleMeshAssetParams.GetNumTrisPerLeaf())
+                    .AppendValue(triangleMeshAssetParams.GetMeshWeldTolerance())
+                    .AppendValue(triangleMeshAssetParams.GetBuildTriangleAdjacencies())
+                    .AppendValue(triangleMeshAssetParams.GetSuppressTriangleMeshRemapTable())
+                    .AppendValue(triangleMeshAssetParams.GetWeldVertices())
+                    .AppendValue(triangleMeshAssetParams.GetDisableCleanMesh())
+                    .AppendValue(triangleMeshAssetParams.GetForce32BitIndices());
+            }
+
+            return keyBuilder
+                .AppendArray(subMesh.m_vertices)
+                .AppendArray(subMesh.m_indices)
+                .AppendArray(subMesh.m_perFaceMaterialIndices)
+                .GetKey();
+        }
+
+        // Cooks a sub-mesh, reusing the cooked data stored in the cache if the same sub-mesh was cooked before
+        static bool CookPhysXMeshCached(
+            const NodeCollisionGeomExportData& subMesh,
+            AZStd::vector<AZ::u8>& output,
+            const MeshGroup& meshGroup,
+            const AZStd::string& platformIdentifier,
+            const MeshCookingCache& cookingCache)
+        {
+            const AZStd::string cacheKey = GetMeshCookingCacheKey(subMesh, meshGroup, platformIdentifier);
+
+            if (cookingCache.Load(cacheKey, output))
+            {
+                // Validate the cached data anyway, a cache entry may have been written by a different PhysX build
+                // or damaged on disk, in which case the sub-mesh is cooked again.
+                const AZ::u32 outputSize = static_cast<AZ::u32>(output.size());
+                if (meshGroup.GetExportAsConvex())
+                {
+                    if (Utils::ValidateCookedConvexMesh(output.data(), outputSize))
+                    {
+                        RequireSingleFaceMaterial(subMesh.m_perFaceMaterialIndices);
+                        return true;
+                    }
+                }
+                else if (Utils::ValidateCookedTriangleMesh(output.data(), outputSize))
+                {
+                    return true;
+                }
+                output.clear();
+            }
+
+            if (!CookPhysXMesh(subMesh.m_vertices, subMesh.m_indices, subMesh.m_perFaceMaterialIndices,
+                &output, meshGroup, platformIdentifier))
+            {
+                return false;
+            }
+
+            cookingCache.Store(cacheKey, output);
+            return true;
+        }
+
+        // Cooks the sub-meshes of all the mesh groups in a scene concurrently, one job per sub-mesh.
+        // The cooked data is stored per sub-mesh so the assets are written exactly as if the sub-meshes were cooked in order.
+        static void CookMeshGroups(AZStd::vector<MeshGroupExportData>& meshGroupsExportData, const AZStd::string& platformIdentifier)
+        {
+            AZ_PROFILE_FUNCTION(Physics);
+
+            const MeshCookingCache cookingCache;
+
+            AZ::JobCompletion jobCompletion;
+            AZ::JobContext* jobContext = nullptr;
+
+            for (MeshGroupExportData& meshGroupExportData : meshGroupsExportData)
+            {
+                if (meshGroupExportData.m_meshGroup->GetExportAsPrimitive())
+                {
+                    continue;
+                }
+
+                meshGroupExportData.m_cookedSubMeshes.resize(meshGroupExportData.m_totalExportData.size());
+
+                for (size_t subMeshIndex = 0; subMeshIndex < meshGroupExportData.m_totalExportData.size(); ++subMeshIndex)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([&meshGroupExportData, subMeshIndex, &platformIdentifier, &cookingCache]()
+                    {
+                        const NodeCollisionGeomExportData& subMesh = meshGroupExportData.m_totalExportData[subMeshIndex];
+                        CookedSubMeshData& cookedSubMesh = meshGroupExportData.m_cookedSubMeshes[subMeshIndex];
+
+                        AZ_TraceContext("Group Name", meshGroupExportData.m_meshGroup->GetName());
+                        AZ_TraceContext("Node Name", subMesh.m_nodeName);
+
+                        cookedSubMesh.m_success = CookPhysXMeshCached(
+                            subMesh, cookedSubMesh.m_data, *meshGroupExportData.m_meshGroup, platformIdentifier, cookingCache);
+                    }, true, jobContext);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
+                }
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
         // Processes the collected data and writes into a file
         static AZ::SceneAPI::Events::ProcessingResult WritePxMeshAsset(
             AZ::SceneAPI::Events::ExportEventContext& context,
-            const AZStd::vector<NodeCollisionGeomExportData>& totalExportData,
-            const Utils::AssetMaterialsData &assetMaterialsData,
-            const MeshGroup& meshGroup)
+            const MeshGroupExportData& meshGroupExportData)
         {
+            const MeshGroup& meshGroup = *meshGroupExportData.m_meshGroup;
+            const AZStd::vector<NodeCollisionGeomExportData>& totalExportData = meshGroupExportData.m_totalExportData;
+            const Utils::AssetMaterialsData& assetMaterialsData = meshGroupExportData.m_assetMaterialsData;
+
             SceneEvents::ProcessingResult result = SceneEvents::ProcessingResult::Ignored;
 
             AZStd::string assetName = meshGroup.GetName();
@@ -509,8 +669,9 @@ namespace PhysX
                 return SceneEvents::ProcessingResult::Failure;
             }
 
-            for (const NodeCollisionGeomExportData& subMesh : totalExportData)
+            for (size_t subMeshIndex = 0; subMeshIndex < totalExportData.size(); ++subMeshIndex)
             {
+                const NodeCollisionGeomExportData& subMesh = totalExportData[subMeshIndex];
                 MeshAssetData::ShapeConfigurationPair shape;
 
                 if (meshGroup.GetExportAsPrimitive())
@@ -530,19 +691,17 @@ namespace PhysX
                 }
                 else
                 {
-                    // Cook the mesh into a binary buffer.
-                    AZStd::vector<AZ::u8> physxData;
-                    bool success = CookPhysXMesh(subMesh.m_vertices, subMesh.m_indices, subMesh.m_perFaceMaterialIndices,
-                        &(physxData), meshGroup, context.GetPlatformIdentifier());
+                    // The mesh was cooked into a binary buffer by CookMeshGroups.
+                    const CookedSubMeshData& cookedSubMesh = meshGroupExportData.m_cookedSubMeshes[subMeshIndex];
 
-                    if (success)
+                    if (cookedSubMesh.m_success)
                     {
                         AZStd::shared_ptr<Physics::CookedMeshShapeConfiguration> shapeConfig =
                             AZStd::make_shared<Physics::CookedMeshShapeConfiguration>();
 
                         shapeConfig->SetCookedMeshData(
-                            physxData.data(),
-                            physxData.size(),
+                            cookedSubMesh.m_data.data(),
+                            cookedSubMesh.m_data.size(),
                             meshGroup.GetExportAsConvex() ? Physics::CookedMeshShapeConfiguration::MeshType::Convex
                                                           : Physics::CookedMeshShapeConfiguration::MeshType::TriangleMesh
                         );
@@ -720,6 +879,9 @@ namespace PhysX
 
             ScopedVHACD decomposer;
 
+            // Geometry of all the mesh groups, gathered first so the sub-meshes of the whole scene are cooked together
+            AZStd::vector<MeshGroupExportData> meshGroupsExportData;
+
             for (const MeshGroup& pxMeshGroup : view)
             {
                 // Gather material data from asset for the mesh group
@@ -864,10 +1026,22 @@ namespace PhysX
 
                 if (!totalExportData.empty())
                 {
-                    result += WritePxMeshAsset(context, totalExportData, *assetMaterialData, pxMeshGroup);
+                    MeshGroupExportData& meshGroupExportData = meshGroupsExportData.emplace_back();
+                    meshGroupExportData.m_meshGroup = &pxMeshGroup;
+                    meshGroupExportData.m_assetMaterialsData = AZStd::move(*assetMaterialData);
+                    meshGroupExportData.m_totalExportData = AZStd::move(totalExportData);
                 }
             }
 
+            CookMeshGroups(meshGroupsExportData, context.GetPlatformIdentifier());
+
+            for (const MeshGroupExportData& meshGroupExportData : meshGroupsExportData)
+            {
+                AZ_TraceContext("Group Name", meshGroupExportData.m_meshGroup->GetName());
+
+                result += WritePxMeshAsset(context, meshGroupExportData);
+            }
+
             return result.GetResult();
         }
     }
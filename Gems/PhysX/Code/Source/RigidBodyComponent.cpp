@@ -8,10 +8,12 @@
 
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Component/Entity.h>
 #include <AzCore/Math/Transform.h>
 #include <AzFramework/Physics/Utils.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <PhysX/ColliderComponentBus.h>
@@ -89,16 +91,12 @@ namespace PhysX
         }
     }
 
-    RigidBodyComponent::RigidBodyComponent()
-    {
-        InitPhysicsTickHandler();
-    }
+    RigidBodyComponent::RigidBodyComponent() = default;
 
     RigidBodyComponent::RigidBodyComponent(const AzPhysics::RigidBodyConfiguration& config, AzPhysics::SceneHandle sceneHandle)
         : m_configuration(config)
         , m_attachedSceneHandle(sceneHandle)
     {
-        InitPhysicsTickHandler();
     }
 
     void RigidBodyComponent::Init()
@@ -183,7 +181,6 @@ namespace PhysX
         Physics::RigidBodyRequestBus::Handler::BusDisconnect();
         AzPhysics::SimulatedBodyComponentRequestsBus::Handler::BusDisconnect();
         AZ::TransformNotificationBus::MultiHandler::BusDisconnect();
-        m_sceneFinishSimHandler.Disconnect();
         AZ::TickBus::Handler::BusDisconnect();
     }
 
@@ -195,8 +192,8 @@ namespace PhysX
             AZ::Quaternion newRotation = AZ::Quaternion::CreateIdentity();
             m_interpolator->GetInterpolated(newPosition, newRotation, deltaTime);
 
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldRotationQuaternion, newRotation);
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldTranslation, newPosition);
+            AZ::TransformInterface* transform = GetEntity()->GetTransform();
+            transform->SetWorldTM(AZ::Transform(newPosition, newRotation, transform->GetWorldUniformScale()));
         }
     }
 
@@ -205,18 +202,7 @@ namespace PhysX
         return AZ::ComponentTickBus::TICK_PHYSICS;
     }
 
-    void RigidBodyComponent::InitPhysicsTickHandler()
-    {
-        m_sceneFinishSimHandler = AzPhysics::SceneEvents::OnSceneSimulationFinishHandler([this](
-            [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
-            float fixedDeltatime
-            )
-            {
-                this->PostPhysicsTick(fixedDeltatime);
-            }, aznumeric_cast<int32_t>(AzPhysics::SceneEvents::PhysicsStartFinishSimulationPriority::Physics));
-    }
-
-    void RigidBodyComponent::PostPhysicsTick(float fixedDeltaTime)
+    bool RigidBodyComponent::WriteSimulatedTransform(const AZ::Transform& bodyTransform, float fixedDeltaTime)
     {
         // When transform changes, Kinematic Target is updated with the new transform, so don't set the transform again.
         // But in the case of setting the Kinematic Target directly, the transform needs to reflect the new kinematic target
@@ -225,35 +211,21 @@ namespace PhysX
 
         if (!IsPhysicsEnabled() || (IsKinematic() && !m_isLastMovementFromKinematicSource))
         {
-            return;
-        }
-
-        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
-        if (sceneInterface == nullptr)
-        {
-            AZ_Error("RigidBodyComponent", false, "PostPhysicsTick, SceneInterface is null");
-            return;
+            return false;
         }
 
-        AzPhysics::SimulatedBody* rigidBody =
-            sceneInterface->GetSimulatedBodyFromHandle(m_attachedSceneHandle, m_rigidBodyHandle);
-        if (rigidBody == nullptr)
-        {
-            AZ_Error("RigidBodyComponent", false, "Unable to retrieve simulated rigid body");
-            return;
-        }
-        
-        AZ::Transform transform = rigidBody->GetTransform();
+        m_isLastMovementFromKinematicSource = false;
         if (m_configuration.m_interpolateMotion)
         {
-            m_interpolator->SetTarget(transform.GetTranslation(), rigidBody->GetOrientation(), fixedDeltaTime);
+            // The entity is moved towards the target in OnTick
+            m_interpolator->SetTarget(bodyTransform.GetTranslation(), bodyTransform.GetRotation(), fixedDeltaTime);
+            return false;
         }
-        else
-        {
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldRotationQuaternion, rigidBody->GetOrientation());
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformInterface::SetWorldTranslation, rigidBody->GetPosition());
-        }
-        m_isLastMovementFromKinematicSource = false;
+
+        // Position and rotation are set together so that transform listeners are only notified once per step
+        AZ::TransformInterface* transform = GetEntity()->GetTransform();
+        transform->SetWorldTM(AZ::Transform(bodyTransform.GetTranslation(), bodyTransform.GetRotation(), transform->GetWorldUniformScale()));
+        return true;
     }
 
     void RigidBodyComponent::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
@@ -298,10 +270,14 @@ namespace PhysX
             m_rigidBodyHandle = sceneInterface->AddSimulatedBody(m_attachedSceneHandle, &m_configuration);
         }
 
-        // Listen to the PhysX system for events concerning this entity.
-        if (sceneInterface != nullptr)
+        // Have the scene write the simulated transform back to this entity after each step it moves.
+        // The writer is unregistered by the scene when the body is removed.
+        if (auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get())
         {
-            sceneInterface->RegisterSceneSimulationFinishHandler(m_attachedSceneHandle, m_sceneFinishSimHandler);
+            if (auto* scene = azdynamic_cast<PhysXScene*>(physicsSystem->GetScene(m_attachedSceneHandle)))
+            {
+                scene->RegisterTransformWriter(m_rigidBodyHandle, this, m_configuration.m_interpolateMotion);
+            }
         }
         AZ::TickBus::Handler::BusConnect();
         AZ::TransformNotificationBus::MultiHandler::BusConnect(GetEntityId());
@@ -17,6 +17,7 @@
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
 #include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipServiceBus.h>
+#include <Scene/PhysXScene.h>
 
 namespace AzPhysics
 {
@@ -35,6 +36,7 @@ namespace PhysX
         , public AZ::TickBus::Handler
         , public AzFramework::SliceGameEntityOwnershipServiceNotificationBus::Handler
         , protected AZ::TransformNotificationBus::MultiHandler
+        , protected SimulatedTransformWriter
     {
     public:
         AZ_COMPONENT(RigidBodyComponent, "{D4E52A70-BDE1-4819-BD3C-93AB3F4F3BE3}");
@@ -143,11 +145,12 @@ namespace PhysX
         // TransformNotificationBus
         void OnTransformChanged(const AZ::Transform& local, const AZ::Transform& world) override;
 
+        // SimulatedTransformWriter
+        bool WriteSimulatedTransform(const AZ::Transform& bodyTransform, float fixedDeltaTime) override;
+
     private:
         void SetupConfiguration();
         void CreatePhysics();
-        void InitPhysicsTickHandler();
-        void PostPhysicsTick(float fixedDeltaTime);
 
         const AzPhysics::RigidBody* GetRigidBodyConst() const;
 
@@ -160,8 +163,6 @@ namespace PhysX
         bool m_staticTransformAtActivation = false; ///< Whether the transform was static when the component last activated.
         bool m_isLastMovementFromKinematicSource = false; ///< True when the source of the movement comes from SetKinematicTarget as opposed to coming from a Transform change
         bool m_rigidBodyTransformNeedsUpdateOnPhysReEnable = false; ///< True if rigid body transform needs to be synced to the entity's when physics is re-enabled
-
-        AzPhysics::SceneEvents::OnSceneSimulationFinishHandler m_sceneFinishSimHandler;
     };
 
     class TransformForwardTimeInterpolator
@@ -8,6 +8,10 @@
 #include <Scene/PhysXScene.h>
 
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -41,6 +45,9 @@ namespace PhysX
 
     namespace Internal
     {
+        //! Batches smaller than this are run serially, a job per query costs more than the query itself.
+        static constexpr size_t MinQueriesPerBatchJob = 32;
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
             SceneSimulationEventCallback* simEventCallback)
@@ -67,10 +74,9 @@ namespace PhysX
                 sceneDesc.filterShader = Collision::DefaultFilterShader;
             }
             
-            if (config.m_enableActiveActors)
-            {
-                sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
-            }
+            // Active actors are always tracked, they drive the transform write-back after each step.
+            // SceneConfiguration::m_enableActiveActors only controls whether they are reported through OnSceneActiveSimulatedBodiesEvent.
+            sceneDesc.flags |= physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
     
             if (config.m_enablePcm)
             {
@@ -492,6 +498,9 @@ namespace PhysX
 
     PhysXScene::~PhysXScene()
     {
+        // Outstanding async queries reference the scene, complete them before tearing anything down.
+        FlushAsyncSceneQueries();
+
         m_physicsSystemConfigChanged.Disconnect();
 
         s_overlapBuffer.swap({});
@@ -543,16 +552,15 @@ namespace PhysX
         }
 
         m_currentDeltaTime = deltatime;
+        m_simulationResultsFetched = false;
 
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
     }
 
-    void PhysXScene::FinishSimulation()
+    void PhysXScene::FetchSimulationResults()
     {
-        AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
-
-        if (!IsEnabled())
+        if (!IsEnabled() || m_simulationResultsFetched)
         {
             return;
         }
@@ -568,25 +576,42 @@ namespace PhysX
             m_pxScene->checkResults(true);
         }
 
-        bool activeActorsEnabled = false;
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::FetchResults");
             PHYSX_SCENE_WRITE_LOCK(m_pxScene);
 
-            activeActorsEnabled = m_pxScene->getFlags() & physx::PxSceneFlag::eENABLE_ACTIVE_ACTORS;
-
             // Swap the buffers, invoke callbacks, build the list of active actors.
+            // The simulation callbacks only queue events on this scene, they are signaled later by FinishSimulation.
             m_pxScene->fetchResults(true);
+            m_activeActors = m_pxScene->getActiveActors(m_numActiveActors);
+        }
+        m_simulationResultsFetched = true;
+    }
+
+    void PhysXScene::FinishSimulation()
+    {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
+
+        if (!IsEnabled())
+        {
+            FlushAsyncSceneQueries();
+            return;
         }
+
+        FetchSimulationResults();
+        m_simulationResultsFetched = false;
+
+        physx::PxActor** activeActors = m_activeActors;
+        const physx::PxU32 numActiveActors = m_numActiveActors;
+        m_activeActors = nullptr;
+        m_numActiveActors = 0;
         
-        if (activeActorsEnabled)
+        if (m_config.m_enableActiveActors)
         {
             AZ_PROFILE_SCOPE(Physics, "PhysXScene::ActiveActors");
 
             PHYSX_SCENE_READ_LOCK(m_pxScene);
 
-            physx::PxU32 numActiveActors = 0;
-            physx::PxActor** activeActors = m_pxScene->getActiveActors(numActiveActors);
             AzPhysics::SimulatedBodyHandleList activeBodyHandles;
             activeBodyHandles.reserve(numActiveActors);
             for (physx::PxU32 i = 0; i < numActiveActors; ++i)
@@ -599,9 +624,14 @@ namespace PhysX
             m_sceneActiveSimulatedBodies.Signal(m_sceneHandle, activeBodyHandles);
         }
 
+        // Async queries overlap the simulation, deliver their results before deferred deletions so any hit bodies are still valid.
+        FlushAsyncSceneQueries();
+
         FlushQueuedEvents();
         ClearDeferedDeletions();
 
+        WriteBackTransforms(activeActors, numActiveActors);
+
         {
             AZ_PROFILE_SCOPE(Physics, "OnSceneSimulationFinishedEvent::Signaled");
             m_sceneSimuationFinishEvent.Signal(m_sceneHandle, m_currentDeltaTime);
@@ -610,6 +640,137 @@ namespace PhysX
         UpdateAzProfilerDataPoints();
     }
 
+    void PhysXScene::WriteBackTransforms(physx::PxActor** activeActors, physx::PxU32 numActiveActors)
+    {
+        if (m_transformWriters.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::WriteBackTransforms");
+
+        m_pendingTransformWrites.clear();
+        m_updatedTransformBodies.clear();
+        {
+            PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+            // Sleeping bodies are not reported as active, so only bodies that moved during the step are gathered here
+            for (physx::PxU32 i = 0; i < numActiveActors; ++i)
+            {
+                ActorData* actorData = Utils::GetUserData(activeActors[i]);
+                const physx::PxRigidActor* rigidActor = activeActors[i]->is<physx::PxRigidActor>();
+                if (actorData == nullptr || rigidActor == nullptr)
+                {
+                    continue;
+                }
+
+                const AZ::s32 writerIndex = FindTransformWriter(actorData->GetBodyHandle());
+                if (writerIndex >= 0)
+                {
+                    TransformWriterEntry& entry = m_transformWriters[writerIndex];
+                    entry.m_transform = PxMathConvert(rigidActor->getGlobalPose());
+                    entry.m_moved = true;
+                }
+            }
+
+            for (TransformWriterEntry& entry : m_transformWriters)
+            {
+                if (entry.m_moved)
+                {
+                    m_pendingTransformWrites.emplace_back(entry.m_bodyHandle, entry.m_transform);
+                    entry.m_moved = false;
+                }
+                else if (entry.m_writeEveryStep)
+                {
+                    m_pendingTransformWrites.emplace_back(entry.m_bodyHandle, entry.m_body->GetTransform());
+                }
+            }
+        }
+
+        // Writers may add or remove bodies and writers, so each one is looked up again before it is invoked
+        for (const auto& [bodyHandle, transform] : m_pendingTransformWrites)
+        {
+            const AZ::s32 writerIndex = FindTransformWriter(bodyHandle);
+            if (writerIndex >= 0 && m_transformWriters[writerIndex].m_writer->WriteSimulatedTransform(transform, m_currentDeltaTime))
+            {
+                m_updatedTransformBodies.push_back(bodyHandle);
+            }
+        }
+
+        if (!m_updatedTransformBodies.empty())
+        {
+            AZ_PROFILE_SCOPE(Physics, "OnSceneTransformsUpdatedEvent::Signaled");
+            m_sceneTransformsUpdatedEvent.Signal(m_sceneHandle, m_updatedTransformBodies);
+        }
+    }
+
+    void PhysXScene::RegisterTransformWriter(AzPhysics::SimulatedBodyHandle bodyHandle, SimulatedTransformWriter* writer, bool writeEveryStep)
+    {
+        AzPhysics::SimulatedBody* body = GetSimulatedBodyFromHandle(bodyHandle);
+        if (body == nullptr || writer == nullptr)
+        {
+            AZ_Warning("PhysXScene", false, "Unable to register transform writer, failed to find body.");
+            return;
+        }
+
+        const AZ::s32 existingIndex = FindTransformWriter(bodyHandle);
+        if (existingIndex >= 0)
+        {
+            m_transformWriters[existingIndex].m_writer = writer;
+            m_transformWriters[existingIndex].m_writeEveryStep = writeEveryStep;
+            return;
+        }
+
+        const AzPhysics::SimulatedBodyIndex bodyIndex = AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle);
+        if (static_cast<size_t>(bodyIndex) >= m_transformWriterIndices.size())
+        {
+            m_transformWriterIndices.resize(bodyIndex + 1, -1);
+        }
+        m_transformWriterIndices[bodyIndex] = static_cast<AZ::s32>(m_transformWriters.size());
+
+        TransformWriterEntry& entry = m_transformWriters.emplace_back();
+        entry.m_bodyHandle = bodyHandle;
+        entry.m_writer = writer;
+        entry.m_body = body;
+        entry.m_writeEveryStep = writeEveryStep;
+    }
+
+    void PhysXScene::UnregisterTransformWriter(AzPhysics::SimulatedBodyHandle bodyHandle)
+    {
+        const AZ::s32 writerIndex = FindTransformWriter(bodyHandle);
+        if (writerIndex < 0)
+        {
+            return;
+        }
+
+        // Swap the last writer into the freed slot to keep the list contiguous
+        const AZ::s32 lastIndex = static_cast<AZ::s32>(m_transformWriters.size()) - 1;
+        if (writerIndex != lastIndex)
+        {
+            m_transformWriters[writerIndex] = m_transformWriters[lastIndex];
+            const AzPhysics::SimulatedBodyIndex movedBodyIndex = AZStd::get<AzPhysics::HandleTypeIndex::Index>(m_transformWriters[writerIndex].m_bodyHandle);
+            m_transformWriterIndices[movedBodyIndex] = writerIndex;
+        }
+        m_transformWriters.pop_back();
+        m_transformWriterIndices[AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle)] = -1;
+    }
+
+    AZ::s32 PhysXScene::FindTransformWriter(AzPhysics::SimulatedBodyHandle bodyHandle) const
+    {
+        const AzPhysics::SimulatedBodyIndex bodyIndex = AZStd::get<AzPhysics::HandleTypeIndex::Index>(bodyHandle);
+        if (bodyIndex < 0 || static_cast<size_t>(bodyIndex) >= m_transformWriterIndices.size())
+        {
+            return -1;
+        }
+
+        const AZ::s32 writerIndex = m_transformWriterIndices[bodyIndex];
+        if (writerIndex < 0 || m_transformWriters[writerIndex].m_bodyHandle != bodyHandle)
+        {
+            return -1;
+        }
+        return writerIndex;
+    }
+
     void PhysXScene::FlushQueuedEvents()
     {
         //send queued trigger events
@@ -766,6 +927,7 @@ namespace PhysX
             }
 
             m_simulatedBodyRemovedEvent.Signal(m_sceneHandle, bodyHandle);
+            UnregisterTransformWriter(bodyHandle);
 
             m_deferredDeletions.push_back(m_simulatedBodies[index].second);
             m_simulatedBodies[index] = AZStd::make_pair(AZ::Crc32(), nullptr);
@@ -950,27 +1112,149 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
         AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        results.resize(requests.size());
+        if (requests.size() < 2 * Internal::MinQueriesPerBatchJob)
         {
-            results.emplace_back(QueryScene(request.get()));
+            QuerySceneRange(requests, 0, requests.size(), results);
+            return results;
         }
+
+        AZ::JobCompletion batchCompletion;
+        StartQueryBatchJobs(requests, results, &batchCompletion);
+        batchCompletion.StartAndWaitForCompletion();
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
+    {
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        auto asyncQuery = AZStd::make_unique<AsyncSceneQuery>();
+        asyncQuery->m_requestId = requestId;
+        asyncQuery->m_request = request;
+        asyncQuery->m_callback = AZStd::move(callback);
+        asyncQuery->m_results.resize(1);
+
+        AsyncSceneQuery* query = asyncQuery.get();
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+        if (m_asyncQueryCompletion == nullptr)
+        {
+            m_asyncQueryCompletion = aznew AZ::JobCompletion();
+        }
+
+        AZ::Job* queryJob = AZ::CreateJobFunction([this, query]()
+            {
+                query->m_results[0] = QueryScene(query->m_request);
+            }, true, nullptr); //auto-deletes
+        queryJob->SetDependent(m_asyncQueryCompletion);
+        queryJob->Start();
+
+        m_asyncQueries.emplace_back(AZStd::move(asyncQuery));
+        return true;
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    {
+        if (!callback)
+        {
+            return false;
+        }
+
+        auto asyncQuery = AZStd::make_unique<AsyncSceneQuery>();
+        asyncQuery->m_requestId = requestId;
+        asyncQuery->m_requests = requests;
+        asyncQuery->m_batchCallback = AZStd::move(callback);
+        asyncQuery->m_results.resize(requests.size());
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+        if (m_asyncQueryCompletion == nullptr)
+        {
+            m_asyncQueryCompletion = aznew AZ::JobCompletion();
+        }
+
+        StartQueryBatchJobs(asyncQuery->m_requests, asyncQuery->m_results, m_asyncQueryCompletion);
+
+        m_asyncQueries.emplace_back(AZStd::move(asyncQuery));
+        return true;
+    }
+
+    void PhysXScene::QuerySceneRange(const AzPhysics::SceneQueryRequests& requests, size_t begin, size_t end, AzPhysics::SceneQueryHitsList& results)
+    {
+        // Hold the read lock across the whole range, the per query locks taken inside QueryScene are then uncontended re-entrant locks.
+        PHYSX_SCENE_READ_LOCK(m_pxScene);
+        for (size_t i = begin; i < end; ++i)
+        {
+            results[i] = QueryScene(requests[i].get());
+        }
+    }
+
+    void PhysXScene::StartQueryBatchJobs(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results, AZ::Job* completionJob)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AZ_Assert(results.size() == requests.size(), "Scene query results must be sized to match the requests");
+        if (requests.empty())
+        {
+            return;
+        }
+
+        // Each job works through a contiguous range using its worker thread's hit buffers, writing straight into its slice of results.
+        const size_t workerCount = AZStd::max<size_t>(1, AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads());
+        const size_t maxJobCount = AZStd::max<size_t>(1, requests.size() / Internal::MinQueriesPerBatchJob);
+        const size_t jobCount = AZStd::min(workerCount, maxJobCount);
+        const size_t queriesPerJob = (requests.size() + jobCount - 1) / jobCount;
+
+        for (size_t begin = 0; begin < requests.size(); begin += queriesPerJob)
+        {
+            const size_t end = AZStd::min(begin + queriesPerJob, requests.size());
+            AZ::Job* queryJob = AZ::CreateJobFunction([this, &requests, &results, begin, end]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "PhysXScene::QueryBatchJob");
+                    QuerySceneRange(requests, begin, end, results);
+                }, true, nullptr); //auto-deletes
+            queryJob->SetDependent(completionJob);
+            queryJob->Start();
+        }
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    void PhysXScene::FlushAsyncSceneQueries()
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AZ::JobCompletion* completion = nullptr;
+        AZStd::vector<AZStd::unique_ptr<AsyncSceneQuery>> asyncQueries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryMutex);
+            completion = m_asyncQueryCompletion;
+            m_asyncQueryCompletion = nullptr;
+            asyncQueries.swap(m_asyncQueries);
+        }
+
+        if (completion == nullptr)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::FlushAsyncSceneQueries");
+        completion->StartAndWaitForCompletion();
+        delete completion;
+
+        // Callbacks are invoked in issue order, and may safely issue further async queries which complete at the next sync point.
+        for (AZStd::unique_ptr<AsyncSceneQuery>& asyncQuery : asyncQueries)
+        {
+            if (asyncQuery->m_batchCallback)
+            {
+                asyncQuery->m_batchCallback(asyncQuery->m_requestId, AZStd::move(asyncQuery->m_results));
+            }
+            else
+            {
+                asyncQuery->m_callback(asyncQuery->m_requestId, AZStd::move(asyncQuery->m_results[0]));
+            }
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
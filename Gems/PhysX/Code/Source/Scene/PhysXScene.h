@@ -12,12 +12,21 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
+namespace AZ
+{
+    class Job;
+    class JobCompletion;
+}
+
 namespace physx
 {
+    class PxActor;
     class PxControllerManager;
     struct PxOverlapHit;
     struct PxRaycastHit;
@@ -27,6 +36,20 @@ namespace physx
 
 namespace PhysX
 {
+    //! Implemented by objects that mirror the simulated pose of a rigid body onto its entity.
+    //! Writers are registered with the PhysXScene that owns the body, which updates all of them in a single pass after each simulation step.
+    class SimulatedTransformWriter
+    {
+    public:
+        virtual ~SimulatedTransformWriter() = default;
+
+        //! Applies the simulated world transform of the body.
+        //! @param bodyTransform The world transform of the body after the simulation step.
+        //! @param fixedDeltaTime The time in seconds simulated by the step.
+        //! @return True if the transform of the entity was changed.
+        virtual bool WriteSimulatedTransform(const AZ::Transform& bodyTransform, float fixedDeltaTime) = 0;
+    };
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene
         : public AzPhysics::Scene
@@ -79,6 +102,21 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Waits for the simulation step started by StartSimulation to complete and fetches its results.
+        //! No events are signaled, so this may be called from a worker thread to overlap the completion of several scenes.
+        //! FinishSimulation calls this if it has not already been called for the current step.
+        void FetchSimulationResults();
+
+        //! Registers a writer to receive the transform of a body after every simulation step in which the body moved.
+        //! @param bodyHandle The body to register the writer for, it must belong to this scene.
+        //! @param writer The writer to update, it must remain valid until it is unregistered or the body is removed.
+        //! @param writeEveryStep If true the writer is also updated after steps in which the body did not move.
+        void RegisterTransformWriter(AzPhysics::SimulatedBodyHandle bodyHandle, SimulatedTransformWriter* writer, bool writeEveryStep);
+
+        //! Unregisters the writer of a body, this is done automatically when the body is removed.
+        //! @param bodyHandle The body to unregister the writer for.
+        void UnregisterTransformWriter(AzPhysics::SimulatedBodyHandle bodyHandle);
+
     private:
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
@@ -90,11 +128,56 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        //! Updates the transform writers of all bodies that moved during the last step and signals the transforms updated event.
+        //! Poses are gathered under a single scene lock before any writer is invoked, so writers are free to modify the scene.
+        void WriteBackTransforms(physx::PxActor** activeActors, physx::PxU32 numActiveActors);
+
+        //! Runs the queries in [begin, end) of a batch on the calling thread, writing the hits to the matching entries of results.
+        void QuerySceneRange(const AzPhysics::SceneQueryRequests& requests, size_t begin, size_t end, AzPhysics::SceneQueryHitsList& results);
+
+        //! Splits a batch of queries into jobs across the job system's worker threads.
+        //! Every started job is made dependent on completionJob, results must be sized to match requests.
+        void StartQueryBatchJobs(const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQueryHitsList& results, AZ::Job* completionJob);
+
+        //! Waits for all outstanding asynchronous scene queries and invokes their callbacks on the calling thread.
+        //! This is the sync point for QuerySceneAsync and QuerySceneAsyncBatch, and is called from FinishSimulation.
+        void FlushAsyncSceneQueries();
+
+        //! An asynchronous scene query in flight, owned by the scene until its callback has been invoked.
+        struct AsyncSceneQuery
+        {
+            AzPhysics::SceneQuery::AsyncRequestId m_requestId = 0;
+            const AzPhysics::SceneQueryRequest* m_request = nullptr; //!< Only used by single queries, owned by the caller.
+            AzPhysics::SceneQueryRequests m_requests; //!< Only used by batched queries, holds a reference to the requests while in flight.
+            AzPhysics::SceneQuery::AsyncCallback m_callback;
+            AzPhysics::SceneQuery::AsyncBatchCallback m_batchCallback;
+            AzPhysics::SceneQueryHitsList m_results;
+        };
+
+        //! A registered transform writer and the pose gathered for it during the last step.
+        struct TransformWriterEntry
+        {
+            AzPhysics::SimulatedBodyHandle m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+            SimulatedTransformWriter* m_writer = nullptr;
+            AzPhysics::SimulatedBody* m_body = nullptr;
+            AZ::Transform m_transform = AZ::Transform::CreateIdentity();
+            bool m_writeEveryStep = false;
+            bool m_moved = false;
+        };
+
+        //! Returns the index of the body's writer in m_transformWriters, or -1 if the body has no writer.
+        AZ::s32 FindTransformWriter(AzPhysics::SimulatedBodyHandle bodyHandle) const;
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
         float m_currentDeltaTime = 0.0f;
 
+        // Results of the current step, set by FetchSimulationResults and consumed by FinishSimulation
+        physx::PxActor** m_activeActors = nullptr; //!< The active actor buffer remains valid until the next simulation step.
+        physx::PxU32 m_numActiveActors = 0;
+        bool m_simulationResultsFetched = false;
+
         AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::SimulatedBody*>> m_simulatedBodies; //this will become a SimulatedBody with LYN-1334
         AZStd::vector<AzPhysics::SimulatedBody*> m_deferredDeletions;
         AZStd::queue<AzPhysics::SimulatedBodyIndex> m_freeSceneSlots;
@@ -118,5 +201,14 @@ namespace PhysX
         physx::PxControllerManager* m_controllerManager = nullptr; //!< The physx controller manager
 
         AZ::Vector3 m_gravity; // cache the gravity of the scene to avoid a lock in GetGravity().
+
+        AZStd::mutex m_asyncQueryMutex; //!< Guards the async query state below, async queries may be issued from any thread.
+        AZ::JobCompletion* m_asyncQueryCompletion = nullptr; //!< Completion for all async query jobs issued since the last sync point.
+        AZStd::vector<AZStd::unique_ptr<AsyncSceneQuery>> m_asyncQueries; //!< Async queries issued since the last sync point, in issue order.
+
+        AZStd::vector<TransformWriterEntry> m_transformWriters; //!< Registered transform writers, stored contiguously and updated in order.
+        AZStd::vector<AZ::s32> m_transformWriterIndices; //!< Index into m_transformWriters for each SimulatedBodyIndex, -1 if the body has no writer.
+        AZStd::vector<AZStd::pair<AzPhysics::SimulatedBodyHandle, AZ::Transform>> m_pendingTransformWrites; //!< Poses gathered for the writers in the current step.
+        AzPhysics::SimulatedBodyHandleList m_updatedTransformBodies; //!< Bodies whose entity transforms were updated in the current step.
     };
 }
@@ -296,6 +296,11 @@ namespace PhysX
         Internal::EventRegisterHelper(m_physxSystem, sceneHandle, handler, &AzPhysics::Scene::RegisterSceneActiveSimulatedBodiesHandler);
     }
 
+    void PhysXSceneInterface::RegisterSceneTransformsUpdatedHandler(AzPhysics::SceneHandle sceneHandle, AzPhysics::SceneEvents::OnSceneTransformsUpdatedEvent::Handler& handler)
+    {
+        Internal::EventRegisterHelper(m_physxSystem, sceneHandle, handler, &AzPhysics::Scene::RegisterSceneTransformsUpdatedHandler);
+    }
+
     void PhysXSceneInterface::RegisterSceneCollisionEventHandler(AzPhysics::SceneHandle sceneHandle,
         AzPhysics::SceneEvents::OnSceneCollisionsEvent::Handler& handler)
     {
@@ -372,6 +372,34 @@ namespace PhysX
         return RayCastInternal(localSpaceRequest, localPose);
     }
 
+    bool Shape::Overlap(const AzPhysics::OverlapRequest& worldSpaceRequest, const AZ::Transform& worldTransform)
+    {
+        if (!m_pxShape || !worldSpaceRequest.m_shapeConfiguration)
+        {
+            return false;
+        }
+
+        if (const bool shouldCollide = worldSpaceRequest.m_collisionGroup.GetMask() & m_collisionLayer.GetMask();
+            !shouldCollide)
+        {
+            return false;
+        }
+
+        physx::PxGeometryHolder requestGeometry;
+        if (!Utils::CreatePxGeometryFromConfig(*worldSpaceRequest.m_shapeConfiguration, requestGeometry))
+        {
+            return false;
+        }
+
+        physx::PxTransform localPose;
+        {
+            PHYSX_SCENE_READ_LOCK(GetScene());
+            localPose = m_pxShape->getLocalPose();
+        }
+        return physx::PxGeometryQuery::overlap(requestGeometry.any(), PxMathConvert(worldSpaceRequest.m_pose),
+                                               m_pxShape->getGeometry().any(), PxMathConvert(worldTransform) * localPose);
+    }
+
     AZ::Aabb Shape::GetAabb(const AZ::Transform& worldTransform) const
     {
         physx::PxTransform localPose;
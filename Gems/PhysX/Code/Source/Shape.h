@@ -84,6 +84,11 @@ namespace PhysX
         //! @param request Ray parameters in local space.
         AzPhysics::SceneQueryHit RayCastLocal(const AzPhysics::RayCastRequest& localSpaceRequest) override;
 
+        //! Overlap test against this shape.
+        //! @param request Overlap parameters in world space.
+        //! @param worldTransform World transform of this shape.
+        bool Overlap(const AzPhysics::OverlapRequest& worldSpaceRequest, const AZ::Transform& worldTransform) override;
+
         //! Retrieve this shape AABB.
         //! @param worldTransform World transform of this shape.
         AZ::Aabb GetAabb(const AZ::Transform& worldTransform) const override;
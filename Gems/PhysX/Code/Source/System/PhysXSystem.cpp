@@ -5,8 +5,11 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskExecutor.h>
 
 #include <Scene/PhysXScene.h>
 #include <System/PhysXSystem.h>
@@ -124,6 +127,10 @@ namespace PhysX
         // for system components, causing any hanging asset references to become crashes on shutdown in release builds.
         m_systemConfig.m_materialLibraryAsset.Reset();
 
+        m_fetchResultsGraph.Reset();
+        m_fetchResultsScenes.clear();
+        m_sceneTaskExecutor.reset();
+
         m_accumulatedTime = 0.0f;
         m_state = State::Shutdown;
     }
@@ -140,13 +147,13 @@ namespace PhysX
 
         auto simulateScenes = [this](float timeStep)
         {
-            for (auto& scenePtr : m_sceneList)
+            if (m_systemConfig.m_parallelSceneSimulation)
             {
-                if (scenePtr != nullptr && scenePtr->IsEnabled())
-                {
-                    scenePtr->StartSimulation(timeStep);
-                    scenePtr->FinishSimulation();
-                }
+                SimulateScenesParallel(timeStep);
+            }
+            else
+            {
+                SimulateScenes(timeStep);
             }
         };
 
@@ -196,6 +203,102 @@ namespace PhysX
         m_postSimulateEvent.Signal(tickTime);
     }
 
+    void PhysXSystem::SimulateScenes(float timeStep)
+    {
+        for (auto& scenePtr : m_sceneList)
+        {
+            if (scenePtr != nullptr && scenePtr->IsEnabled())
+            {
+                scenePtr->StartSimulation(timeStep);
+                scenePtr->FinishSimulation();
+            }
+        }
+    }
+
+    void PhysXSystem::SimulateScenesParallel(float timeStep)
+    {
+        m_simulatingScenes.clear();
+        m_simulatingSceneIndices.clear();
+        for (size_t index = 0; index < m_sceneList.size(); ++index)
+        {
+            if (auto& scenePtr = m_sceneList[index];
+                scenePtr != nullptr && scenePtr->IsEnabled())
+            {
+                m_simulatingScenes.push_back(static_cast<PhysXScene*>(scenePtr.get()));
+                m_simulatingSceneIndices.push_back(static_cast<AzPhysics::SceneIndex>(index));
+            }
+        }
+
+        // Nothing to overlap with a single scene
+        if (m_simulatingScenes.size() < 2)
+        {
+            SimulateScenes(timeStep);
+            return;
+        }
+
+        // Scene events may remove scenes, so each scene is checked to still be alive before it is used
+        auto getSimulatingScene = [this](size_t i) -> PhysXScene*
+        {
+            const AzPhysics::SceneIndex index = m_simulatingSceneIndices[i];
+            if (index < m_sceneList.size() && m_sceneList[index].get() == m_simulatingScenes[i])
+            {
+                return m_simulatingScenes[i];
+            }
+            return nullptr;
+        };
+
+        // Every scene dispatches its simulation tasks before any scene is waited on
+        for (size_t i = 0; i < m_simulatingScenes.size(); ++i)
+        {
+            if (PhysXScene* scene = getSimulatingScene(i))
+            {
+                scene->StartSimulation(timeStep);
+            }
+        }
+
+        bool allScenesAlive = true;
+        for (size_t i = 0; i < m_simulatingScenes.size(); ++i)
+        {
+            allScenesAlive = allScenesAlive && getSimulatingScene(i) != nullptr;
+        }
+
+        // If a scene was removed the results are fetched by FinishSimulation instead, one scene at a time
+        if (allScenesAlive)
+        {
+            if (!m_sceneTaskExecutor)
+            {
+                const AZ::u32 workerCount = AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+                m_sceneTaskExecutor = AZStd::make_unique<AZ::TaskExecutor>(AZStd::max(workerCount, 1u));
+            }
+
+            if (m_fetchResultsScenes != m_simulatingScenes)
+            {
+                m_fetchResultsGraph.Reset();
+                const AZ::TaskDescriptor fetchResultsDescriptor{ "PhysXScene::FetchSimulationResults", "Physics" };
+                for (PhysXScene* scene : m_simulatingScenes)
+                {
+                    m_fetchResultsGraph.AddTask(fetchResultsDescriptor, [scene]()
+                        {
+                            scene->FetchSimulationResults();
+                        });
+                }
+                m_fetchResultsScenes = m_simulatingScenes;
+            }
+
+            AZ_PROFILE_SCOPE(Physics, "PhysXSystem::FetchSimulationResults");
+            m_fetchResultsGraph.SubmitOnExecutor(*m_sceneTaskExecutor, &m_fetchResultsEvent);
+            m_fetchResultsEvent.Wait();
+        }
+
+        for (size_t i = 0; i < m_simulatingScenes.size(); ++i)
+        {
+            if (PhysXScene* scene = getSimulatingScene(i))
+            {
+                scene->FinishSimulation();
+            }
+        }
+    }
+
     AzPhysics::SceneHandle PhysXSystem::AddScene(const AzPhysics::SceneConfiguration& config)
     {
         if (config.m_sceneName.empty())
@@ -10,6 +10,7 @@
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Asset/AssetCatalogBus.h>
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/SystemConfiguration.h>
@@ -33,6 +34,8 @@ namespace physx
 
 namespace PhysX
 {
+    class PhysXScene;
+
     class PhysXSystem
         : public AZ::Interface<AzPhysics::SystemInterface>::Registrar
         , private AzFramework::AssetCatalogEventBus::Handler
@@ -91,6 +94,15 @@ namespace PhysX
         void ShutdownPhysXSdk();
         bool LoadMaterialLibrary();
 
+        //! Runs a single step of all enabled scenes, one scene at a time.
+        void SimulateScenes(float timeStep);
+
+        //! Runs a single step of all enabled scenes, overlapping their simulation.
+        //! All scenes are started in scene order, the results of every scene are then fetched concurrently on the scene task
+        //! executor, and finally each scene is finished in scene order. Events are therefore signaled in the same order
+        //! as SimulateScenes, and no scene begins the next step before all scenes have finished this one.
+        void SimulateScenesParallel(float timeStep);
+
         // AzFramework::AssetCatalogEventBus::Handler ...
         void OnCatalogLoaded(const char* catalogFile) override;
 
@@ -114,6 +126,15 @@ namespace PhysX
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
 
+        // State for SimulateScenesParallel. Fetching results blocks until PhysX finishes the step, which runs on the
+        // job system through the cpu dispatcher, so fetches run on a separate task executor to never stall those jobs.
+        AZStd::unique_ptr<AZ::TaskExecutor> m_sceneTaskExecutor;
+        AZ::TaskGraph m_fetchResultsGraph; //!< One task per scene in m_fetchResultsScenes, rebuilt when the enabled scenes change.
+        AZ::TaskGraphEvent m_fetchResultsEvent;
+        AZStd::vector<PhysXScene*> m_fetchResultsScenes; //!< The scenes m_fetchResultsGraph was built for.
+        AZStd::vector<PhysXScene*> m_simulatingScenes; //!< The enabled scenes of the current step, in scene order.
+        AZStd::vector<AzPhysics::SceneIndex> m_simulatingSceneIndices; //!< The index in m_sceneList of each scene in m_simulatingScenes.
+
         enum class State : AZ::u8
         {
             Uninitialized = 0,
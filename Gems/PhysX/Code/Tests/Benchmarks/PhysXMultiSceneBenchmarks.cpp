@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzFramework/Physics/PhysicsSystem.h>
+
+#include <Benchmarks/PhysXBenchmarksUtilities.h>
+#include <Benchmarks/PhysXBenchmarksCommon.h>
+#include <Benchmarks/PhysXBenchmarkWashingMachine.h>
+
+#include <PhysX/Configuration/PhysXConfiguration.h>
+#include <PhysXTestCommon.h>
+
+namespace PhysX::Benchmarks
+{
+    namespace MultiSceneConstants
+    {
+        //! Controls the simulation length of the test. 5secs at 60fps
+        static const int GameFramesToSimulate = 300;
+
+        //! The number of rigid bodies spawned in each scene
+        static const int RigidBodiesPerScene = 256;
+
+        //! Constant seed to use with random number generation
+        static const long long RandGenSeed = 8010412111588; //(Number generated by concatenating 'PhysX' ascii character codes (80 104 121 115 88).
+
+        //! Constants for setting up the washing machine in each scene
+        namespace WashingMachine
+        {
+            static const float Radius = 50.0f;
+            static const float CylinderHeight = 100.0f;
+            static const float BladeRPM = 10.0f;
+            static const float BoxSize = 2.0f;
+        } // namespace WashingMachine
+
+        //! Settings used to setup each benchmark
+        namespace BenchmarkSettings
+        {
+            //! Values passed to benchmark to select the number of scenes to simulate during each test
+            static const int StartRange = 1;
+            static const int EndRange = 16;
+            static const int RangeMultipler = 2;
+
+            //! Number of iterations for each test
+            static const int NumIterations = 3;
+        } // namespace BenchmarkSettings
+    } // namespace MultiSceneConstants
+
+    //! Multi scene performance fixture.
+    //! Will create the requested number of scenes, each with a washing machine full of rigid bodies,
+    //! to emulate several independent matches hosted by one process.
+    class PhysXMultiSceneBenchmarkFixture
+        : public benchmark::Fixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            if (const auto* config = azdynamic_cast<const PhysXSystemConfiguration*>(physicsSystem->GetConfiguration()))
+            {
+                m_preBenchmarkConfig = *config;
+            }
+
+            PhysXSystemConfiguration config = m_preBenchmarkConfig;
+            config.m_parallelSceneSimulation = state.range(1) != 0;
+            physicsSystem->UpdateConfiguration(&config);
+
+            AZ::SimpleLcgRandom rand;
+            rand.SetSeed(MultiSceneConstants::RandGenSeed);
+
+            const AZ::Vector3 washingMachineCentre = AZ::Vector3::CreateZero();
+            auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(MultiSceneConstants::WashingMachine::BoxSize));
+            Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+            {
+                return boxShapeConfiguration;
+            };
+            Utils::GenerateSpawnPositionFuncPtr posGenerator = [washingMachineCentre, &rand](int idx) -> const AZ::Vector3 {
+                const float spawnArea = MultiSceneConstants::WashingMachine::Radius;
+                const float x = washingMachineCentre.GetX() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+                const float y = washingMachineCentre.GetY() + (rand.GetRandomFloat() - 0.5f) * spawnArea;
+                const float z = washingMachineCentre.GetZ() + MultiSceneConstants::WashingMachine::BoxSize * (idx + 1);
+                return AZ::Vector3(x, y, z);
+            };
+
+            const int numScenes = static_cast<int>(state.range(0));
+            for (int sceneIdx = 0; sceneIdx < numScenes; sceneIdx++)
+            {
+                AzPhysics::SceneConfiguration sceneConfiguration = AzPhysics::SceneConfiguration::CreateDefault();
+                sceneConfiguration.m_sceneName = AZStd::string::format("BenchmarkMatch-%d", sceneIdx);
+                AzPhysics::SceneHandle sceneHandle = physicsSystem->AddScene(sceneConfiguration);
+                m_sceneHandles.push_back(sceneHandle);
+
+                auto washingMachine = AZStd::make_unique<WashingMachine>();
+                washingMachine->SetupWashingMachine(sceneHandle, MultiSceneConstants::WashingMachine::Radius,
+                    MultiSceneConstants::WashingMachine::CylinderHeight, washingMachineCentre, MultiSceneConstants::WashingMachine::BladeRPM);
+                m_washingMachines.push_back(AZStd::move(washingMachine));
+
+                // every scene gets the same bodies, so each one has the same amount of work
+                rand.SetSeed(MultiSceneConstants::RandGenSeed);
+                Utils::CreateRigidBodies(MultiSceneConstants::RigidBodiesPerScene, physicsSystem->GetScene(sceneHandle),
+                    false, &colliderGenerator, &posGenerator);
+            }
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_washingMachines.clear();
+
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            physicsSystem->RemoveScenes(m_sceneHandles);
+            m_sceneHandles.clear();
+
+            physicsSystem->UpdateConfiguration(&m_preBenchmarkConfig);
+            TestUtils::ResetPhysXSystem();
+        }
+
+    protected:
+        PhysXSystemConfiguration m_preBenchmarkConfig;
+        AzPhysics::SceneHandleList m_sceneHandles;
+        AZStd::vector<AZStd::unique_ptr<WashingMachine>> m_washingMachines;
+    };
+
+    //! BM_MultiScene_Simulate - This test will create the requested number of scenes, each with a washing machine
+    //! full of rigid bodies, and step all of them through the physics system, either one scene at a time or in parallel.
+    //! The test will run the simulation for ~300 game frames at 60fps.
+    BENCHMARK_DEFINE_F(PhysXMultiSceneBenchmarkFixture, BM_MultiScene_Simulate)(benchmark::State& state)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+
+        Types::TimeList tickTimes;
+        for (auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < MultiSceneConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::system_clock::now();
+                physicsSystem->Simulate(DefaultTimeStep);
+
+                //time each frame and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::system_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportPercentiles(state, tickTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, tickTimes);
+    }
+
+    BENCHMARK_REGISTER_F(PhysXMultiSceneBenchmarkFixture, BM_MultiScene_Simulate)
+        ->ArgNames({ "Scenes", "Parallel" })
+        ->RangeMultiplier(MultiSceneConstants::BenchmarkSettings::RangeMultipler)
+        ->Ranges({ {MultiSceneConstants::BenchmarkSettings::StartRange, MultiSceneConstants::BenchmarkSettings::EndRange}, {0, 1} })
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(MultiSceneConstants::BenchmarkSettings::NumIterations)
+        ;
+} // namespace PhysX::Benchmarks
+#endif //HAVE_BENCHMARK
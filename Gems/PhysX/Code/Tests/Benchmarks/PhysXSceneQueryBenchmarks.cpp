@@ -13,6 +13,7 @@
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/Configuration/SystemConfiguration.h>
 #include <Tests/PhysXGenericTestFixture.h>
 #include <Tests/PhysXTestCommon.h>
 #include <Benchmarks/PhysXBenchmarksCommon.h>
@@ -40,6 +41,9 @@ namespace PhysX::Benchmarks
             {{512, 1024}, {32, 512}},
             {{2048, 4096}, {64, 512}}
         };
+
+        //! Number of raycasts issued per iteration of the batched benchmarks, roughly a server tick of line of sight and hitscan traces.
+        static const size_t RaycastsPerBatch = 2048;
     }
 
     class PhysXSceneQueryBenchmarkFixture
@@ -108,6 +112,22 @@ namespace PhysX::Benchmarks
         }
 
     protected:
+        //! Creates RaycastsPerBatch raycasts from the origin towards the spawned boxes.
+        AzPhysics::SceneQueryRequests CreateRaycastBatch() const
+        {
+            AzPhysics::SceneQueryRequests requests;
+            requests.reserve(SceneQueryConstants::RaycastsPerBatch);
+            for (size_t i = 0; i < SceneQueryConstants::RaycastsPerBatch; ++i)
+            {
+                auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+                request->m_start = AZ::Vector3::CreateZero();
+                request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+                request->m_distance = 2000.0f;
+                requests.emplace_back(AZStd::move(request));
+            }
+            return requests;
+        }
+
         std::vector<EntityPtr> m_entities;
         std::vector<AZ::Vector3> m_boxes;
         AZ::u32 m_numBoxes = 0;
@@ -209,6 +229,61 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchSerialRandomBoxes)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            // Baseline, the same batch issued one query at a time on the calling thread
+            for (const auto& request : requests)
+            {
+                AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(m_testSceneHandle, request.get());
+                benchmark::DoNotOptimize(result);
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+            benchmark::DoNotOptimize(results);
+        }
+
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastBatch();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        // Models a server tick, the batch is issued alongside the simulation and the hits are delivered when it finishes
+        size_t hitCount = 0;
+        for (auto _ : state)
+        {
+            sceneInterface->StartSimulation(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 0, requests,
+                [&hitCount](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList results)
+                {
+                    hitCount += results.size();
+                });
+            benchmark::DoNotOptimize(queued);
+            sceneInterface->FinishSimulation(m_testSceneHandle);
+        }
+
+        benchmark::DoNotOptimize(hitCount);
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -233,5 +308,23 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchSerialRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[1])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[1])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[1])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+
+#include <Source/Pipeline/MeshCookingCache.h>
+
+namespace PhysX::Pipeline
+{
+    static AZStd::string GetTestKey(float vertexOffset)
+    {
+        const AZStd::vector<float> vertices = { 0.0f, 0.0f, vertexOffset, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+        const AZStd::vector<AZ::u32> indices = { 0, 1, 2 };
+
+        MeshCookingCache::KeyBuilder keyBuilder;
+        return keyBuilder
+            .AppendString("pc")
+            .AppendValue(true)
+            .AppendArray(vertices)
+            .AppendArray(indices)
+            .GetKey();
+    }
+
+    TEST(MeshCookingCacheTest, KeyBuilder_SameInputs_ProduceSameKey)
+    {
+        EXPECT_EQ(GetTestKey(0.0f), GetTestKey(0.0f));
+        EXPECT_EQ(GetTestKey(0.0f).size(), 40u);
+    }
+
+    TEST(MeshCookingCacheTest, KeyBuilder_DifferentInputs_ProduceDifferentKeys)
+    {
+        EXPECT_NE(GetTestKey(0.0f), GetTestKey(0.5f));
+    }
+
+    TEST(MeshCookingCacheTest, KeyBuilder_ArrayBoundaries_ContributeToKey)
+    {
+        const AZStd::vector<AZ::u8> first = { 1, 2 };
+        const AZStd::vector<AZ::u8> second = { 3 };
+        const AZStd::vector<AZ::u8> firstShifted = { 1 };
+        const AZStd::vector<AZ::u8> secondShifted = { 2, 3 };
+
+        MeshCookingCache::KeyBuilder keyBuilder;
+        MeshCookingCache::KeyBuilder shiftedKeyBuilder;
+        EXPECT_NE(
+            keyBuilder.AppendArray(first).AppendArray(second).GetKey(),
+            shiftedKeyBuilder.AppendArray(firstShifted).AppendArray(secondShifted).GetKey());
+    }
+
+    TEST(MeshCookingCacheTest, StoreThenLoad_ReturnsStoredData)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        MeshCookingCache cache(tempDirectory.GetDirectory());
+        ASSERT_TRUE(cache.IsEnabled());
+
+        const AZStd::string key = GetTestKey(0.0f);
+        const AZStd::vector<AZ::u8> cookedData = { 'N', 'X', 'S', 1, 2, 3, 4 };
+
+        AZStd::vector<AZ::u8> loadedData;
+        EXPECT_FALSE(cache.Load(key, loadedData));
+
+        cache.Store(key, cookedData);
+        EXPECT_TRUE(cache.Load(key, loadedData));
+        EXPECT_EQ(loadedData, cookedData);
+
+        EXPECT_FALSE(cache.Load(GetTestKey(0.5f), loadedData));
+        EXPECT_TRUE(loadedData.empty());
+    }
+
+    TEST(MeshCookingCacheTest, Store_ExistingEntry_IsReplaced)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        MeshCookingCache cache(tempDirectory.GetDirectory());
+
+        const AZStd::string key = GetTestKey(0.0f);
+        const AZStd::vector<AZ::u8> newData = { 5, 6 };
+        cache.Store(key, { 1, 2, 3 });
+        cache.Store(key, newData);
+
+        AZStd::vector<AZ::u8> loadedData;
+        EXPECT_TRUE(cache.Load(key, loadedData));
+        EXPECT_EQ(loadedData, newData);
+    }
+} // namespace PhysX::Pipeline
@@ -7,6 +7,7 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/MathUtils.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1009,4 +1010,132 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_MatchesSerialQueries)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies around the origin, large enough batches are split across jobs
+        constexpr size_t NumBodies = 16;
+        constexpr size_t NumRequests = 512;
+        AZStd::vector<AZ::Vector3> positions;
+        for (size_t i = 0; i < NumBodies; ++i)
+        {
+            const float angle = AZ::Constants::TwoPi * static_cast<float>(i) / static_cast<float>(NumBodies);
+            positions.emplace_back(AZ::Vector3(10.0f * cosf(angle), 10.0f * sinf(angle), 0.0f));
+            TestUtils::AddSphereToScene(m_testSceneHandle, positions.back(), 1.0f);
+        }
+
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % NumBodies].GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //every result should match the equivalent serial query, in request order
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const AzPhysics::SceneQueryHits expected = sceneInterface->QueryScene(m_testSceneHandle, requests[i].get());
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            ASSERT_EQ(expected.m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == expected.m_hits[0].m_bodyHandle);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackInvokedAtFinishSimulation)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+
+        constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 42;
+        int callbackCount = 0;
+        AzPhysics::SceneQueryHits callbackHits;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, RequestId, &request,
+            [&callbackCount, &callbackHits](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+            {
+                EXPECT_EQ(requestId, RequestId);
+                callbackHits = AZStd::move(hits);
+                ++callbackCount;
+            });
+        ASSERT_TRUE(queued);
+
+        //callbacks are only delivered at the scene's sync point
+        EXPECT_EQ(callbackCount, 0);
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        EXPECT_EQ(callbackCount, 1);
+        ASSERT_EQ(callbackHits.m_hits.size(), 1);
+        EXPECT_TRUE(callbackHits.m_hits[0].m_bodyHandle == sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_ReturnsExpectedHitsInOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        //queue enough requests that the batch is split across several jobs
+        constexpr size_t NumRequests = 256;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % positions.size()].GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AZStd::vector<AzPhysics::SceneQuery::AsyncRequestId> callbackOrder;
+        AzPhysics::SceneQueryHitsList results;
+        for (AzPhysics::SceneQuery::AsyncRequestId requestId = 0; requestId < 2; ++requestId)
+        {
+            const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, requestId, requests,
+                [&callbackOrder, &results](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHitsList hits)
+                {
+                    callbackOrder.push_back(requestId);
+                    results = AZStd::move(hits);
+                });
+            ASSERT_TRUE(queued);
+        }
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        //callbacks are delivered in the order the queries were issued
+        ASSERT_EQ(callbackOrder.size(), 2);
+        EXPECT_EQ(callbackOrder[0], 0);
+        EXPECT_EQ(callbackOrder[1], 1);
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i % simBodies.size()]);
+        }
+    }
 }
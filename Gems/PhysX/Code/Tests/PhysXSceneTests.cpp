@@ -11,6 +11,7 @@
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <Scene/PhysXScene.h>
 
 namespace PhysX
 {
@@ -585,4 +586,78 @@ namespace PhysX
 
         EXPECT_TRUE(handlerTriggered);
     }
+
+    class TestTransformWriter
+        : public SimulatedTransformWriter
+    {
+    public:
+        bool WriteSimulatedTransform(const AZ::Transform& bodyTransform, [[maybe_unused]] float fixedDeltaTime) override
+        {
+            m_writeCount++;
+            m_lastTransform = bodyTransform;
+            return true;
+        }
+
+        int m_writeCount = 0;
+        AZ::Transform m_lastTransform = AZ::Transform::CreateIdentity();
+    };
+
+    TEST_F(PhysXSceneFixture, TransformWriters_OnlyMovedBodiesAreWritten)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* scene = azdynamic_cast<PhysXScene*>(physicsSystem->GetScene(m_testSceneHandle));
+        ASSERT_NE(scene, nullptr);
+
+        AzPhysics::ShapeColliderPair shapeColliderData(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3::CreateOne()));
+
+        // a falling rigid body, expected to be written every step
+        AzPhysics::RigidBodyConfiguration fallingConfig;
+        fallingConfig.m_colliderAndShapeData = shapeColliderData;
+        AzPhysics::SimulatedBodyHandle fallingHandle = sceneInterface->AddSimulatedBody(m_testSceneHandle, &fallingConfig);
+
+        // a sleeping rigid body, only expected to be written when the writer asks for every step
+        AzPhysics::RigidBodyConfiguration sleepingConfig;
+        sleepingConfig.m_colliderAndShapeData = shapeColliderData;
+        sleepingConfig.m_position = AZ::Vector3(10.0f, 0.0f, 0.0f);
+        sleepingConfig.m_startAsleep = true;
+        AzPhysics::SimulatedBodyHandle sleepingHandle = sceneInterface->AddSimulatedBody(m_testSceneHandle, &sleepingConfig);
+        sleepingConfig.m_position = AZ::Vector3(-10.0f, 0.0f, 0.0f);
+        AzPhysics::SimulatedBodyHandle everyStepHandle = sceneInterface->AddSimulatedBody(m_testSceneHandle, &sleepingConfig);
+
+        TestTransformWriter fallingWriter;
+        TestTransformWriter sleepingWriter;
+        TestTransformWriter everyStepWriter;
+        scene->RegisterTransformWriter(fallingHandle, &fallingWriter, false);
+        scene->RegisterTransformWriter(sleepingHandle, &sleepingWriter, false);
+        scene->RegisterTransformWriter(everyStepHandle, &everyStepWriter, true);
+
+        AzPhysics::SimulatedBodyHandleList updatedBodies;
+        AzPhysics::SceneEvents::OnSceneTransformsUpdatedEvent::Handler transformsUpdatedHandler(
+            [&updatedBodies]([[maybe_unused]] AzPhysics::SceneHandle sceneHandle, const AzPhysics::SimulatedBodyHandleList& bodies)
+            {
+                updatedBodies = bodies;
+            });
+        sceneInterface->RegisterSceneTransformsUpdatedHandler(m_testSceneHandle, transformsUpdatedHandler);
+
+        constexpr int numSteps = 3;
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, numSteps);
+
+        EXPECT_EQ(fallingWriter.m_writeCount, numSteps);
+        EXPECT_EQ(sleepingWriter.m_writeCount, 0);
+        EXPECT_EQ(everyStepWriter.m_writeCount, numSteps);
+        EXPECT_LT(fallingWriter.m_lastTransform.GetTranslation().GetZ(), 0.0f);
+
+        ASSERT_EQ(updatedBodies.size(), 2);
+        EXPECT_NE(AZStd::find(updatedBodies.begin(), updatedBodies.end(), fallingHandle), updatedBodies.end());
+        EXPECT_NE(AZStd::find(updatedBodies.begin(), updatedBodies.end(), everyStepHandle), updatedBodies.end());
+
+        // removing a body also removes its writer
+        sceneInterface->RemoveSimulatedBody(m_testSceneHandle, fallingHandle);
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+        EXPECT_EQ(fallingWriter.m_writeCount, numSteps);
+        EXPECT_EQ(everyStepWriter.m_writeCount, numSteps + 1);
+    }
 }
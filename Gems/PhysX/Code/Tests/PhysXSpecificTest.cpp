@@ -303,6 +303,27 @@ namespace PhysX
         EXPECT_TRUE(strcmp(nativePointer->getConcreteTypeName(), "PxRigidDynamic") == 0);
     }
 
+    TEST_F(PhysXSpecificTest, Shape_Overlap_TestsExactGeometryAtProvidedTransform)
+    {
+        Physics::BoxShapeConfiguration shapeConfig(AZ::Vector3(2.0f));
+        Physics::ColliderConfiguration colliderConfig;
+        AZStd::shared_ptr<Physics::Shape> shape = AZ::Interface<Physics::System>::Get()->CreateShape(colliderConfig, shapeConfig);
+        ASSERT_TRUE(shape != nullptr);
+        const AZ::Transform shapeTransform = AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 0.0f, 0.0f));
+
+        // Overlaps the +x face of the box
+        AzPhysics::OverlapRequest hitRequest = AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(
+            0.5f, AZ::Transform::CreateTranslation(AZ::Vector3(11.3f, 0.0f, 0.0f)));
+        EXPECT_TRUE(shape->Overlap(hitRequest, shapeTransform));
+        EXPECT_FALSE(shape->Overlap(hitRequest, AZ::Transform::CreateIdentity()));
+
+        // Just outside the corner of the box, while the bounds of the sphere and the box still overlap
+        AzPhysics::OverlapRequest nearMissRequest = AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(
+            0.5f, AZ::Transform::CreateTranslation(AZ::Vector3(11.4f, 1.4f, 1.4f)));
+        EXPECT_TRUE(shape->GetAabb(shapeTransform).Overlaps(AZ::Aabb::CreateCenterRadius(AZ::Vector3(11.4f, 1.4f, 1.4f), 0.5f)));
+        EXPECT_FALSE(shape->Overlap(nearMissRequest, shapeTransform));
+    }
+
     TEST_F(PhysXSpecificTest, TriggerArea_RigidBodyEnteringAndLeavingTrigger_EnterLeaveCallbackCalled)
     {
         // set up a trigger box
@@ -11,6 +11,8 @@
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/PhysicsScene.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
+#include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
+#include <AzFramework/Physics/SimulatedBodies/RigidBody.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
 
@@ -317,4 +319,74 @@ namespace PhysX
         physicsSystem->RemoveScenes(sceneHandles);
         EXPECT_EQ(removedCount, m_sceneConfigs.size());
     }
+
+    TEST_F(PhysXSystemFixture, ParallelSceneSimulation_MatchesSerialSimulation)
+    {
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        PhysXSystemConfiguration preTestConfig;
+        if (const auto* config = azdynamic_cast<const PhysXSystemConfiguration*>(physicsSystem->GetConfiguration()))
+        {
+            preTestConfig = *config;
+        }
+
+        // Adds the scenes with a falling box in each, simulates them and returns the final position of each box
+        auto simulateScenes = [this, physicsSystem, sceneInterface](bool parallel, AzPhysics::SceneHandleList& finishOrder)
+        {
+            PhysXSystemConfiguration config = *azdynamic_cast<const PhysXSystemConfiguration*>(physicsSystem->GetConfiguration());
+            config.m_parallelSceneSimulation = parallel;
+            physicsSystem->UpdateConfiguration(&config);
+
+            AzPhysics::SceneHandleList sceneHandles = physicsSystem->AddScenes(m_sceneConfigs);
+            AzPhysics::SimulatedBodyHandleList bodyHandles;
+            AZStd::vector<AzPhysics::SceneEvents::OnSceneSimulationFinishHandler> finishHandlers;
+            finishHandlers.reserve(sceneHandles.size());
+            for (size_t i = 0; i < sceneHandles.size(); i++)
+            {
+                AzPhysics::RigidBodyConfiguration bodyConfig;
+                bodyConfig.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(
+                    AZStd::make_shared<Physics::ColliderConfiguration>(),
+                    AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3::CreateOne()));
+                bodyConfig.m_position = AZ::Vector3(0.0f, 0.0f, static_cast<float>(i));
+                bodyConfig.m_initialAngularVelocity = AZ::Vector3(0.0f, 1.0f, static_cast<float>(i));
+                bodyHandles.push_back(sceneInterface->AddSimulatedBody(sceneHandles[i], &bodyConfig));
+
+                finishHandlers.emplace_back([&finishOrder](AzPhysics::SceneHandle sceneHandle, [[maybe_unused]] float fixedDeltaTime)
+                    {
+                        finishOrder.push_back(sceneHandle);
+                    });
+                sceneInterface->RegisterSceneSimulationFinishHandler(sceneHandles[i], finishHandlers.back());
+            }
+
+            for (int frame = 0; frame < 60; frame++)
+            {
+                physicsSystem->Simulate(AzPhysics::SystemConfiguration::DefaultFixedTimestep);
+            }
+
+            AZStd::vector<AZ::Transform> transforms;
+            for (size_t i = 0; i < sceneHandles.size(); i++)
+            {
+                transforms.push_back(sceneInterface->GetSimulatedBodyFromHandle(sceneHandles[i], bodyHandles[i])->GetTransform());
+            }
+            finishHandlers.clear();
+            physicsSystem->RemoveScenes(sceneHandles);
+            return transforms;
+        };
+
+        AzPhysics::SceneHandleList serialFinishOrder;
+        AzPhysics::SceneHandleList parallelFinishOrder;
+        const AZStd::vector<AZ::Transform> serialTransforms = simulateScenes(false, serialFinishOrder);
+        const AZStd::vector<AZ::Transform> parallelTransforms = simulateScenes(true, parallelFinishOrder);
+
+        // every scene should take the same steps and finish them in the same order
+        ASSERT_EQ(serialTransforms.size(), parallelTransforms.size());
+        for (size_t i = 0; i < serialTransforms.size(); i++)
+        {
+            EXPECT_TRUE(serialTransforms[i].IsClose(parallelTransforms[i]));
+        }
+        EXPECT_EQ(serialFinishOrder, parallelFinishOrder);
+
+        physicsSystem->UpdateConfiguration(&preTestConfig);
+    }
 }
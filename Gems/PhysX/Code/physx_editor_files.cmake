@@ -35,6 +35,8 @@ set(FILES
     Source/Pipeline/MeshGroup.h
     Source/Pipeline/MeshBehavior.cpp
     Source/Pipeline/MeshBehavior.h
+    Source/Pipeline/MeshCookingCache.cpp
+    Source/Pipeline/MeshCookingCache.h
     Source/Pipeline/PrimitiveShapeFitter/PrimitiveShapeFitter.cpp
     Source/Pipeline/PrimitiveShapeFitter/PrimitiveShapeFitter.h
     Source/Pipeline/PrimitiveShapeFitter/AbstractShapeParameterization.cpp
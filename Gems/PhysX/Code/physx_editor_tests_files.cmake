@@ -24,6 +24,7 @@ set(FILES
     Tests/StaticRigidBodyComponentTests.cpp
     Tests/PrimitiveShapeFitterTests.cpp
     Tests/PrimitiveShapeFitterTestData.cpp
+    Tests/MeshCookingCacheTests.cpp
     Tests/ShapeGeometryTests.cpp
     Tests/EditorCharacterControllerTests.cpp
 )
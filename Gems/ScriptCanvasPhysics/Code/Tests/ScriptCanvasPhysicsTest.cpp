@@ -129,6 +129,9 @@ namespace ScriptCanvasPhysicsTests
         void RegisterSceneActiveSimulatedBodiesHandler(
             [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
             [[maybe_unused]] AzPhysics::SceneEvents::OnSceneActiveSimulatedBodiesEvent::Handler& handler) override {}
+        void RegisterSceneTransformsUpdatedHandler(
+            [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
+            [[maybe_unused]] AzPhysics::SceneEvents::OnSceneTransformsUpdatedEvent::Handler& handler) override {}
         void RegisterSceneCollisionEventHandler(
             [[maybe_unused]] AzPhysics::SceneHandle sceneHandle,
             [[maybe_unused]] AzPhysics::SceneEvents::OnSceneCollisionsEvent::Handler& handler) override {}
@@ -194,6 +197,7 @@ namespace ScriptCanvasPhysicsTests
         MOCK_METHOD0(DetachedFromActor, void());
         MOCK_METHOD2(RayCast, AzPhysics::SceneQueryHit(const AzPhysics::RayCastRequest& worldSpaceRequest, const AZ::Transform& worldTransform));
         MOCK_METHOD1(RayCastLocal, AzPhysics::SceneQueryHit(const AzPhysics::RayCastRequest& localSpaceRequest));
+        MOCK_METHOD2(Overlap, bool(const AzPhysics::OverlapRequest& worldSpaceRequest, const AZ::Transform& worldTransform));
         MOCK_METHOD3(GetGeometry, void(AZStd::vector<AZ::Vector3>&, AZStd::vector<AZ::u32>&, AZ::Aabb*));
         MOCK_CONST_METHOD1(GetAabb, AZ::Aabb(const AZ::Transform& worldTransform));
         MOCK_CONST_METHOD0(GetAabbLocal, AZ::Aabb());
@@ -48,6 +48,10 @@ ly_append_configurations_options(
         AZ_BUILD_CONFIGURATION_TYPE="${LY_BUILD_CONFIGURATION_TYPE_RELEASE}"
 )
 
+# The x86 platforms compile every target for AVX2 and FMA when enabled, and define AZ_BUILD_WITH_AVX2 so that the inline math
+# uses fused multiply-add. Otherwise only the batch math kernels use AVX2, after checking the running CPU.
+set(LY_BUILD_WITH_AVX2 FALSE CACHE BOOL "Builds all targets for AVX2 and FMA, the binaries then require a CPU which supports them (default = FALSE)")
+
 # Ninja: parallel compile and link pool settings
 if(CMAKE_GENERATOR MATCHES "Ninja")
     set(LY_PARALLEL_COMPILE_JOBS "" CACHE STRING "Number of compile jobs to use (Defaults to not set)")
@@ -19,6 +19,16 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
             -fPIC
             -msse4.1
     )
+
+    if(LY_BUILD_WITH_AVX2)
+        ly_append_configurations_options(
+            DEFINES
+                AZ_BUILD_WITH_AVX2
+            COMPILATION
+                -mavx2
+                -mfma
+        )
+    endif()
     ly_set(CMAKE_CXX_EXTENSIONS OFF)
 else()
 
@@ -21,6 +21,16 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "AppleClang")
             -lpthread
             -lncurses
     )
+
+    if(LY_BUILD_WITH_AVX2)
+        ly_append_configurations_options(
+            DEFINES
+                AZ_BUILD_WITH_AVX2
+            COMPILATION
+                -mavx2
+                -mfma
+        )
+    endif()
     ly_set(CMAKE_CXX_EXTENSIONS OFF)
 else()
 
@@ -23,6 +23,15 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
             /MACHINE:X64
     )
 
+    if(LY_BUILD_WITH_AVX2)
+        ly_append_configurations_options(
+            DEFINES
+                AZ_BUILD_WITH_AVX2
+            COMPILATION
+                /arch:AVX2
+        )
+    endif()
+
 elseif(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
 
     include(cmake/Platform/Common/Clang/Configurations_clang.cmake)
@@ -40,6 +49,16 @@ elseif(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
             -mf16c
             -Wno-deprecated-declarations
     )
+
+    if(LY_BUILD_WITH_AVX2)
+        ly_append_configurations_options(
+            DEFINES
+                AZ_BUILD_WITH_AVX2
+            COMPILATION
+                -mavx2
+                -mfma
+        )
+    endif()
     ly_set(CMAKE_CXX_EXTENSIONS OFF)
 
 else()